@@ -0,0 +1,490 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains axis-aligned bounding boxes in 2d and 3d space
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  Bit Math Library.
+  https://github.com/bitwizeshift/bit-math
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_MATH_AABB_HPP
+#define BIT_MATH_AABB_HPP
+
+#include "vector.hpp" // bit::math::vec2, bit::math::vec3
+#include "matrix.hpp" // bit::math::mat3, bit::math::mat4
+#include "point.hpp"  // bit::math::point2, bit::math::point3
+
+#include <cassert> // assert
+#include <cstddef> // std::size_t
+#include <limits>  // std::numeric_limits
+
+namespace bit {
+  namespace math {
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief An axis-aligned bounding box in 2d space
+    ///
+    /// The box is the closed region between its min and max corners. A
+    /// default-constructed box is empty, with its corners at positive and
+    /// negative infinity, so that merging anything into it yields that
+    /// thing's bounds.
+    ///
+    /// The corners are stored contiguously as 4 components, so arrays of
+    /// boxes can be processed lane-parallel by the batch functions.
+    //////////////////////////////////////////////////////////////////////////
+    class aabb2
+    {
+      //----------------------------------------------------------------------
+      // Public Types
+      //----------------------------------------------------------------------
+    public:
+
+      using value_type = float_t;
+      using size_type  = std::size_t;
+
+      //----------------------------------------------------------------------
+      // Constructors
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Default-constructs an empty aabb2
+      constexpr aabb2() noexcept;
+
+      /// \brief Constructs an aabb2 spanning [\p min, \p max]
+      ///
+      /// \pre every component of \p min is no greater than that of \p max
+      ///
+      /// \param min the minimum corner
+      /// \param max the maximum corner
+      aabb2( const point2& min, const point2& max ) noexcept;
+
+      aabb2( const aabb2& other ) noexcept = default;
+      aabb2( aabb2&& other ) noexcept = default;
+
+      //----------------------------------------------------------------------
+
+      aabb2& operator=( const aabb2& other ) noexcept = default;
+      aabb2& operator=( aabb2&& other ) noexcept = default;
+
+      //----------------------------------------------------------------------
+      // Observers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the minimum corner of this box
+      ///
+      /// \return the minimum corner
+      constexpr const point2& min() const noexcept;
+
+      /// \brief Gets the maximum corner of this box
+      ///
+      /// \return the maximum corner
+      constexpr const point2& max() const noexcept;
+
+      /// \brief Gets the center of this box
+      ///
+      /// \pre this box is not empty
+      ///
+      /// \return the center
+      point2 center() const noexcept;
+
+      /// \brief Gets the distances from the center of this box to its edges
+      ///
+      /// \pre this box is not empty
+      ///
+      /// \return the half-extents
+      vec2 extents() const noexcept;
+
+      /// \brief Gets the width and height of this box
+      ///
+      /// \return the size, which is zero for an empty box
+      vec2 size() const noexcept;
+
+      /// \brief Gets the area of this box
+      ///
+      /// \return the area, which is zero for an empty box
+      value_type area() const noexcept;
+
+      /// \brief Gets the perimeter of this box
+      ///
+      /// This is the 2d analogue of a surface area, and is the cost metric
+      /// used when building 2d bounding volume hierarchies
+      ///
+      /// \return the perimeter, which is zero for an empty box
+      value_type perimeter() const noexcept;
+
+      /// \brief Determines whether this box contains no points
+      ///
+      /// \return \c true if this box is empty
+      bool is_empty() const noexcept;
+
+      //----------------------------------------------------------------------
+      // Queries
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Determines whether \p point lies within this box
+      ///
+      /// \param point the point to test
+      /// \return \c true if \p point is inside or on the edge of this box
+      bool contains( const point2& point ) const noexcept;
+
+      /// \brief Determines whether \p other lies entirely within this box
+      ///
+      /// \param other the box to test
+      /// \return \c true if every point of \p other is within this box
+      bool contains( const aabb2& other ) const noexcept;
+
+      /// \brief Determines whether \p other overlaps this box
+      ///
+      /// \param other the box to test
+      /// \return \c true if the boxes share at least one point
+      bool intersects( const aabb2& other ) const noexcept;
+
+      //----------------------------------------------------------------------
+      // Modifiers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Grows this box to also enclose \p point
+      ///
+      /// \param point the point to enclose
+      /// \return reference to \c (*this)
+      aabb2& merge( const point2& point ) noexcept;
+
+      /// \brief Grows this box to also enclose \p other
+      ///
+      /// \param other the box to enclose
+      /// \return reference to \c (*this)
+      aabb2& merge( const aabb2& other ) noexcept;
+
+      /// \brief Moves each edge of this box outwards by \p amount
+      ///
+      /// An empty box is left empty
+      ///
+      /// \param amount the distance to move each edge
+      /// \return reference to \c (*this)
+      aabb2& expand( value_type amount ) noexcept;
+
+      /// \brief Moves the edges of this box outwards by the components of
+      ///        \p amount
+      ///
+      /// \param amount the distance to move the edges along each axis
+      /// \return reference to \c (*this)
+      aabb2& expand( const vec2& amount ) noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      point2 m_min;
+      point2 m_max;
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief An axis-aligned bounding box in 3d space
+    ///
+    /// The box is the closed region between its min and max corners. A
+    /// default-constructed box is empty, with its corners at positive and
+    /// negative infinity, so that merging anything into it yields that
+    /// thing's bounds.
+    ///
+    /// The corners are stored contiguously as 6 components, so arrays of
+    /// boxes can be processed lane-parallel by the batch functions.
+    //////////////////////////////////////////////////////////////////////////
+    class aabb3
+    {
+      //----------------------------------------------------------------------
+      // Public Types
+      //----------------------------------------------------------------------
+    public:
+
+      using value_type = float_t;
+      using size_type  = std::size_t;
+
+      //----------------------------------------------------------------------
+      // Constructors
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Default-constructs an empty aabb3
+      constexpr aabb3() noexcept;
+
+      /// \brief Constructs an aabb3 spanning [\p min, \p max]
+      ///
+      /// \pre every component of \p min is no greater than that of \p max
+      ///
+      /// \param min the minimum corner
+      /// \param max the maximum corner
+      aabb3( const point3& min, const point3& max ) noexcept;
+
+      aabb3( const aabb3& other ) noexcept = default;
+      aabb3( aabb3&& other ) noexcept = default;
+
+      //----------------------------------------------------------------------
+
+      aabb3& operator=( const aabb3& other ) noexcept = default;
+      aabb3& operator=( aabb3&& other ) noexcept = default;
+
+      //----------------------------------------------------------------------
+      // Observers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the minimum corner of this box
+      ///
+      /// \return the minimum corner
+      constexpr const point3& min() const noexcept;
+
+      /// \brief Gets the maximum corner of this box
+      ///
+      /// \return the maximum corner
+      constexpr const point3& max() const noexcept;
+
+      /// \brief Gets the center of this box
+      ///
+      /// \pre this box is not empty
+      ///
+      /// \return the center
+      point3 center() const noexcept;
+
+      /// \brief Gets the distances from the center of this box to its faces
+      ///
+      /// \pre this box is not empty
+      ///
+      /// \return the half-extents
+      vec3 extents() const noexcept;
+
+      /// \brief Gets the width, height and depth of this box
+      ///
+      /// \return the size, which is zero for an empty box
+      vec3 size() const noexcept;
+
+      /// \brief Gets the surface area of this box
+      ///
+      /// \return the surface area, which is zero for an empty box
+      value_type surface_area() const noexcept;
+
+      /// \brief Gets the volume of this box
+      ///
+      /// \return the volume, which is zero for an empty box
+      value_type volume() const noexcept;
+
+      /// \brief Determines whether this box contains no points
+      ///
+      /// \return \c true if this box is empty
+      bool is_empty() const noexcept;
+
+      //----------------------------------------------------------------------
+      // Queries
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Determines whether \p point lies within this box
+      ///
+      /// \param point the point to test
+      /// \return \c true if \p point is inside or on a face of this box
+      bool contains( const point3& point ) const noexcept;
+
+      /// \brief Determines whether \p other lies entirely within this box
+      ///
+      /// \param other the box to test
+      /// \return \c true if every point of \p other is within this box
+      bool contains( const aabb3& other ) const noexcept;
+
+      /// \brief Determines whether \p other overlaps this box
+      ///
+      /// \param other the box to test
+      /// \return \c true if the boxes share at least one point
+      bool intersects( const aabb3& other ) const noexcept;
+
+      //----------------------------------------------------------------------
+      // Modifiers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Grows this box to also enclose \p point
+      ///
+      /// \param point the point to enclose
+      /// \return reference to \c (*this)
+      aabb3& merge( const point3& point ) noexcept;
+
+      /// \brief Grows this box to also enclose \p other
+      ///
+      /// \param other the box to enclose
+      /// \return reference to \c (*this)
+      aabb3& merge( const aabb3& other ) noexcept;
+
+      /// \brief Moves each face of this box outwards by \p amount
+      ///
+      /// An empty box is left empty
+      ///
+      /// \param amount the distance to move each face
+      /// \return reference to \c (*this)
+      aabb3& expand( value_type amount ) noexcept;
+
+      /// \brief Moves the faces of this box outwards by the components of
+      ///        \p amount
+      ///
+      /// \param amount the distance to move the faces along each axis
+      /// \return reference to \c (*this)
+      aabb3& expand( const vec3& amount ) noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      point3 m_min;
+      point3 m_max;
+    };
+
+    //------------------------------------------------------------------------
+    // Free Functions
+    //------------------------------------------------------------------------
+
+    /// \{
+    /// \brief Computes the smallest box enclosing both \p lhs and \p rhs
+    ///
+    /// \param lhs the first box
+    /// \param rhs the second box
+    /// \return the merged box
+    aabb2 merge( const aabb2& lhs, const aabb2& rhs ) noexcept;
+    aabb3 merge( const aabb3& lhs, const aabb3& rhs ) noexcept;
+    /// \}
+
+    /// \{
+    /// \brief Determines whether \p lhs and \p rhs overlap
+    ///
+    /// \param lhs the first box
+    /// \param rhs the second box
+    /// \return \c true if the boxes share at least one point
+    bool intersects( const aabb2& lhs, const aabb2& rhs ) noexcept;
+    bool intersects( const aabb3& lhs, const aabb3& rhs ) noexcept;
+    /// \}
+
+    /// \brief Computes the bounds of \p box after it is transformed by the
+    ///        affine \p matrix
+    ///
+    /// This uses Arvo's method, which accumulates the smaller and larger of
+    /// each matrix term applied to the min and max corners rather than
+    /// transforming all 4 corners. The result encloses the transformed box,
+    /// and is exact when \p matrix does not rotate.
+    ///
+    /// \param box the box to transform
+    /// \param matrix the transformation, with its translation in the last
+    ///        column
+    /// \return the transformed bounds, which are empty if \p box is
+    aabb2 transform_bounds( const aabb2& box, const mat3& matrix ) noexcept;
+
+    /// \brief Computes the bounds of \p box after it is transformed by the
+    ///        affine \p matrix
+    ///
+    /// This uses Arvo's method, which accumulates the smaller and larger of
+    /// each matrix term applied to the min and max corners rather than
+    /// transforming all 8 corners. The result encloses the transformed box,
+    /// and is exact when \p matrix does not rotate.
+    ///
+    /// \param box the box to transform
+    /// \param matrix the transformation, with its translation in the last
+    ///        column
+    /// \return the transformed bounds, which are empty if \p box is
+    aabb3 transform_bounds( const aabb3& box, const mat4& matrix ) noexcept;
+
+    //------------------------------------------------------------------------
+    // Comparisons
+    //------------------------------------------------------------------------
+
+    /// \{
+    /// \brief Determines exact equality between two boxes
+    ///
+    /// \param lhs the left box
+    /// \param rhs the right box
+    /// \return \c true if the two boxes have identical corners
+    bool operator==( const aabb2& lhs, const aabb2& rhs ) noexcept;
+    bool operator==( const aabb3& lhs, const aabb3& rhs ) noexcept;
+    /// \}
+
+    /// \{
+    /// \brief Determines exact inequality between two boxes
+    ///
+    /// \param lhs the left box
+    /// \param rhs the right box
+    /// \return \c true if the two boxes have a different corner
+    bool operator!=( const aabb2& lhs, const aabb2& rhs ) noexcept;
+    bool operator!=( const aabb3& lhs, const aabb3& rhs ) noexcept;
+    /// \}
+
+    //------------------------------------------------------------------------
+    // Batch Operations
+    //------------------------------------------------------------------------
+
+    // The following process arrays lane-parallel, one point or box per
+    // lane, and are each equivalent to the scalar operation of the same
+    // name applied to every element. Points and boxes must not contain NaN.
+
+    /// \{
+    /// \brief Computes the smallest box enclosing the \p n \p points
+    ///
+    /// \param points pointer to the points to enclose
+    /// \param n the number of points
+    /// \return the bounds of the points, which are empty if \p n is 0
+    aabb2 bounds_of( const point2* points, std::size_t n ) noexcept;
+    aabb3 bounds_of( const point3* points, std::size_t n ) noexcept;
+    /// \}
+
+    /// \{
+    /// \brief Tests each of the \p n \p boxes for overlap with \p box
+    ///
+    /// \param boxes pointer to the boxes to test
+    /// \param box the box to test against
+    /// \param out pointer to the \p n results
+    /// \param n the number of boxes
+    void intersects( const aabb2* boxes, const aabb2& box,
+                     bool* out, std::size_t n ) noexcept;
+    void intersects( const aabb3* boxes, const aabb3& box,
+                     bool* out, std::size_t n ) noexcept;
+    /// \}
+
+    /// \{
+    /// \brief Transforms each of the \p n boxes in \p in by \p matrix
+    ///
+    /// \param in pointer to the boxes to transform
+    /// \param matrix the affine transformation
+    /// \param out pointer to the \p n transformed bounds; may be \p in
+    /// \param n the number of boxes
+    void transform_bounds( const aabb2* in, const mat3& matrix,
+                           aabb2* out, std::size_t n ) noexcept;
+    void transform_bounds( const aabb3* in, const mat4& matrix,
+                           aabb3* out, std::size_t n ) noexcept;
+    /// \}
+
+  } // namespace math
+} // namespace bit
+
+#include "detail/aabb.inl"
+
+#endif /* BIT_MATH_AABB_HPP */
@@ -0,0 +1,207 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains algorithms for cellular (Worley) noise
+ *        generation
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  Bit Math Library.
+  https://github.com/bitwizeshift/bit-math
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_MATH_CELLULAR_HPP
+#define BIT_MATH_CELLULAR_HPP
+
+// bit::map library
+#include "vector.hpp" // bit::math::vector2, bit::math::vector3
+
+#include <cstddef> // std::size_t
+
+namespace bit {
+  namespace math {
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief Cellular noise, measuring the distance to feature points that
+    ///        are scattered one per lattice cell
+    ///
+    /// Each feature point is placed within its cell by hashing the cell
+    /// with the same permutation table used by \c bit::math::simplex and
+    /// \c bit::math::perlin. As is usual, only the 3x3 (or 3x3x3) block of
+    /// cells around a sample is searched; a closer point two cells away is
+    /// possible but rare, and only ever overestimates the distances.
+    ///
+    /// Distances are measured in units of lattice cells.
+    //////////////////////////////////////////////////////////////////////////
+    namespace cellular {
+
+      /// \brief The metric used to measure the distance to a feature point
+      enum class distance
+      {
+        euclidean, ///< straight-line distance; round cells
+        manhattan, ///< sum of the axis distances; diamond-shaped cells
+        chebyshev, ///< largest axis distance; square cells
+      };
+
+      /// \brief The feature that is returned from the distances
+      enum class feature
+      {
+        f1,          ///< the distance to the nearest feature point
+        f2,          ///< the distance to the second-nearest feature point
+        f2_minus_f1, ///< the difference of the two; bright cell borders
+      };
+
+      //----------------------------------------------------------------------
+      // Raw Noise
+      //----------------------------------------------------------------------
+
+      /// \brief Generates 2-dimensional cellular noise
+      ///
+      /// \param x the x-coordinate
+      /// \param y the y-coordinate
+      /// \param metric the distance metric
+      /// \param type the feature to return
+      /// \return the requested feature distance
+      float_t raw_noise( float_t x, float_t y,
+                         distance metric = distance::euclidean,
+                         feature type = feature::f1 ) noexcept;
+
+      /// \brief Generates 3-dimensional cellular noise
+      ///
+      /// \param x the x-coordinate
+      /// \param y the y-coordinate
+      /// \param z the z-coordinate
+      /// \param metric the distance metric
+      /// \param type the feature to return
+      /// \return the requested feature distance
+      float_t raw_noise( float_t x, float_t y, float_t z,
+                         distance metric = distance::euclidean,
+                         feature type = feature::f1 ) noexcept;
+
+      float_t raw_noise( const vec2& pos,
+                         distance metric = distance::euclidean,
+                         feature type = feature::f1 ) noexcept;
+
+      float_t raw_noise( const vec3& pos,
+                         distance metric = distance::euclidean,
+                         feature type = feature::f1 ) noexcept;
+
+      //----------------------------------------------------------------------
+
+      /// \brief Generates 2-dimensional cellular noise for \p n samples at
+      ///        once
+      ///
+      /// Samples are evaluated across SIMD lanes, as in
+      /// \c simplex::batch_raw_noise
+      ///
+      /// \param x pointer to the \p n x-coordinates
+      /// \param y pointer to the \p n y-coordinates
+      /// \param out pointer to the \p n results
+      /// \param n the number of samples
+      /// \param metric the distance metric
+      /// \param type the feature to return
+      void batch_raw_noise( const float_t* x,
+                            const float_t* y,
+                            float_t* out,
+                            std::size_t n,
+                            distance metric = distance::euclidean,
+                            feature type = feature::f1 ) noexcept;
+
+      //----------------------------------------------------------------------
+      // Grid Fill
+      //----------------------------------------------------------------------
+
+      /// \brief Fills a 2-dimensional grid with cellular noise
+      ///
+      /// The sample at column \c c and row \c r is written to
+      /// \c out[r * width + c], and is equal to
+      /// \c raw_noise(origin + step * (c,r),metric,type).
+      ///
+      /// Rows are evaluated across SIMD lanes, so samples may differ from
+      /// the scalar raw_noise in the last few bits.
+      ///
+      /// \param origin the position of the first sample
+      /// \param step the distance between adjacent samples on each axis
+      /// \param width the number of samples along the x-axis
+      /// \param height the number of samples along the y-axis
+      /// \param metric the distance metric
+      /// \param type the feature to return
+      /// \param out the buffer to write to; must hold width * height samples
+      void fill_grid_2d( const vec2& origin,
+                         const vec2& step,
+                         std::size_t width,
+                         std::size_t height,
+                         distance metric,
+                         feature type,
+                         float_t* out ) noexcept;
+
+      /// \brief Fills a 3-dimensional grid with cellular noise
+      ///
+      /// The sample at column \c c, row \c r and slice \c s is written to
+      /// \c out[(s * height + r) * width + c], and is equal to
+      /// \c raw_noise(origin + step * (c,r,s),metric,type).
+      ///
+      /// \param origin the position of the first sample
+      /// \param step the distance between adjacent samples on each axis
+      /// \param width the number of samples along the x-axis
+      /// \param height the number of samples along the y-axis
+      /// \param depth the number of samples along the z-axis
+      /// \param metric the distance metric
+      /// \param type the feature to return
+      /// \param out the buffer to write to; must hold
+      ///            width * height * depth samples
+      void fill_grid_3d( const vec3& origin,
+                         const vec3& step,
+                         std::size_t width,
+                         std::size_t height,
+                         std::size_t depth,
+                         distance metric,
+                         feature type,
+                         float_t* out ) noexcept;
+
+    } // namespace cellular
+  } // namespace math
+} // namespace bit
+
+//----------------------------------------------------------------------------
+// Raw Noise
+//----------------------------------------------------------------------------
+
+inline bit::math::float_t bit::math::cellular::raw_noise( const vec2& pos,
+                                                          distance metric,
+                                                          feature type )
+  noexcept
+{
+  return raw_noise( pos.x(), pos.y(), metric, type );
+}
+
+//----------------------------------------------------------------------------
+
+inline bit::math::float_t bit::math::cellular::raw_noise( const vec3& pos,
+                                                          distance metric,
+                                                          feature type )
+  noexcept
+{
+  return raw_noise( pos.x(), pos.y(), pos.z(), metric, type );
+}
+
+#endif /* BIT_MATH_CELLULAR_HPP */
@@ -1,6 +1,7 @@
 /*****************************************************************************
  * \file
- * \brief todo: fill in documentation
+ * \brief This header contains a value type that is clamped to
+ *        compile-time bounds
  *****************************************************************************/
 
 /*
@@ -32,29 +33,42 @@
 #ifndef BIT_MATH_CLAMPED_HPP
 #define BIT_MATH_CLAMPED_HPP
 
-#include <utility>
+#include <cassert>     // assert
+#include <cstddef>     // std::size_t
+#include <ratio>       // std::ratio, std::ratio_less_equal
+#include <type_traits> // std::common_type_t, std::is_floating_point
+#include <utility>     // std::forward, std::move
 
 namespace bit {
   namespace math {
 
     //////////////////////////////////////////////////////////////////////////
-    /// \brief A runtime clamped type that ensures that the value range sits
-    ///        between [0,1]
+    /// \brief A clamped type that ensures that the value range sits between
+    ///        the compile-time bounds [Lo,Hi]
     ///
-    /// This adds the overhead of a ternary check on construction to clamp the
-    /// values
+    /// The bounds are part of the type, so a clamped is exactly the size of
+    /// \p T. Construction adds the overhead of a ternary check to clamp the
+    /// value; operations whose result is known to stay within the bounds,
+    /// such as the product of two values in [0,1], skip it.
     ///
     /// \tparam T the type of the underlying clamped
+    /// \tparam Lo the lower bound, as a std::ratio
+    /// \tparam Hi the upper bound, as a std::ratio
     //////////////////////////////////////////////////////////////////////////
-    template<typename T>
+    template<typename T, typename Lo = std::ratio<0>, typename Hi = std::ratio<1>>
     class clamped
     {
+      static_assert( std::ratio_less_equal<Lo,Hi>::value,
+                     "the lower bound must not exceed the upper bound" );
+
       //----------------------------------------------------------------------
       // Public Types
       //----------------------------------------------------------------------
     public:
 
       using value_type = T;
+      using lower_type = Lo;
+      using upper_type = Hi;
 
       //----------------------------------------------------------------------
       // Constructors
@@ -73,11 +87,18 @@ namespace bit {
       ///
       /// \param other the other clamped
       template<typename U>
-      constexpr clamped( const clamped<U>& other ) noexcept;
+      constexpr clamped( const clamped<U,Lo,Hi>& other ) noexcept;
 
-      /// \copydoc clamped::clamped( const clamped<U>& )
+      /// \copydoc clamped::clamped( const clamped<U,Lo,Hi>& )
       template<typename U>
-      constexpr clamped( clamped<U>&& other ) noexcept;
+      constexpr clamped( clamped<U,Lo,Hi>&& other ) noexcept;
+
+      /// \brief Constructs a clamped from a clamped with different bounds,
+      ///        clamping it to these bounds
+      ///
+      /// \param other the other clamped
+      template<typename U, typename ULo, typename UHi>
+      explicit constexpr clamped( const clamped<U,ULo,UHi>& other ) noexcept;
 
       /// \brief Copy-constructs a clamped from another clamped
       ///
@@ -106,6 +127,27 @@ namespace bit {
       /// \return reference to \c (*this)
       clamped& operator=( clamped&& other ) noexcept = default;
 
+      //----------------------------------------------------------------------
+      // Bounds
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the lower bound of this clamped
+      ///
+      /// \return the lower bound
+      static constexpr T min_value() noexcept;
+
+      /// \brief Gets the upper bound of this clamped
+      ///
+      /// \return the upper bound
+      static constexpr T max_value() noexcept;
+
+      /// \brief Clamps \p value to [min_value(), max_value()]
+      ///
+      /// \param value the value to clamp
+      /// \return the clamped value
+      static constexpr T clamp( const T& value ) noexcept;
+
       //----------------------------------------------------------------------
       // Conversion
       //----------------------------------------------------------------------
@@ -139,6 +181,15 @@ namespace bit {
       template<typename U>
       constexpr clamped& operator/=( U&& scalar ) noexcept;
 
+      //----------------------------------------------------------------------
+      // Private Member Functions
+      //----------------------------------------------------------------------
+    private:
+
+      /// \brief Whether the product of two values within the bounds is
+      ///        always within the bounds, which holds for [0,Hi] with Hi <= 1
+      static constexpr bool is_closed_under_product() noexcept;
+
       //----------------------------------------------------------------------
       // Private Members
       //----------------------------------------------------------------------
@@ -146,96 +197,143 @@ namespace bit {
 
       value_type m_value; ///< The value of the clamped
 
-      template<typename>
+      template<typename,typename,typename>
       friend class clamped;
 
     };
 
+    /// \brief A value clamped to [0,1], such as a normalized weight
+    template<typename T>
+    using normalized = clamped<T>;
+
+    /// \brief A value clamped to [-1,1], such as a signed normalized weight
+    template<typename T>
+    using signed_normalized = clamped<T,std::ratio<-1>,std::ratio<1>>;
+
     //------------------------------------------------------------------------
     // Operators
     //------------------------------------------------------------------------
 
-    template<typename T, typename U>
-    constexpr clamped<std::common_type_t<T,U>>
-      operator+( const clamped<T>& lhs, const clamped<U>& rhs ) noexcept;
+    template<typename T, typename U, typename Lo, typename Hi>
+    constexpr clamped<std::common_type_t<T,U>,Lo,Hi>
+      operator+( const clamped<T,Lo,Hi>& lhs, const clamped<U,Lo,Hi>& rhs ) noexcept;
 
-    template<typename T, typename U>
-    constexpr clamped<std::common_type_t<T,U>>
-      operator+( T&& lhs, const clamped<U>& rhs ) noexcept;
+    template<typename T, typename U, typename Lo, typename Hi>
+    constexpr clamped<std::common_type_t<T,U>,Lo,Hi>
+      operator+( T&& lhs, const clamped<U,Lo,Hi>& rhs ) noexcept;
 
-    template<typename T, typename U>
-    constexpr clamped<std::common_type_t<T,U>>
-      operator+( const clamped<T>& lhs, U&& rhs ) noexcept;
+    template<typename T, typename U, typename Lo, typename Hi>
+    constexpr clamped<std::common_type_t<T,U>,Lo,Hi>
+      operator+( const clamped<T,Lo,Hi>& lhs, U&& rhs ) noexcept;
 
     //------------------------------------------------------------------------
 
-    template<typename T, typename U>
-    constexpr clamped<std::common_type_t<T,U>>
-      operator-( const clamped<T>& lhs, const clamped<U>& rhs ) noexcept;
+    template<typename T, typename U, typename Lo, typename Hi>
+    constexpr clamped<std::common_type_t<T,U>,Lo,Hi>
+      operator-( const clamped<T,Lo,Hi>& lhs, const clamped<U,Lo,Hi>& rhs ) noexcept;
 
-    template<typename T, typename U>
-    constexpr clamped<std::common_type_t<T,U>>
-      operator-( T&& lhs, const clamped<U>& rhs ) noexcept;
+    template<typename T, typename U, typename Lo, typename Hi>
+    constexpr clamped<std::common_type_t<T,U>,Lo,Hi>
+      operator-( T&& lhs, const clamped<U,Lo,Hi>& rhs ) noexcept;
 
-    template<typename T, typename U>
-    constexpr clamped<std::common_type_t<T,U>>
-      operator-( const clamped<T>& lhs, U&& rhs ) noexcept;
+    template<typename T, typename U, typename Lo, typename Hi>
+    constexpr clamped<std::common_type_t<T,U>,Lo,Hi>
+      operator-( const clamped<T,Lo,Hi>& lhs, U&& rhs ) noexcept;
 
     //------------------------------------------------------------------------
 
-    template<typename T, typename U>
-    constexpr clamped<std::common_type_t<T,U>>
-      operator*( const clamped<T>& lhs, const clamped<U>& rhs ) noexcept;
+    template<typename T, typename U, typename Lo, typename Hi>
+    constexpr clamped<std::common_type_t<T,U>,Lo,Hi>
+      operator*( const clamped<T,Lo,Hi>& lhs, const clamped<U,Lo,Hi>& rhs ) noexcept;
 
-    template<typename T, typename U>
-    constexpr clamped<std::common_type_t<T,U>>
-      operator*( T&& lhs, const clamped<U>& rhs ) noexcept;
+    template<typename T, typename U, typename Lo, typename Hi>
+    constexpr clamped<std::common_type_t<T,U>,Lo,Hi>
+      operator*( T&& lhs, const clamped<U,Lo,Hi>& rhs ) noexcept;
 
-    template<typename T, typename U>
-    constexpr clamped<std::common_type_t<T,U>>
-      operator*( const clamped<T>& lhs, U&& rhs ) noexcept;
+    template<typename T, typename U, typename Lo, typename Hi>
+    constexpr clamped<std::common_type_t<T,U>,Lo,Hi>
+      operator*( const clamped<T,Lo,Hi>& lhs, U&& rhs ) noexcept;
 
     //------------------------------------------------------------------------
 
-    template<typename T, typename U>
-    constexpr clamped<std::common_type_t<T,U>>
-      operator/( const clamped<T>& lhs, const clamped<U>& rhs ) noexcept;
+    template<typename T, typename U, typename Lo, typename Hi>
+    constexpr clamped<std::common_type_t<T,U>,Lo,Hi>
+      operator/( const clamped<T,Lo,Hi>& lhs, const clamped<U,Lo,Hi>& rhs ) noexcept;
 
-    template<typename T, typename U>
-    constexpr clamped<std::common_type_t<T,U>>
-      operator/( T&& lhs, const clamped<U>& rhs ) noexcept;
+    template<typename T, typename U, typename Lo, typename Hi>
+    constexpr clamped<std::common_type_t<T,U>,Lo,Hi>
+      operator/( T&& lhs, const clamped<U,Lo,Hi>& rhs ) noexcept;
 
-    template<typename T, typename U>
-    constexpr clamped<std::common_type_t<T,U>>
-      operator/( const clamped<T>& lhs, U&& rhs ) noexcept;
+    template<typename T, typename U, typename Lo, typename Hi>
+    constexpr clamped<std::common_type_t<T,U>,Lo,Hi>
+      operator/( const clamped<T,Lo,Hi>& lhs, U&& rhs ) noexcept;
 
     //------------------------------------------------------------------------
     // Comparisons
     //------------------------------------------------------------------------
 
-    template<typename T, typename U>
-    constexpr bool operator==( const clamped<T>& lhs,
-                               const clamped<U>& rhs ) noexcept;
+    template<typename T, typename U, typename Lo, typename Hi>
+    constexpr bool operator==( const clamped<T,Lo,Hi>& lhs,
+                               const clamped<U,Lo,Hi>& rhs ) noexcept;
+
+    template<typename T, typename U, typename Lo, typename Hi>
+    constexpr bool operator!=( const clamped<T,Lo,Hi>& lhs,
+                               const clamped<U,Lo,Hi>& rhs ) noexcept;
 
-    template<typename T, typename U>
-    constexpr bool operator!=( const clamped<T>& lhs,
-                               const clamped<U>& rhs ) noexcept;
+    template<typename T, typename U, typename Lo, typename Hi>
+    constexpr bool operator<( const clamped<T,Lo,Hi>& lhs,
+                              const clamped<U,Lo,Hi>& rhs ) noexcept;
 
-    template<typename T, typename U>
-    constexpr bool operator<( const clamped<T>& lhs,
-                              const clamped<U>& rhs ) noexcept;
+    template<typename T, typename U, typename Lo, typename Hi>
+    constexpr bool operator>( const clamped<T,Lo,Hi>& lhs,
+                              const clamped<U,Lo,Hi>& rhs ) noexcept;
 
-    template<typename T, typename U>
-    constexpr bool operator>( const clamped<T>& lhs,
-                              const clamped<U>& rhs ) noexcept;
+    template<typename T, typename U, typename Lo, typename Hi>
+    constexpr bool operator<=( const clamped<T,Lo,Hi>& lhs,
+                               const clamped<U,Lo,Hi>& rhs ) noexcept;
 
-    template<typename T, typename U>
-    constexpr bool operator<=( const clamped<T>& lhs,
-                               const clamped<U>& rhs ) noexcept;
+    template<typename T, typename U, typename Lo, typename Hi>
+    constexpr bool operator>=( const clamped<T,Lo,Hi>& lhs,
+                               const clamped<U,Lo,Hi>& rhs ) noexcept;
 
-    template<typename T, typename U>
-    constexpr bool operator>=( const clamped<T>& lhs,
-                               const clamped<U>& rhs ) noexcept;
+    //------------------------------------------------------------------------
+    // Batch Operations
+    //------------------------------------------------------------------------
+
+    /// \brief Clamps each of \p n values to the bounds of \p out
+    ///
+    /// Each value is clamped independently against the compile-time bounds,
+    /// so that the loop can be vectorized
+    ///
+    /// \param values pointer to the \p n values to clamp
+    /// \param out pointer to the \p n clamped values
+    /// \param n the number of values
+    template<typename T, typename Lo, typename Hi>
+    void clamp( const T* values, clamped<T,Lo,Hi>* out, std::size_t n ) noexcept;
+
+    /// \brief Adds each of \p n deltas to \p values, saturating at their
+    ///        bounds
+    ///
+    /// \param values pointer to the \p n clamped values to add to
+    /// \param deltas pointer to the \p n values to add
+    /// \param n the number of values
+    template<typename T, typename Lo, typename Hi>
+    void saturating_add( clamped<T,Lo,Hi>* values,
+                         const T* deltas,
+                         std::size_t n ) noexcept;
+
+    /// \brief Multiplies each of \p n \p values by the corresponding
+    ///        \p weights
+    ///
+    /// Products of values in [0,1] are never re-clamped
+    ///
+    /// \param values pointer to the \p n clamped values to scale
+    /// \param weights pointer to the \p n weights to scale by
+    /// \param n the number of values
+    template<typename T, typename Lo, typename Hi>
+    void saturating_multiply( clamped<T,Lo,Hi>* values,
+                              const clamped<T,Lo,Hi>* weights,
+                              std::size_t n ) noexcept;
 
     //----------------------------------------------------------------------------
     // Type Traits
@@ -246,7 +344,8 @@ namespace bit {
     /// The result is aliased as \c ::value
     template<typename T> struct is_clamped : std::false_type{};
 
-    template<typename T> struct is_clamped<clamped<T>> : std::true_type{};
+    template<typename T, typename Lo, typename Hi>
+    struct is_clamped<clamped<T,Lo,Hi>> : std::true_type{};
 
     /// \brief Helper variable template to retrieve the result of \ref is_clamped
     template<typename T>
@@ -0,0 +1,449 @@
+#ifndef BIT_MATH_DETAIL_AABB_INL
+#define BIT_MATH_DETAIL_AABB_INL
+
+#ifndef BIT_MATH_AABB_HPP
+# error "aabb.inl included without first including declaration header aabb.hpp"
+#endif
+
+#include <algorithm> // std::min, std::max
+
+//============================================================================
+// aabb2
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Constructors
+//----------------------------------------------------------------------------
+
+inline constexpr bit::math::aabb2::aabb2()
+  noexcept
+  : m_min{ std::numeric_limits<value_type>::infinity(),
+           std::numeric_limits<value_type>::infinity() },
+    m_max{ -std::numeric_limits<value_type>::infinity(),
+           -std::numeric_limits<value_type>::infinity() }
+{
+
+}
+
+inline bit::math::aabb2::aabb2( const point2& min, const point2& max )
+  noexcept
+  : m_min{min},
+    m_max{max}
+{
+  assert( min.x() <= max.x() && min.y() <= max.y() && "min must not exceed max" );
+}
+
+//----------------------------------------------------------------------------
+// Observers
+//----------------------------------------------------------------------------
+
+inline constexpr const bit::math::point2& bit::math::aabb2::min()
+  const noexcept
+{
+  return m_min;
+}
+
+inline constexpr const bit::math::point2& bit::math::aabb2::max()
+  const noexcept
+{
+  return m_max;
+}
+
+inline bit::math::point2 bit::math::aabb2::center()
+  const noexcept
+{
+  assert( !is_empty() );
+
+  return point2{ (m_min.x() + m_max.x()) * value_type(0.5),
+                 (m_min.y() + m_max.y()) * value_type(0.5) };
+}
+
+inline bit::math::vec2 bit::math::aabb2::extents()
+  const noexcept
+{
+  assert( !is_empty() );
+
+  return (m_max - m_min) * value_type(0.5);
+}
+
+inline bit::math::vec2 bit::math::aabb2::size()
+  const noexcept
+{
+  if( is_empty() ) return vec2{ 0, 0 };
+
+  return m_max - m_min;
+}
+
+inline bit::math::aabb2::value_type bit::math::aabb2::area()
+  const noexcept
+{
+  const auto s = size();
+
+  return s.x() * s.y();
+}
+
+inline bit::math::aabb2::value_type bit::math::aabb2::perimeter()
+  const noexcept
+{
+  const auto s = size();
+
+  return value_type(2) * (s.x() + s.y());
+}
+
+inline bool bit::math::aabb2::is_empty()
+  const noexcept
+{
+  return m_min.x() > m_max.x() || m_min.y() > m_max.y();
+}
+
+//----------------------------------------------------------------------------
+// Queries
+//----------------------------------------------------------------------------
+
+inline bool bit::math::aabb2::contains( const point2& point )
+  const noexcept
+{
+  return point.x() >= m_min.x() && point.x() <= m_max.x() &&
+         point.y() >= m_min.y() && point.y() <= m_max.y();
+}
+
+inline bool bit::math::aabb2::contains( const aabb2& other )
+  const noexcept
+{
+  return other.m_min.x() >= m_min.x() && other.m_max.x() <= m_max.x() &&
+         other.m_min.y() >= m_min.y() && other.m_max.y() <= m_max.y();
+}
+
+inline bool bit::math::aabb2::intersects( const aabb2& other )
+  const noexcept
+{
+  return m_min.x() <= other.m_max.x() && m_max.x() >= other.m_min.x() &&
+         m_min.y() <= other.m_max.y() && m_max.y() >= other.m_min.y();
+}
+
+//----------------------------------------------------------------------------
+// Modifiers
+//----------------------------------------------------------------------------
+
+inline bit::math::aabb2& bit::math::aabb2::merge( const point2& point )
+  noexcept
+{
+  m_min = point2{ std::min( m_min.x(), point.x() ), std::min( m_min.y(), point.y() ) };
+  m_max = point2{ std::max( m_max.x(), point.x() ), std::max( m_max.y(), point.y() ) };
+
+  return (*this);
+}
+
+inline bit::math::aabb2& bit::math::aabb2::merge( const aabb2& other )
+  noexcept
+{
+  m_min = point2{ std::min( m_min.x(), other.m_min.x() ),
+                  std::min( m_min.y(), other.m_min.y() ) };
+  m_max = point2{ std::max( m_max.x(), other.m_max.x() ),
+                  std::max( m_max.y(), other.m_max.y() ) };
+
+  return (*this);
+}
+
+inline bit::math::aabb2& bit::math::aabb2::expand( value_type amount )
+  noexcept
+{
+  return expand( vec2{ amount, amount } );
+}
+
+inline bit::math::aabb2& bit::math::aabb2::expand( const vec2& amount )
+  noexcept
+{
+  if( is_empty() ) return (*this);
+
+  m_min -= amount;
+  m_max += amount;
+
+  assert( !is_empty() && "box must not be shrunk past its center" );
+
+  return (*this);
+}
+
+//============================================================================
+// aabb3
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Constructors
+//----------------------------------------------------------------------------
+
+inline constexpr bit::math::aabb3::aabb3()
+  noexcept
+  : m_min{ std::numeric_limits<value_type>::infinity(),
+           std::numeric_limits<value_type>::infinity(),
+           std::numeric_limits<value_type>::infinity() },
+    m_max{ -std::numeric_limits<value_type>::infinity(),
+           -std::numeric_limits<value_type>::infinity(),
+           -std::numeric_limits<value_type>::infinity() }
+{
+
+}
+
+inline bit::math::aabb3::aabb3( const point3& min, const point3& max )
+  noexcept
+  : m_min{min},
+    m_max{max}
+{
+  assert( min.x() <= max.x() && min.y() <= max.y() && min.z() <= max.z()
+          && "min must not exceed max" );
+}
+
+//----------------------------------------------------------------------------
+// Observers
+//----------------------------------------------------------------------------
+
+inline constexpr const bit::math::point3& bit::math::aabb3::min()
+  const noexcept
+{
+  return m_min;
+}
+
+inline constexpr const bit::math::point3& bit::math::aabb3::max()
+  const noexcept
+{
+  return m_max;
+}
+
+inline bit::math::point3 bit::math::aabb3::center()
+  const noexcept
+{
+  assert( !is_empty() );
+
+  return point3{ (m_min.x() + m_max.x()) * value_type(0.5),
+                 (m_min.y() + m_max.y()) * value_type(0.5),
+                 (m_min.z() + m_max.z()) * value_type(0.5) };
+}
+
+inline bit::math::vec3 bit::math::aabb3::extents()
+  const noexcept
+{
+  assert( !is_empty() );
+
+  return (m_max - m_min) * value_type(0.5);
+}
+
+inline bit::math::vec3 bit::math::aabb3::size()
+  const noexcept
+{
+  if( is_empty() ) return vec3{ 0, 0, 0 };
+
+  return m_max - m_min;
+}
+
+inline bit::math::aabb3::value_type bit::math::aabb3::surface_area()
+  const noexcept
+{
+  const auto s = size();
+
+  return value_type(2) * (s.x() * s.y() + s.y() * s.z() + s.z() * s.x());
+}
+
+inline bit::math::aabb3::value_type bit::math::aabb3::volume()
+  const noexcept
+{
+  const auto s = size();
+
+  return s.x() * s.y() * s.z();
+}
+
+inline bool bit::math::aabb3::is_empty()
+  const noexcept
+{
+  return m_min.x() > m_max.x() || m_min.y() > m_max.y() || m_min.z() > m_max.z();
+}
+
+//----------------------------------------------------------------------------
+// Queries
+//----------------------------------------------------------------------------
+
+inline bool bit::math::aabb3::contains( const point3& point )
+  const noexcept
+{
+  return point.x() >= m_min.x() && point.x() <= m_max.x() &&
+         point.y() >= m_min.y() && point.y() <= m_max.y() &&
+         point.z() >= m_min.z() && point.z() <= m_max.z();
+}
+
+inline bool bit::math::aabb3::contains( const aabb3& other )
+  const noexcept
+{
+  return other.m_min.x() >= m_min.x() && other.m_max.x() <= m_max.x() &&
+         other.m_min.y() >= m_min.y() && other.m_max.y() <= m_max.y() &&
+         other.m_min.z() >= m_min.z() && other.m_max.z() <= m_max.z();
+}
+
+inline bool bit::math::aabb3::intersects( const aabb3& other )
+  const noexcept
+{
+  return m_min.x() <= other.m_max.x() && m_max.x() >= other.m_min.x() &&
+         m_min.y() <= other.m_max.y() && m_max.y() >= other.m_min.y() &&
+         m_min.z() <= other.m_max.z() && m_max.z() >= other.m_min.z();
+}
+
+//----------------------------------------------------------------------------
+// Modifiers
+//----------------------------------------------------------------------------
+
+inline bit::math::aabb3& bit::math::aabb3::merge( const point3& point )
+  noexcept
+{
+  m_min = point3{ std::min( m_min.x(), point.x() ),
+                  std::min( m_min.y(), point.y() ),
+                  std::min( m_min.z(), point.z() ) };
+  m_max = point3{ std::max( m_max.x(), point.x() ),
+                  std::max( m_max.y(), point.y() ),
+                  std::max( m_max.z(), point.z() ) };
+
+  return (*this);
+}
+
+inline bit::math::aabb3& bit::math::aabb3::merge( const aabb3& other )
+  noexcept
+{
+  m_min = point3{ std::min( m_min.x(), other.m_min.x() ),
+                  std::min( m_min.y(), other.m_min.y() ),
+                  std::min( m_min.z(), other.m_min.z() ) };
+  m_max = point3{ std::max( m_max.x(), other.m_max.x() ),
+                  std::max( m_max.y(), other.m_max.y() ),
+                  std::max( m_max.z(), other.m_max.z() ) };
+
+  return (*this);
+}
+
+inline bit::math::aabb3& bit::math::aabb3::expand( value_type amount )
+  noexcept
+{
+  return expand( vec3{ amount, amount, amount } );
+}
+
+inline bit::math::aabb3& bit::math::aabb3::expand( const vec3& amount )
+  noexcept
+{
+  if( is_empty() ) return (*this);
+
+  m_min -= amount;
+  m_max += amount;
+
+  assert( !is_empty() && "box must not be shrunk past its center" );
+
+  return (*this);
+}
+
+//============================================================================
+// Free Functions
+//============================================================================
+
+inline bit::math::aabb2 bit::math::merge( const aabb2& lhs, const aabb2& rhs )
+  noexcept
+{
+  return aabb2{lhs}.merge( rhs );
+}
+
+inline bit::math::aabb3 bit::math::merge( const aabb3& lhs, const aabb3& rhs )
+  noexcept
+{
+  return aabb3{lhs}.merge( rhs );
+}
+
+//----------------------------------------------------------------------------
+
+inline bool bit::math::intersects( const aabb2& lhs, const aabb2& rhs )
+  noexcept
+{
+  return lhs.intersects( rhs );
+}
+
+inline bool bit::math::intersects( const aabb3& lhs, const aabb3& rhs )
+  noexcept
+{
+  return lhs.intersects( rhs );
+}
+
+//----------------------------------------------------------------------------
+
+inline bit::math::aabb2 bit::math::transform_bounds( const aabb2& box,
+                                                     const mat3& matrix )
+  noexcept
+{
+  if( box.is_empty() ) return box;
+
+  const auto* lo = box.min().data();
+  const auto* hi = box.max().data();
+
+  float_t min[2];
+  float_t max[2];
+  for( auto r = 0; r < 2; ++r ) {
+    min[r] = max[r] = matrix(r,2);
+
+    for( auto c = 0; c < 2; ++c ) {
+      const auto a = matrix(r,c) * lo[c];
+      const auto b = matrix(r,c) * hi[c];
+
+      min[r] += std::min( a, b );
+      max[r] += std::max( a, b );
+    }
+  }
+  return aabb2{ point2{ min[0], min[1] }, point2{ max[0], max[1] } };
+}
+
+inline bit::math::aabb3 bit::math::transform_bounds( const aabb3& box,
+                                                     const mat4& matrix )
+  noexcept
+{
+  if( box.is_empty() ) return box;
+
+  const auto* lo = box.min().data();
+  const auto* hi = box.max().data();
+
+  float_t min[3];
+  float_t max[3];
+  for( auto r = 0; r < 3; ++r ) {
+    min[r] = max[r] = matrix(r,3);
+
+    for( auto c = 0; c < 3; ++c ) {
+      const auto a = matrix(r,c) * lo[c];
+      const auto b = matrix(r,c) * hi[c];
+
+      min[r] += std::min( a, b );
+      max[r] += std::max( a, b );
+    }
+  }
+  return aabb3{ point3{ min[0], min[1], min[2] }, point3{ max[0], max[1], max[2] } };
+}
+
+//============================================================================
+// Comparisons
+//============================================================================
+
+inline bool bit::math::operator==( const aabb2& lhs, const aabb2& rhs )
+  noexcept
+{
+  return lhs.min() == rhs.min() && lhs.max() == rhs.max();
+}
+
+inline bool bit::math::operator==( const aabb3& lhs, const aabb3& rhs )
+  noexcept
+{
+  return lhs.min() == rhs.min() && lhs.max() == rhs.max();
+}
+
+//----------------------------------------------------------------------------
+
+inline bool bit::math::operator!=( const aabb2& lhs, const aabb2& rhs )
+  noexcept
+{
+  return !(lhs == rhs);
+}
+
+inline bool bit::math::operator!=( const aabb3& lhs, const aabb3& rhs )
+  noexcept
+{
+  return !(lhs == rhs);
+}
+
+#endif /* BIT_MATH_DETAIL_AABB_INL */
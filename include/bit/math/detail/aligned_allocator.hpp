@@ -0,0 +1,143 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains an allocator of over-aligned storage
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  Bit Math Library.
+  https://github.com/bitwizeshift/bit-math
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_MATH_DETAIL_ALIGNED_ALLOCATOR_HPP
+#define BIT_MATH_DETAIL_ALIGNED_ALLOCATOR_HPP
+
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uintptr_t
+#include <limits>      // std::numeric_limits
+#include <new>         // ::operator new, std::bad_alloc
+#include <type_traits> // std::true_type
+
+namespace bit {
+  namespace math {
+    namespace detail {
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief An allocator whose storage is aligned to \p Align bytes
+      ///
+      /// C++14 has no aligned operator new, so each allocation is padded by
+      /// \p Align bytes and the offset to the aligned storage is stored in
+      /// the byte before it.
+      ///
+      /// \tparam T the type to allocate
+      /// \tparam Align the alignment; a power of two, at most 128
+      ////////////////////////////////////////////////////////////////////////
+      template<typename T, std::size_t Align>
+      class aligned_allocator
+      {
+        static_assert( (Align & (Align - 1)) == 0, "alignment must be a power of two" );
+        static_assert( Align >= alignof(T), "alignment must not be weaker than T's" );
+        static_assert( Align <= 128, "the offset must fit in a byte" );
+
+        //--------------------------------------------------------------------
+        // Public Types
+        //--------------------------------------------------------------------
+      public:
+
+        using value_type = T;
+        using size_type  = std::size_t;
+        using propagate_on_container_move_assignment = std::true_type;
+        using is_always_equal = std::true_type;
+
+        template<typename U>
+        struct rebind { using other = aligned_allocator<U,Align>; };
+
+        //--------------------------------------------------------------------
+        // Constructors
+        //--------------------------------------------------------------------
+      public:
+
+        aligned_allocator() noexcept = default;
+
+        template<typename U>
+        aligned_allocator( const aligned_allocator<U,Align>& ) noexcept {}
+
+        //--------------------------------------------------------------------
+        // Allocation
+        //--------------------------------------------------------------------
+      public:
+
+        /// \brief Allocates aligned storage for \p n objects
+        ///
+        /// \param n the number of objects
+        /// \return pointer to the storage
+        T* allocate( size_type n )
+        {
+          if( n > (std::numeric_limits<size_type>::max() - Align) / sizeof(T) ) {
+            throw std::bad_alloc{};
+          }
+
+          const auto raw     = static_cast<unsigned char*>( ::operator new( n * sizeof(T) + Align ) );
+          const auto address = reinterpret_cast<std::uintptr_t>( raw );
+
+          // There is always at least one byte before the aligned storage,
+          // since a raw pointer that is already aligned is advanced by Align
+          const auto offset  = Align - (address & (Align - 1));
+          const auto aligned = raw + offset;
+          aligned[-1] = static_cast<unsigned char>( offset - 1 );
+
+          return reinterpret_cast<T*>( aligned );
+        }
+
+        /// \brief Deallocates storage from allocate
+        ///
+        /// \param p pointer to the storage
+        void deallocate( T* p, size_type )
+          noexcept
+        {
+          const auto aligned = reinterpret_cast<unsigned char*>( p );
+          const auto offset  = static_cast<std::size_t>( aligned[-1] ) + 1;
+
+          ::operator delete( aligned - offset );
+        }
+      };
+
+      template<typename T, typename U, std::size_t Align>
+      bool operator==( const aligned_allocator<T,Align>&,
+                       const aligned_allocator<U,Align>& ) noexcept
+      {
+        return true;
+      }
+
+      template<typename T, typename U, std::size_t Align>
+      bool operator!=( const aligned_allocator<T,Align>&,
+                       const aligned_allocator<U,Align>& ) noexcept
+      {
+        return false;
+      }
+
+    } // namespace detail
+  } // namespace math
+} // namespace bit
+
+#endif /* BIT_MATH_DETAIL_ALIGNED_ALLOCATOR_HPP */
@@ -10,48 +10,86 @@
 // Constructors
 //----------------------------------------------------------------------------
 
-template<typename T>
-inline constexpr bit::math::clamped<T>::clamped( const T& value )
+template<typename T, typename Lo, typename Hi>
+inline constexpr bit::math::clamped<T,Lo,Hi>::clamped( const T& value )
   noexcept
-  : m_value( value >= T(1) ? T(1) : value <= T(0) ? T(0) : value )
+  : m_value( clamp(value) )
 {
 
 }
 
-template<typename T>
-inline constexpr bit::math::clamped<T>::clamped( T&& value )
+template<typename T, typename Lo, typename Hi>
+inline constexpr bit::math::clamped<T,Lo,Hi>::clamped( T&& value )
   noexcept
-  : m_value( value >= T(1) ? T(1) : value <= T(0) ? T(0) : std::move(value) )
+  : m_value( value >= max_value() ? max_value()
+           : value <= min_value() ? min_value()
+           : std::move(value) )
 {
 
 }
 
 //----------------------------------------------------------------------------
 
-template<typename T>
+template<typename T, typename Lo, typename Hi>
 template<typename U>
-inline constexpr bit::math::clamped<T>::clamped( const clamped<U>& other )
+inline constexpr bit::math::clamped<T,Lo,Hi>::clamped( const clamped<U,Lo,Hi>& other )
   noexcept
   : m_value( other.m_value )
 {
-  // This can assume it's already clamped between [0..1]
+  // This can assume it's already clamped between [Lo..Hi]
 }
 
-template<typename T>
+template<typename T, typename Lo, typename Hi>
 template<typename U>
-inline constexpr bit::math::clamped<T>::clamped( clamped<U>&& other )
+inline constexpr bit::math::clamped<T,Lo,Hi>::clamped( clamped<U,Lo,Hi>&& other )
   noexcept
   : m_value( std::move(other.m_value) )
 {
-  // This can assume it's already clamped between [0..1]
+  // This can assume it's already clamped between [Lo..Hi]
+}
+
+template<typename T, typename Lo, typename Hi>
+template<typename U, typename ULo, typename UHi>
+inline constexpr bit::math::clamped<T,Lo,Hi>::clamped( const clamped<U,ULo,UHi>& other )
+  noexcept
+  : m_value( clamp( static_cast<T>(other.m_value) ) )
+{
+
+}
+
+//----------------------------------------------------------------------------
+// Bounds
+//----------------------------------------------------------------------------
+
+template<typename T, typename Lo, typename Hi>
+inline constexpr T bit::math::clamped<T,Lo,Hi>::min_value()
+  noexcept
+{
+  return static_cast<T>(Lo::num) / static_cast<T>(Lo::den);
+}
+
+template<typename T, typename Lo, typename Hi>
+inline constexpr T bit::math::clamped<T,Lo,Hi>::max_value()
+  noexcept
+{
+  return static_cast<T>(Hi::num) / static_cast<T>(Hi::den);
+}
+
+template<typename T, typename Lo, typename Hi>
+inline constexpr T bit::math::clamped<T,Lo,Hi>::clamp( const T& value )
+  noexcept
+{
+  return value >= max_value() ? max_value()
+       : value <= min_value() ? min_value()
+       : value;
 }
 
 //----------------------------------------------------------------------------
 // Conversion
 //----------------------------------------------------------------------------
 
-template<typename T>
-inline constexpr bit::math::clamped<T>::operator T()
+template<typename T, typename Lo, typename Hi>
+inline constexpr bit::math::clamped<T,Lo,Hi>::operator T()
   const noexcept
 {
   return m_value;
@@ -61,207 +99,228 @@ inline constexpr bit::math::clamped<T>::operator T()
 // Compound Operators
 //----------------------------------------------------------------------------
 
-template<typename T>
-inline constexpr bit::math::clamped<T>&
-  bit::math::clamped<T>::operator+=( const clamped& rhs )
+template<typename T, typename Lo, typename Hi>
+inline constexpr bit::math::clamped<T,Lo,Hi>&
+  bit::math::clamped<T,Lo,Hi>::operator+=( const clamped& rhs )
   noexcept
 {
-  m_value = clamped(m_value + static_cast<T>(rhs));
+  m_value = clamp(m_value + rhs.m_value);
 
   return (*this);
 }
 
-template<typename T>
+template<typename T, typename Lo, typename Hi>
 template<typename U>
-inline constexpr bit::math::clamped<T>&
-  bit::math::clamped<T>::operator+=( U&& scalar )
+inline constexpr bit::math::clamped<T,Lo,Hi>&
+  bit::math::clamped<T,Lo,Hi>::operator+=( U&& scalar )
   noexcept
 {
-  m_value = clamped(m_value + std::forward<U>(scalar));
+  m_value = clamp(m_value + std::forward<U>(scalar));
 
   return (*this);
 }
 
 //----------------------------------------------------------------------------
 
-template<typename T>
-inline constexpr bit::math::clamped<T>&
-  bit::math::clamped<T>::operator-=( const clamped& rhs )
+template<typename T, typename Lo, typename Hi>
+inline constexpr bit::math::clamped<T,Lo,Hi>&
+  bit::math::clamped<T,Lo,Hi>::operator-=( const clamped& rhs )
   noexcept
 {
-  m_value = clamped(m_value - static_cast<T>(rhs));
+  m_value = clamp(m_value - rhs.m_value);
 
   return (*this);
 }
 
-template<typename T>
+template<typename T, typename Lo, typename Hi>
 template<typename U>
-inline constexpr bit::math::clamped<T>&
-  bit::math::clamped<T>::operator-=( U&& scalar )
+inline constexpr bit::math::clamped<T,Lo,Hi>&
+  bit::math::clamped<T,Lo,Hi>::operator-=( U&& scalar )
   noexcept
 {
-  m_value = clamped(m_value - std::forward<U>(scalar));
+  m_value = clamp(m_value - std::forward<U>(scalar));
 
   return (*this);
 }
 
 //----------------------------------------------------------------------------
 
-template<typename T>
-inline constexpr bit::math::clamped<T>&
-  bit::math::clamped<T>::operator*=( const clamped& rhs )
+template<typename T, typename Lo, typename Hi>
+inline constexpr bit::math::clamped<T,Lo,Hi>&
+  bit::math::clamped<T,Lo,Hi>::operator*=( const clamped& rhs )
   noexcept
 {
-  m_value = clamped(m_value * static_cast<T>(rhs));
+  // The product of two values in [0,Hi<=1] never leaves the bounds
+  m_value = is_closed_under_product() ? T(m_value * rhs.m_value)
+                                      : clamp(m_value * rhs.m_value);
 
   return (*this);
 }
 
-template<typename T>
+template<typename T, typename Lo, typename Hi>
 template<typename U>
-inline constexpr bit::math::clamped<T>&
-  bit::math::clamped<T>::operator*=( U&& scalar )
+inline constexpr bit::math::clamped<T,Lo,Hi>&
+  bit::math::clamped<T,Lo,Hi>::operator*=( U&& scalar )
   noexcept
 {
-  m_value = clamped(m_value * std::forward<U>(scalar));
+  m_value = clamp(m_value * std::forward<U>(scalar));
 
   return (*this);
 }
 
 //----------------------------------------------------------------------------
 
-template<typename T>
-inline constexpr bit::math::clamped<T>&
-  bit::math::clamped<T>::operator/=( const clamped& rhs )
+template<typename T, typename Lo, typename Hi>
+inline constexpr bit::math::clamped<T,Lo,Hi>&
+  bit::math::clamped<T,Lo,Hi>::operator/=( const clamped& rhs )
   noexcept
 {
-  m_value = clamped(m_value / static_cast<T>(rhs));
+  m_value = clamp(m_value / rhs.m_value);
 
   return (*this);
 }
 
-template<typename T>
+template<typename T, typename Lo, typename Hi>
 template<typename U>
-inline constexpr bit::math::clamped<T>&
-  bit::math::clamped<T>::operator/=( U&& scalar )
+inline constexpr bit::math::clamped<T,Lo,Hi>&
+  bit::math::clamped<T,Lo,Hi>::operator/=( U&& scalar )
   noexcept
 {
-  m_value = clamped(m_value / std::forward<U>(scalar));
+  m_value = clamp(m_value / std::forward<U>(scalar));
 
   return (*this);
 }
 
+//----------------------------------------------------------------------------
+// Private Member Functions
+//----------------------------------------------------------------------------
+
+template<typename T, typename Lo, typename Hi>
+inline constexpr bool bit::math::clamped<T,Lo,Hi>::is_closed_under_product()
+  noexcept
+{
+  return Lo::num == 0 && std::ratio_less_equal<Hi,std::ratio<1>>::value;
+}
+
 //----------------------------------------------------------------------------
 // Operators
 //----------------------------------------------------------------------------
 
-template<typename T, typename U>
-inline constexpr bit::math::clamped<std::common_type_t<T,U>>
-  bit::math::operator+( const clamped<T>& lhs, const clamped<U>& rhs )
+template<typename T, typename U, typename Lo, typename Hi>
+inline constexpr bit::math::clamped<std::common_type_t<T,U>,Lo,Hi>
+  bit::math::operator+( const clamped<T,Lo,Hi>& lhs, const clamped<U,Lo,Hi>& rhs )
   noexcept
 {
-  return (clamped<std::common_type_t<T,U>>(lhs) += rhs);
+  return (clamped<std::common_type_t<T,U>,Lo,Hi>(lhs) += rhs);
 }
 
-template<typename T, typename U>
-inline constexpr bit::math::clamped<std::common_type_t<T,U>>
-  bit::math::operator+( T&& lhs, const clamped<U>& rhs )
+template<typename T, typename U, typename Lo, typename Hi>
+inline constexpr bit::math::clamped<std::common_type_t<T,U>,Lo,Hi>
+  bit::math::operator+( T&& lhs, const clamped<U,Lo,Hi>& rhs )
   noexcept
 {
-  return (clamped<std::common_type_t<T,U>>(rhs) += std::forward<T>(lhs));
+  return (clamped<std::common_type_t<T,U>,Lo,Hi>(rhs) += std::forward<T>(lhs));
 }
 
-template<typename T, typename U>
-inline constexpr bit::math::clamped<std::common_type_t<T,U>>
-  bit::math::operator+( const clamped<T>& lhs, U&& rhs )
+template<typename T, typename U, typename Lo, typename Hi>
+inline constexpr bit::math::clamped<std::common_type_t<T,U>,Lo,Hi>
+  bit::math::operator+( const clamped<T,Lo,Hi>& lhs, U&& rhs )
   noexcept
 {
-  return (clamped<std::common_type_t<T,U>>(lhs) += std::forward<U>(rhs));
+  return (clamped<std::common_type_t<T,U>,Lo,Hi>(lhs) += std::forward<U>(rhs));
 }
 
 //----------------------------------------------------------------------------
 
-template<typename T, typename U>
-inline constexpr bit::math::clamped<std::common_type_t<T,U>>
-  bit::math::operator-( const clamped<T>& lhs, const clamped<U>& rhs )
+template<typename T, typename U, typename Lo, typename Hi>
+inline constexpr bit::math::clamped<std::common_type_t<T,U>,Lo,Hi>
+  bit::math::operator-( const clamped<T,Lo,Hi>& lhs, const clamped<U,Lo,Hi>& rhs )
   noexcept
 {
-  return (clamped<std::common_type_t<T,U>>(lhs) -= rhs);
+  return (clamped<std::common_type_t<T,U>,Lo,Hi>(lhs) -= rhs);
 }
 
-template<typename T, typename U>
-inline constexpr bit::math::clamped<std::common_type_t<T,U>>
-  bit::math::operator-( T&& lhs, const clamped<U>& rhs )
+template<typename T, typename U, typename Lo, typename Hi>
+inline constexpr bit::math::clamped<std::common_type_t<T,U>,Lo,Hi>
+  bit::math::operator-( T&& lhs, const clamped<U,Lo,Hi>& rhs )
   noexcept
 {
-  return (clamped<std::common_type_t<T,U>>(rhs) -= std::forward<T>(lhs));
+  using common_type = std::common_type_t<T,U>;
+
+  return clamped<common_type,Lo,Hi>(
+    static_cast<common_type>(std::forward<T>(lhs)) - static_cast<common_type>(static_cast<U>(rhs))
+  );
 }
 
-template<typename T, typename U>
-inline constexpr bit::math::clamped<std::common_type_t<T,U>>
-  bit::math::operator-( const clamped<T>& lhs, U&& rhs )
+template<typename T, typename U, typename Lo, typename Hi>
+inline constexpr bit::math::clamped<std::common_type_t<T,U>,Lo,Hi>
+  bit::math::operator-( const clamped<T,Lo,Hi>& lhs, U&& rhs )
   noexcept
 {
-  return (clamped<std::common_type_t<T,U>>(lhs) -= std::forward<U>(rhs));
+  return (clamped<std::common_type_t<T,U>,Lo,Hi>(lhs) -= std::forward<U>(rhs));
 }
 //----------------------------------------------------------------------------
 
-template<typename T, typename U>
-inline constexpr bit::math::clamped<std::common_type_t<T,U>>
-  bit::math::operator*( const clamped<T>& lhs, const clamped<U>& rhs )
+template<typename T, typename U, typename Lo, typename Hi>
+inline constexpr bit::math::clamped<std::common_type_t<T,U>,Lo,Hi>
+  bit::math::operator*( const clamped<T,Lo,Hi>& lhs, const clamped<U,Lo,Hi>& rhs )
   noexcept
 {
-  return (clamped<std::common_type_t<T,U>>(lhs) *= rhs);
+  return (clamped<std::common_type_t<T,U>,Lo,Hi>(lhs) *= rhs);
 }
 
-template<typename T, typename U>
-inline constexpr bit::math::clamped<std::common_type_t<T,U>>
-  bit::math::operator*( T&& lhs, const clamped<U>& rhs )
+template<typename T, typename U, typename Lo, typename Hi>
+inline constexpr bit::math::clamped<std::common_type_t<T,U>,Lo,Hi>
+  bit::math::operator*( T&& lhs, const clamped<U,Lo,Hi>& rhs )
   noexcept
 {
-  return (clamped<std::common_type_t<T,U>>(rhs) *= std::forward<T>(lhs));
+  return (clamped<std::common_type_t<T,U>,Lo,Hi>(rhs) *= std::forward<T>(lhs));
 }
 
-template<typename T, typename U>
-inline constexpr bit::math::clamped<std::common_type_t<T,U>>
-  bit::math::operator*( const clamped<T>& lhs, U&& rhs )
+template<typename T, typename U, typename Lo, typename Hi>
+inline constexpr bit::math::clamped<std::common_type_t<T,U>,Lo,Hi>
+  bit::math::operator*( const clamped<T,Lo,Hi>& lhs, U&& rhs )
   noexcept
 {
-  return (clamped<std::common_type_t<T,U>>(lhs) *= std::forward<U>(rhs));
+  return (clamped<std::common_type_t<T,U>,Lo,Hi>(lhs) *= std::forward<U>(rhs));
 }
 //----------------------------------------------------------------------------
 
-template<typename T, typename U>
-inline constexpr bit::math::clamped<std::common_type_t<T,U>>
-  bit::math::operator/( const clamped<T>& lhs, const clamped<U>& rhs )
+template<typename T, typename U, typename Lo, typename Hi>
+inline constexpr bit::math::clamped<std::common_type_t<T,U>,Lo,Hi>
+  bit::math::operator/( const clamped<T,Lo,Hi>& lhs, const clamped<U,Lo,Hi>& rhs )
   noexcept
 {
-  return (clamped<std::common_type_t<T,U>>(lhs) /= rhs);
+  return (clamped<std::common_type_t<T,U>,Lo,Hi>(lhs) /= rhs);
 }
 
-template<typename T, typename U>
-inline constexpr bit::math::clamped<std::common_type_t<T,U>>
-  bit::math::operator/( T&& lhs, const clamped<U>& rhs )
+template<typename T, typename U, typename Lo, typename Hi>
+inline constexpr bit::math::clamped<std::common_type_t<T,U>,Lo,Hi>
+  bit::math::operator/( T&& lhs, const clamped<U,Lo,Hi>& rhs )
   noexcept
 {
-  return (clamped<std::common_type_t<T,U>>(rhs) /= std::forward<T>(lhs));
+  using common_type = std::common_type_t<T,U>;
+
+  return clamped<common_type,Lo,Hi>(
+    static_cast<common_type>(std::forward<T>(lhs)) / static_cast<common_type>(static_cast<U>(rhs))
+  );
 }
 
-template<typename T, typename U>
-inline constexpr bit::math::clamped<std::common_type_t<T,U>>
-  bit::math::operator/( const clamped<T>& lhs, U&& rhs )
+template<typename T, typename U, typename Lo, typename Hi>
+inline constexpr bit::math::clamped<std::common_type_t<T,U>,Lo,Hi>
+  bit::math::operator/( const clamped<T,Lo,Hi>& lhs, U&& rhs )
   noexcept
 {
-  return (clamped<std::common_type_t<T,U>>(lhs) /= std::forward<U>(rhs));
+  return (clamped<std::common_type_t<T,U>,Lo,Hi>(lhs) /= std::forward<U>(rhs));
 }
 
 //----------------------------------------------------------------------------
 // Comparisons
 //----------------------------------------------------------------------------
 
-template<typename T, typename U>
+template<typename T, typename U, typename Lo, typename Hi>
 inline constexpr bool
-  bit::math::operator==( const clamped<T>& lhs, const clamped<U>& rhs )
+  bit::math::operator==( const clamped<T,Lo,Hi>& lhs, const clamped<U,Lo,Hi>& rhs )
   noexcept
 {
   return static_cast<T>(lhs)==static_cast<U>(rhs);
@@ -269,9 +328,9 @@ inline constexpr bool
 
 //----------------------------------------------------------------------------
 
-template<typename T, typename U>
+template<typename T, typename U, typename Lo, typename Hi>
 inline constexpr bool
-  bit::math::operator!=( const clamped<T>& lhs, const clamped<U>& rhs )
+  bit::math::operator!=( const clamped<T,Lo,Hi>& lhs, const clamped<U,Lo,Hi>& rhs )
   noexcept
 {
   return static_cast<T>(lhs)!=static_cast<U>(rhs);
@@ -279,9 +338,9 @@ inline constexpr bool
 
 //----------------------------------------------------------------------------
 
-template<typename T, typename U>
+template<typename T, typename U, typename Lo, typename Hi>
 inline constexpr bool
-  bit::math::operator<( const clamped<T>& lhs, const clamped<U>& rhs )
+  bit::math::operator<( const clamped<T,Lo,Hi>& lhs, const clamped<U,Lo,Hi>& rhs )
   noexcept
 {
   return static_cast<T>(lhs)<static_cast<U>(rhs);
@@ -289,9 +348,9 @@ inline constexpr bool
 
 //----------------------------------------------------------------------------
 
-template<typename T, typename U>
+template<typename T, typename U, typename Lo, typename Hi>
 inline constexpr bool
-  bit::math::operator>( const clamped<T>& lhs, const clamped<U>& rhs )
+  bit::math::operator>( const clamped<T,Lo,Hi>& lhs, const clamped<U,Lo,Hi>& rhs )
   noexcept
 {
   return static_cast<T>(lhs)>static_cast<U>(rhs);
@@ -299,9 +358,9 @@ inline constexpr bool
 
 //----------------------------------------------------------------------------
 
-template<typename T, typename U>
+template<typename T, typename U, typename Lo, typename Hi>
 inline constexpr bool
-  bit::math::operator<=( const clamped<T>& lhs, const clamped<U>& rhs )
+  bit::math::operator<=( const clamped<T,Lo,Hi>& lhs, const clamped<U,Lo,Hi>& rhs )
   noexcept
 {
   return static_cast<T>(lhs)<=static_cast<U>(rhs);
@@ -309,11 +368,55 @@ inline constexpr bool
 
 //----------------------------------------------------------------------------
 
-template<typename T, typename U>
+template<typename T, typename U, typename Lo, typename Hi>
 inline constexpr bool
-  bit::math::operator>=( const clamped<T>& lhs, const clamped<U>& rhs )
+  bit::math::operator>=( const clamped<T,Lo,Hi>& lhs, const clamped<U,Lo,Hi>& rhs )
   noexcept
 {
   return static_cast<T>(lhs)>=static_cast<U>(rhs);
 }
+
+//----------------------------------------------------------------------------
+// Batch Operations
+//----------------------------------------------------------------------------
+
+template<typename T, typename Lo, typename Hi>
+inline void bit::math::clamp( const T* values,
+                              clamped<T,Lo,Hi>* out,
+                              std::size_t n )
+  noexcept
+{
+  assert( (values != nullptr && out != nullptr) || n == 0 );
+
+  for( auto i = std::size_t{0}; i < n; ++i ) {
+    out[i] = clamped<T,Lo,Hi>( values[i] );
+  }
+}
+
+template<typename T, typename Lo, typename Hi>
+inline void bit::math::saturating_add( clamped<T,Lo,Hi>* values,
+                                       const T* deltas,
+                                       std::size_t n )
+  noexcept
+{
+  assert( (values != nullptr && deltas != nullptr) || n == 0 );
+
+  for( auto i = std::size_t{0}; i < n; ++i ) {
+    values[i] += deltas[i];
+  }
+}
+
+template<typename T, typename Lo, typename Hi>
+inline void bit::math::saturating_multiply( clamped<T,Lo,Hi>* values,
+                                            const clamped<T,Lo,Hi>* weights,
+                                            std::size_t n )
+  noexcept
+{
+  assert( (values != nullptr && weights != nullptr) || n == 0 );
+
+  for( auto i = std::size_t{0}; i < n; ++i ) {
+    values[i] *= weights[i];
+  }
+}
+
 #endif /* BIT_MATH_DETAIL_CLAMPED_INL */
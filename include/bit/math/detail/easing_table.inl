@@ -0,0 +1,321 @@
+#ifndef BIT_MATH_DETAIL_EASING_TABLE_INL
+#define BIT_MATH_DETAIL_EASING_TABLE_INL
+
+#ifndef BIT_MATH_EASING_TABLE_HPP
+# error "easing_table.inl included without first including declaration header easing_table.hpp"
+#endif
+
+//============================================================================
+// detail
+//============================================================================
+
+inline constexpr long double bit::math::detail::constexpr_sqrt( long double x )
+  noexcept
+{
+  if( !(x > 0) ) return 0;
+
+  // Newton's method converges quadratically from any positive guess
+  auto result = x < 1 ? 1.0L : x;
+  for( auto i = 0; i < 64; ++i ) {
+    const auto next = (result + x / result) * 0.5L;
+    if( next == result ) break;
+    result = next;
+  }
+  return result;
+}
+
+inline constexpr long double bit::math::detail::constexpr_sin( long double x )
+  noexcept
+{
+  // x - x^3/3! + x^5/5! - ...
+  auto result = x;
+  auto term   = x;
+  for( auto i = 1; i < 32; ++i ) {
+    term *= -x * x / ((2 * i) * (2 * i + 1));
+    result += term;
+  }
+  return result;
+}
+
+inline constexpr long double bit::math::detail::constexpr_cos( long double x )
+  noexcept
+{
+  // 1 - x^2/2! + x^4/4! - ...
+  auto result = 1.0L;
+  auto term   = 1.0L;
+  for( auto i = 1; i < 32; ++i ) {
+    term *= -x * x / ((2 * i - 1) * (2 * i));
+    result += term;
+  }
+  return result;
+}
+
+//============================================================================
+// Easing Curves
+//============================================================================
+
+inline constexpr bit::math::float_t
+  bit::math::linear_curve::operator()( float_t t )
+  const noexcept
+{
+  return t;
+}
+
+inline constexpr bit::math::float_t
+  bit::math::linear_curve::max_second_derivative()
+  noexcept
+{
+  return 0;
+}
+
+//----------------------------------------------------------------------------
+
+inline constexpr bit::math::float_t
+  bit::math::quadratic_curve::operator()( float_t t )
+  const noexcept
+{
+  return t*t;
+}
+
+inline constexpr bit::math::float_t
+  bit::math::quadratic_curve::max_second_derivative()
+  noexcept
+{
+  return 2;
+}
+
+//----------------------------------------------------------------------------
+
+inline constexpr bit::math::float_t
+  bit::math::cubic_curve::operator()( float_t t )
+  const noexcept
+{
+  return t*t*t;
+}
+
+inline constexpr bit::math::float_t
+  bit::math::cubic_curve::max_second_derivative()
+  noexcept
+{
+  return 6;
+}
+
+//----------------------------------------------------------------------------
+
+inline constexpr bit::math::float_t
+  bit::math::quartic_curve::operator()( float_t t )
+  const noexcept
+{
+  return t*t*t*t;
+}
+
+inline constexpr bit::math::float_t
+  bit::math::quartic_curve::max_second_derivative()
+  noexcept
+{
+  return 12;
+}
+
+//----------------------------------------------------------------------------
+
+inline constexpr bit::math::float_t
+  bit::math::quintic_curve::operator()( float_t t )
+  const noexcept
+{
+  return t*t*t*t*t;
+}
+
+inline constexpr bit::math::float_t
+  bit::math::quintic_curve::max_second_derivative()
+  noexcept
+{
+  return 20;
+}
+
+//----------------------------------------------------------------------------
+
+inline constexpr bit::math::float_t
+  bit::math::circular_curve::operator()( float_t t )
+  const noexcept
+{
+  return static_cast<float_t>( 1.0L - detail::constexpr_sqrt( 1.0L - t*t ) );
+}
+
+inline constexpr bit::math::float_t
+  bit::math::circular_curve::max_second_derivative()
+  noexcept
+{
+  return std::numeric_limits<float_t>::infinity();
+}
+
+//----------------------------------------------------------------------------
+
+inline constexpr bit::math::float_t
+  bit::math::half_cosine_curve::operator()( float_t t )
+  const noexcept
+{
+  return static_cast<float_t>( 0.5L - detail::constexpr_cos( t * half_pi<long double>() ) * 0.5L );
+}
+
+inline constexpr bit::math::float_t
+  bit::math::half_cosine_curve::max_second_derivative()
+  noexcept
+{
+  return pi<float_t>() * pi<float_t>() / 8;
+}
+
+//----------------------------------------------------------------------------
+
+inline constexpr bit::math::float_t
+  bit::math::cosine_curve::operator()( float_t t )
+  const noexcept
+{
+  return static_cast<float_t>( 1.0L - detail::constexpr_cos( t * pi<long double>() ) );
+}
+
+inline constexpr bit::math::float_t
+  bit::math::cosine_curve::max_second_derivative()
+  noexcept
+{
+  return pi<float_t>() * pi<float_t>();
+}
+
+//----------------------------------------------------------------------------
+
+inline constexpr bit::math::float_t
+  bit::math::half_sine_curve::operator()( float_t t )
+  const noexcept
+{
+  return static_cast<float_t>( 0.5L - detail::constexpr_sin( t * half_pi<long double>() ) * 0.5L );
+}
+
+inline constexpr bit::math::float_t
+  bit::math::half_sine_curve::max_second_derivative()
+  noexcept
+{
+  return pi<float_t>() * pi<float_t>() / 8;
+}
+
+//----------------------------------------------------------------------------
+
+inline constexpr bit::math::float_t
+  bit::math::sine_curve::operator()( float_t t )
+  const noexcept
+{
+  return static_cast<float_t>( 1.0L - detail::constexpr_sin( t * pi<long double>() ) );
+}
+
+inline constexpr bit::math::float_t
+  bit::math::sine_curve::max_second_derivative()
+  noexcept
+{
+  return pi<float_t>() * pi<float_t>();
+}
+
+//============================================================================
+// easing_table<N>
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Constructors
+//----------------------------------------------------------------------------
+
+template<std::size_t N>
+template<typename Curve>
+inline constexpr bit::math::easing_table<N>::easing_table( Curve curve )
+  noexcept
+  : m_samples{}
+{
+  for( auto i = size_type{0}; i < N; ++i ) {
+    m_samples[i] = curve( static_cast<float_t>(i) / static_cast<float_t>(N - 1) );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Observers
+//----------------------------------------------------------------------------
+
+template<std::size_t N>
+inline constexpr typename bit::math::easing_table<N>::size_type
+  bit::math::easing_table<N>::size()
+  noexcept
+{
+  return N;
+}
+
+template<std::size_t N>
+inline constexpr bit::math::float_t
+  bit::math::easing_table<N>::error_bound( float_t max_second_derivative )
+  noexcept
+{
+  // The error of linearly interpolating f over an interval of width h is
+  // at most h^2/8 * max|f''|
+  constexpr auto h = float_t(1) / static_cast<float_t>(N - 1);
+
+  return max_second_derivative * h * h / 8;
+}
+
+template<std::size_t N>
+inline constexpr bit::math::float_t
+  bit::math::easing_table<N>::operator[]( size_type n )
+  const noexcept
+{
+  return m_samples[n];
+}
+
+//----------------------------------------------------------------------------
+// Evaluation
+//----------------------------------------------------------------------------
+
+template<std::size_t N>
+inline constexpr bit::math::float_t
+  bit::math::easing_table<N>::operator()( float_t t )
+  const noexcept
+{
+  // Also maps NaN to the first sample
+  if( !(t > float_t(0)) ) return m_samples[0];
+  if( t >= float_t(1) ) return m_samples[N - 1];
+
+  // The product may round up to N-1 for t just below 1
+  const auto position = t * static_cast<float_t>(N - 1);
+  const auto index    = std::min( static_cast<size_type>(position), N - 2 );
+  const auto fraction = position - static_cast<float_t>(index);
+
+  return linear( m_samples[index], m_samples[index + 1], fraction );
+}
+
+template<std::size_t N>
+inline void bit::math::easing_table<N>::operator()( const float_t* t,
+                                                    float_t* out,
+                                                    size_type n )
+  const noexcept
+{
+  for( auto i = size_type{0}; i < n; ++i ) {
+    out[i] = (*this)( t[i] );
+  }
+}
+
+template<std::size_t N>
+template<typename V0, typename V1>
+inline constexpr std::common_type_t<V0,V1,bit::math::float_t>
+  bit::math::easing_table<N>::interpolate( const V0& v0,
+                                           const V1& v1,
+                                           float_t t )
+  const noexcept
+{
+  return linear( v0, v1, (*this)( t ) );
+}
+
+//============================================================================
+// Generation
+//============================================================================
+
+template<std::size_t N, typename Curve>
+inline constexpr bit::math::easing_table<N>
+  bit::math::make_easing_table( Curve curve )
+  noexcept
+{
+  return easing_table<N>{ curve };
+}
+
+#endif /* BIT_MATH_DETAIL_EASING_TABLE_INL */
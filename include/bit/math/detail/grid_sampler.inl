@@ -0,0 +1,384 @@
+#ifndef BIT_MATH_DETAIL_GRID_SAMPLER_INL
+#define BIT_MATH_DETAIL_GRID_SAMPLER_INL
+
+#ifndef BIT_MATH_GRID_SAMPLER_HPP
+# error "grid_sampler.inl included without first including declaration header grid_sampler.hpp"
+#endif
+
+//============================================================================
+// detail
+//============================================================================
+
+inline std::size_t bit::math::detail::address_texel( std::ptrdiff_t i,
+                                                     std::size_t size,
+                                                     grid_address address )
+  noexcept
+{
+  const auto n = static_cast<std::ptrdiff_t>(size);
+
+  switch( address ) {
+  case grid_address::clamp:
+    return static_cast<std::size_t>( i < 0 ? 0 : (i < n ? i : n - 1) );
+  case grid_address::wrap:
+    {
+      const auto m = i % n;
+      return static_cast<std::size_t>( m < 0 ? m + n : m );
+    }
+  case grid_address::mirror:
+    {
+      // Mirroring repeats every 2n texels: 0, 1, ..., n-1, n-1, ..., 1, 0
+      const auto period = 2 * n;
+      auto m = i % period;
+      if( m < 0 ) m += period;
+      return static_cast<std::size_t>( m < n ? m : period - 1 - m );
+    }
+  }
+  return 0;
+}
+
+//============================================================================
+// grid_sampler_2d<T>
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Constructors
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline bit::math::grid_sampler_2d<T>::grid_sampler_2d( const T* texels,
+                                                       size_type width,
+                                                       size_type height,
+                                                       size_type row_stride,
+                                                       grid_address address )
+  noexcept
+  : m_texels{texels},
+    m_width{width},
+    m_height{height},
+    m_row_stride{row_stride},
+    m_address{address}
+{
+  assert( texels != nullptr );
+  assert( width > 0 && height > 0 && "grid must not be empty" );
+  assert( row_stride >= width );
+}
+
+//----------------------------------------------------------------------------
+// Observers
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline const T* bit::math::grid_sampler_2d<T>::texels()
+  const noexcept
+{
+  return m_texels;
+}
+
+template<typename T>
+inline typename bit::math::grid_sampler_2d<T>::size_type
+  bit::math::grid_sampler_2d<T>::width()
+  const noexcept
+{
+  return m_width;
+}
+
+template<typename T>
+inline typename bit::math::grid_sampler_2d<T>::size_type
+  bit::math::grid_sampler_2d<T>::height()
+  const noexcept
+{
+  return m_height;
+}
+
+template<typename T>
+inline typename bit::math::grid_sampler_2d<T>::size_type
+  bit::math::grid_sampler_2d<T>::row_stride()
+  const noexcept
+{
+  return m_row_stride;
+}
+
+template<typename T>
+inline bit::math::grid_address bit::math::grid_sampler_2d<T>::address()
+  const noexcept
+{
+  return m_address;
+}
+
+//----------------------------------------------------------------------------
+// Sampling
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline bit::math::float_t
+  bit::math::grid_sampler_2d<T>::fetch( std::ptrdiff_t x, std::ptrdiff_t y )
+  const noexcept
+{
+  const auto column = detail::address_texel( x, m_width, m_address );
+  const auto row    = detail::address_texel( y, m_height, m_address );
+
+  return static_cast<float_t>( m_texels[row * m_row_stride + column] );
+}
+
+template<typename T>
+inline bit::math::float_t
+  bit::math::grid_sampler_2d<T>::sample( float_t x, float_t y )
+  const noexcept
+{
+  const auto fx = std::floor(x);
+  const auto fy = std::floor(y);
+  const auto ix = static_cast<std::ptrdiff_t>(fx);
+  const auto iy = static_cast<std::ptrdiff_t>(fy);
+
+  const auto x0 = detail::address_texel( ix, m_width, m_address );
+  const auto x1 = detail::address_texel( ix + 1, m_width, m_address );
+  const auto row0 = m_texels + detail::address_texel( iy, m_height, m_address ) * m_row_stride;
+  const auto row1 = m_texels + detail::address_texel( iy + 1, m_height, m_address ) * m_row_stride;
+
+  return bilinear( static_cast<float_t>(row0[x0]), static_cast<float_t>(row0[x1]),
+                   static_cast<float_t>(row1[x0]), static_cast<float_t>(row1[x1]),
+                   x - fx, y - fy );
+}
+
+template<typename T>
+inline bit::math::float_t
+  bit::math::grid_sampler_2d<T>::sample( const vec2& p )
+  const noexcept
+{
+  return sample( p.x(), p.y() );
+}
+
+template<typename T>
+inline void bit::math::grid_sampler_2d<T>::sample( const float_t* x,
+                                                   const float_t* y,
+                                                   float_t* out,
+                                                   size_type n )
+  const noexcept
+{
+  assert( (x != nullptr && y != nullptr && out != nullptr) || n == 0 );
+
+  constexpr auto chunk = detail::grid_sampler_chunk;
+
+  int x0[chunk], x1[chunk], y0[chunk], y1[chunk];
+  float_t tx[chunk], ty[chunk];
+  float_t v00[chunk], v10[chunk], v01[chunk], v11[chunk];
+
+  for( auto i = size_type{0}; i < n; i += chunk ) {
+    const auto count = std::min( chunk, n - i );
+
+    detail::address_texels( x + i, count, m_width, m_address, x0, x1, tx );
+    detail::address_texels( y + i, count, m_height, m_address, y0, y1, ty );
+
+    // Only the fetches are scalar; the texel type is arbitrary and the
+    // indices are only known after addressing
+    for( auto j = size_type{0}; j < count; ++j ) {
+      const auto row0 = m_texels + static_cast<size_type>(y0[j]) * m_row_stride;
+      const auto row1 = m_texels + static_cast<size_type>(y1[j]) * m_row_stride;
+
+      v00[j] = static_cast<float_t>( row0[x0[j]] );
+      v10[j] = static_cast<float_t>( row0[x1[j]] );
+      v01[j] = static_cast<float_t>( row1[x0[j]] );
+      v11[j] = static_cast<float_t>( row1[x1[j]] );
+    }
+
+    // Blends in the same order as bilinear
+    linear( v00, v10, tx, v00, count );
+    linear( v01, v11, tx, v01, count );
+    linear( v00, v01, ty, out + i, count );
+  }
+}
+
+//============================================================================
+// grid_sampler_3d<T>
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Constructors
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline bit::math::grid_sampler_3d<T>::grid_sampler_3d( const T* texels,
+                                                       size_type width,
+                                                       size_type height,
+                                                       size_type depth,
+                                                       size_type row_stride,
+                                                       size_type slice_stride,
+                                                       grid_address address )
+  noexcept
+  : m_texels{texels},
+    m_width{width},
+    m_height{height},
+    m_depth{depth},
+    m_row_stride{row_stride},
+    m_slice_stride{slice_stride},
+    m_address{address}
+{
+  assert( texels != nullptr );
+  assert( width > 0 && height > 0 && depth > 0 && "grid must not be empty" );
+  assert( row_stride >= width );
+  assert( slice_stride >= row_stride * height );
+}
+
+//----------------------------------------------------------------------------
+// Observers
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline const T* bit::math::grid_sampler_3d<T>::texels()
+  const noexcept
+{
+  return m_texels;
+}
+
+template<typename T>
+inline typename bit::math::grid_sampler_3d<T>::size_type
+  bit::math::grid_sampler_3d<T>::width()
+  const noexcept
+{
+  return m_width;
+}
+
+template<typename T>
+inline typename bit::math::grid_sampler_3d<T>::size_type
+  bit::math::grid_sampler_3d<T>::height()
+  const noexcept
+{
+  return m_height;
+}
+
+template<typename T>
+inline typename bit::math::grid_sampler_3d<T>::size_type
+  bit::math::grid_sampler_3d<T>::depth()
+  const noexcept
+{
+  return m_depth;
+}
+
+template<typename T>
+inline typename bit::math::grid_sampler_3d<T>::size_type
+  bit::math::grid_sampler_3d<T>::row_stride()
+  const noexcept
+{
+  return m_row_stride;
+}
+
+template<typename T>
+inline typename bit::math::grid_sampler_3d<T>::size_type
+  bit::math::grid_sampler_3d<T>::slice_stride()
+  const noexcept
+{
+  return m_slice_stride;
+}
+
+template<typename T>
+inline bit::math::grid_address bit::math::grid_sampler_3d<T>::address()
+  const noexcept
+{
+  return m_address;
+}
+
+//----------------------------------------------------------------------------
+// Sampling
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline bit::math::float_t
+  bit::math::grid_sampler_3d<T>::fetch( std::ptrdiff_t x,
+                                        std::ptrdiff_t y,
+                                        std::ptrdiff_t z )
+  const noexcept
+{
+  const auto column = detail::address_texel( x, m_width, m_address );
+  const auto row    = detail::address_texel( y, m_height, m_address );
+  const auto slice  = detail::address_texel( z, m_depth, m_address );
+
+  return static_cast<float_t>( m_texels[slice * m_slice_stride + row * m_row_stride + column] );
+}
+
+template<typename T>
+inline bit::math::float_t
+  bit::math::grid_sampler_3d<T>::sample( float_t x, float_t y, float_t z )
+  const noexcept
+{
+  const auto fx = std::floor(x);
+  const auto fy = std::floor(y);
+  const auto fz = std::floor(z);
+  const auto ix = static_cast<std::ptrdiff_t>(fx);
+  const auto iy = static_cast<std::ptrdiff_t>(fy);
+  const auto iz = static_cast<std::ptrdiff_t>(fz);
+
+  const auto x0 = detail::address_texel( ix, m_width, m_address );
+  const auto x1 = detail::address_texel( ix + 1, m_width, m_address );
+  const auto y0 = detail::address_texel( iy, m_height, m_address ) * m_row_stride;
+  const auto y1 = detail::address_texel( iy + 1, m_height, m_address ) * m_row_stride;
+  const auto slice0 = m_texels + detail::address_texel( iz, m_depth, m_address ) * m_slice_stride;
+  const auto slice1 = m_texels + detail::address_texel( iz + 1, m_depth, m_address ) * m_slice_stride;
+
+  return trilinear( static_cast<float_t>(slice0[y0 + x0]), static_cast<float_t>(slice0[y0 + x1]),
+                    static_cast<float_t>(slice0[y1 + x0]), static_cast<float_t>(slice0[y1 + x1]),
+                    static_cast<float_t>(slice1[y0 + x0]), static_cast<float_t>(slice1[y0 + x1]),
+                    static_cast<float_t>(slice1[y1 + x0]), static_cast<float_t>(slice1[y1 + x1]),
+                    x - fx, y - fy, z - fz );
+}
+
+template<typename T>
+inline bit::math::float_t
+  bit::math::grid_sampler_3d<T>::sample( const vec3& p )
+  const noexcept
+{
+  return sample( p.x(), p.y(), p.z() );
+}
+
+template<typename T>
+inline void bit::math::grid_sampler_3d<T>::sample( const float_t* x,
+                                                   const float_t* y,
+                                                   const float_t* z,
+                                                   float_t* out,
+                                                   size_type n )
+  const noexcept
+{
+  assert( (x != nullptr && y != nullptr && z != nullptr && out != nullptr) || n == 0 );
+
+  constexpr auto chunk = detail::grid_sampler_chunk;
+
+  int x0[chunk], x1[chunk], y0[chunk], y1[chunk], z0[chunk], z1[chunk];
+  float_t tx[chunk], ty[chunk], tz[chunk];
+  float_t v000[chunk], v100[chunk], v010[chunk], v110[chunk];
+  float_t v001[chunk], v101[chunk], v011[chunk], v111[chunk];
+
+  for( auto i = size_type{0}; i < n; i += chunk ) {
+    const auto count = std::min( chunk, n - i );
+
+    detail::address_texels( x + i, count, m_width, m_address, x0, x1, tx );
+    detail::address_texels( y + i, count, m_height, m_address, y0, y1, ty );
+    detail::address_texels( z + i, count, m_depth, m_address, z0, z1, tz );
+
+    // Only the fetches are scalar; the texel type is arbitrary and the
+    // indices are only known after addressing
+    for( auto j = size_type{0}; j < count; ++j ) {
+      const auto slice0 = m_texels + static_cast<size_type>(z0[j]) * m_slice_stride;
+      const auto slice1 = m_texels + static_cast<size_type>(z1[j]) * m_slice_stride;
+      const auto row0   = static_cast<size_type>(y0[j]) * m_row_stride;
+      const auto row1   = static_cast<size_type>(y1[j]) * m_row_stride;
+
+      v000[j] = static_cast<float_t>( slice0[row0 + x0[j]] );
+      v100[j] = static_cast<float_t>( slice0[row0 + x1[j]] );
+      v010[j] = static_cast<float_t>( slice0[row1 + x0[j]] );
+      v110[j] = static_cast<float_t>( slice0[row1 + x1[j]] );
+      v001[j] = static_cast<float_t>( slice1[row0 + x0[j]] );
+      v101[j] = static_cast<float_t>( slice1[row0 + x1[j]] );
+      v011[j] = static_cast<float_t>( slice1[row1 + x0[j]] );
+      v111[j] = static_cast<float_t>( slice1[row1 + x1[j]] );
+    }
+
+    // Blends in the same order as trilinear
+    linear( v000, v100, tx, v000, count );
+    linear( v010, v110, tx, v010, count );
+    linear( v001, v101, tx, v001, count );
+    linear( v011, v111, tx, v011, count );
+    linear( v000, v010, ty, v000, count );
+    linear( v001, v011, ty, v001, count );
+    linear( v000, v001, tz, out + i, count );
+  }
+}
+
+#endif /* BIT_MATH_DETAIL_GRID_SAMPLER_INL */
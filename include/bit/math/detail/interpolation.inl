@@ -36,7 +36,7 @@ inline constexpr std::common_type_t<V0,V1,T>
 
 template<typename V0, typename V1, typename T>
 inline constexpr std::common_type_t<V0,V1,T>
-  bit::math::cubic( const V0& v0, const V0& v1, const T& t )
+  bit::math::cubic( const V0& v0, const V1& v1, const T& t )
   noexcept
 {
   return linear(v0,v1,t*t*t);
@@ -45,7 +45,7 @@ inline constexpr std::common_type_t<V0,V1,T>
 
 template<typename V0, typename V1, typename T>
 inline constexpr std::common_type_t<V0,V1,T>
-  bit::math::quartic( const V0& v0, const V0& v1, const T& t )
+  bit::math::quartic( const V0& v0, const V1& v1, const T& t )
   noexcept
 {
   return linear(v0,v1,t*t*t*t);
@@ -54,7 +54,7 @@ inline constexpr std::common_type_t<V0,V1,T>
 
 template<typename V0, typename V1, typename T>
 inline constexpr std::common_type_t<V0,V1,T>
-  bit::math::quintic( const V0& v0, const V0& v1, const T& t )
+  bit::math::quintic( const V0& v0, const V1& v1, const T& t )
   noexcept
 {
   return linear(v0,v1,t*t*t*t*t);
@@ -64,7 +64,7 @@ inline constexpr std::common_type_t<V0,V1,T>
 
 template<typename V0, typename V1, typename T>
 inline std::common_type_t<V0,V1,T>
-  bit::math::circular( const V0& v0, const V0& v1, const T& t )
+  bit::math::circular( const V0& v0, const V1& v1, const T& t )
   noexcept
 {
   return linear(v0, v1, (1.0 - sqrt(1.0 - (t*t))));
@@ -74,7 +74,7 @@ inline std::common_type_t<V0,V1,T>
 
 template<typename V0, typename V1, typename T>
 inline std::common_type_t<V0,V1,T>
-  bit::math::half_cosine( const V0& v0, const V0& v1, const T& t )
+  bit::math::half_cosine( const V0& v0, const V1& v1, const T& t )
   noexcept
 {
   return linear(v0, v1, (0.5 - cos(t * half_pi<std::common_type_t<V0,V1,T>>())*0.5));
@@ -83,7 +83,7 @@ inline std::common_type_t<V0,V1,T>
 
 template<typename V0, typename V1, typename T>
 inline std::common_type_t<V0,V1,T>
-  bit::math::cosine( const V0& v0, const V0& v1, const T& t )
+  bit::math::cosine( const V0& v0, const V1& v1, const T& t )
   noexcept
 {
   return linear(v0, v1, (1.0 - cos(t * pi<std::common_type_t<V0,V1,T>>())));
@@ -93,7 +93,7 @@ inline std::common_type_t<V0,V1,T>
 
 template<typename V0, typename V1, typename T>
 inline std::common_type_t<V0,V1,T>
-  bit::math::half_sine( const V0& v0, const V0& v1, const T& t )
+  bit::math::half_sine( const V0& v0, const V1& v1, const T& t )
   noexcept
 {
   return linear(v0, v1, (0.5 - sin(t * half_pi<std::common_type_t<V0,V1,T>>())*0.5));
@@ -102,7 +102,7 @@ inline std::common_type_t<V0,V1,T>
 
 template<typename V0, typename V1, typename T>
 inline std::common_type_t<V0,V1,T>
-  bit::math::sine( const V0& v0, const V0& v1, const T& t )
+  bit::math::sine( const V0& v0, const V1& v1, const T& t )
   noexcept
 {
   return linear(v0, v1, (1.0 - sin(t * pi<std::common_type_t<V0,V1,T>>())));
@@ -130,4 +130,176 @@ inline constexpr std::common_type_t<V000,V100,V010,V110,V001,V101,V011,V111>
   return linear( bilinear(v000,v100,v010,v110,tx,ty), bilinear(v001, v101, v011, v111, tx, ty), tz );
 }
 
+//----------------------------------------------------------------------------
+// Batch Interpolation
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline void bit::math::linear( const T* v0, const T* v1, const float_t* t,
+                               T* out, std::size_t n )
+  noexcept
+{
+  interpolate_batch( detail::easing::linear, v0, v1, t, out, n );
+}
+
+template<typename T>
+inline void bit::math::linear( const T* v0, const T* v1, float_t t,
+                               T* out, std::size_t n )
+  noexcept
+{
+  interpolate_batch( detail::easing::linear, v0, v1, t, out, n );
+}
+
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline void bit::math::quadratic( const T* v0, const T* v1, const float_t* t,
+                                  T* out, std::size_t n )
+  noexcept
+{
+  interpolate_batch( detail::easing::quadratic, v0, v1, t, out, n );
+}
+
+template<typename T>
+inline void bit::math::quadratic( const T* v0, const T* v1, float_t t,
+                                  T* out, std::size_t n )
+  noexcept
+{
+  interpolate_batch( detail::easing::quadratic, v0, v1, t, out, n );
+}
+
+template<typename T>
+inline void bit::math::cubic( const T* v0, const T* v1, const float_t* t,
+                              T* out, std::size_t n )
+  noexcept
+{
+  interpolate_batch( detail::easing::cubic, v0, v1, t, out, n );
+}
+
+template<typename T>
+inline void bit::math::cubic( const T* v0, const T* v1, float_t t,
+                              T* out, std::size_t n )
+  noexcept
+{
+  interpolate_batch( detail::easing::cubic, v0, v1, t, out, n );
+}
+
+template<typename T>
+inline void bit::math::quartic( const T* v0, const T* v1, const float_t* t,
+                                T* out, std::size_t n )
+  noexcept
+{
+  interpolate_batch( detail::easing::quartic, v0, v1, t, out, n );
+}
+
+template<typename T>
+inline void bit::math::quartic( const T* v0, const T* v1, float_t t,
+                                T* out, std::size_t n )
+  noexcept
+{
+  interpolate_batch( detail::easing::quartic, v0, v1, t, out, n );
+}
+
+template<typename T>
+inline void bit::math::quintic( const T* v0, const T* v1, const float_t* t,
+                                T* out, std::size_t n )
+  noexcept
+{
+  interpolate_batch( detail::easing::quintic, v0, v1, t, out, n );
+}
+
+template<typename T>
+inline void bit::math::quintic( const T* v0, const T* v1, float_t t,
+                                T* out, std::size_t n )
+  noexcept
+{
+  interpolate_batch( detail::easing::quintic, v0, v1, t, out, n );
+}
+
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline void bit::math::circular( const T* v0, const T* v1, const float_t* t,
+                                 T* out, std::size_t n )
+  noexcept
+{
+  interpolate_batch( detail::easing::circular, v0, v1, t, out, n );
+}
+
+template<typename T>
+inline void bit::math::circular( const T* v0, const T* v1, float_t t,
+                                 T* out, std::size_t n )
+  noexcept
+{
+  interpolate_batch( detail::easing::circular, v0, v1, t, out, n );
+}
+
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline void bit::math::half_cosine( const T* v0, const T* v1, const float_t* t,
+                                    T* out, std::size_t n )
+  noexcept
+{
+  interpolate_batch( detail::easing::half_cosine, v0, v1, t, out, n );
+}
+
+template<typename T>
+inline void bit::math::half_cosine( const T* v0, const T* v1, float_t t,
+                                    T* out, std::size_t n )
+  noexcept
+{
+  interpolate_batch( detail::easing::half_cosine, v0, v1, t, out, n );
+}
+
+template<typename T>
+inline void bit::math::cosine( const T* v0, const T* v1, const float_t* t,
+                               T* out, std::size_t n )
+  noexcept
+{
+  interpolate_batch( detail::easing::cosine, v0, v1, t, out, n );
+}
+
+template<typename T>
+inline void bit::math::cosine( const T* v0, const T* v1, float_t t,
+                               T* out, std::size_t n )
+  noexcept
+{
+  interpolate_batch( detail::easing::cosine, v0, v1, t, out, n );
+}
+
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline void bit::math::half_sine( const T* v0, const T* v1, const float_t* t,
+                                  T* out, std::size_t n )
+  noexcept
+{
+  interpolate_batch( detail::easing::half_sine, v0, v1, t, out, n );
+}
+
+template<typename T>
+inline void bit::math::half_sine( const T* v0, const T* v1, float_t t,
+                                  T* out, std::size_t n )
+  noexcept
+{
+  interpolate_batch( detail::easing::half_sine, v0, v1, t, out, n );
+}
+
+template<typename T>
+inline void bit::math::sine( const T* v0, const T* v1, const float_t* t,
+                             T* out, std::size_t n )
+  noexcept
+{
+  interpolate_batch( detail::easing::sine, v0, v1, t, out, n );
+}
+
+template<typename T>
+inline void bit::math::sine( const T* v0, const T* v1, float_t t,
+                             T* out, std::size_t n )
+  noexcept
+{
+  interpolate_batch( detail::easing::sine, v0, v1, t, out, n );
+}
+
 #endif /* BIT_MATH_DETAIL_INTERPOLATION_INL */
@@ -0,0 +1,270 @@
+#ifndef BIT_MATH_DETAIL_KEYFRAME_TRACK_INL
+#define BIT_MATH_DETAIL_KEYFRAME_TRACK_INL
+
+#ifndef BIT_MATH_KEYFRAME_TRACK_HPP
+# error "keyframe_track.inl included without first including declaration header keyframe_track.hpp"
+#endif
+
+//============================================================================
+// keyframe_cursor
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Constructors
+//----------------------------------------------------------------------------
+
+inline constexpr bit::math::keyframe_cursor::keyframe_cursor()
+  noexcept
+  : m_segment{0}
+{
+
+}
+
+//----------------------------------------------------------------------------
+// Observers
+//----------------------------------------------------------------------------
+
+inline constexpr std::size_t bit::math::keyframe_cursor::segment()
+  const noexcept
+{
+  return m_segment;
+}
+
+//----------------------------------------------------------------------------
+// Modifiers
+//----------------------------------------------------------------------------
+
+inline void bit::math::keyframe_cursor::reset()
+  noexcept
+{
+  m_segment = 0;
+}
+
+//============================================================================
+// keyframe_track<T>
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Modifiers
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline void bit::math::keyframe_track<T>::reserve( size_type n )
+{
+  m_times.reserve( n );
+  m_values.reserve( n );
+  m_interpolations.reserve( n );
+}
+
+template<typename T>
+inline void bit::math::keyframe_track<T>::add_key( float_t time,
+                                                   const T& value,
+                                                   keyframe_interpolation interpolation )
+{
+  assert( (m_times.empty() || time > m_times.back()) && "keys must be added in order" );
+
+  m_times.push_back( time );
+  m_values.push_back( value );
+  m_interpolations.push_back( interpolation );
+}
+
+template<typename T>
+inline void bit::math::keyframe_track<T>::clear()
+  noexcept
+{
+  m_times.clear();
+  m_values.clear();
+  m_interpolations.clear();
+}
+
+//----------------------------------------------------------------------------
+// Observers
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline typename bit::math::keyframe_track<T>::size_type
+  bit::math::keyframe_track<T>::size()
+  const noexcept
+{
+  return m_times.size();
+}
+
+template<typename T>
+inline bool bit::math::keyframe_track<T>::empty()
+  const noexcept
+{
+  return m_times.empty();
+}
+
+template<typename T>
+inline const bit::math::float_t* bit::math::keyframe_track<T>::times()
+  const noexcept
+{
+  return m_times.data();
+}
+
+template<typename T>
+inline const T* bit::math::keyframe_track<T>::values()
+  const noexcept
+{
+  return m_values.data();
+}
+
+template<typename T>
+inline bit::math::keyframe_interpolation
+  bit::math::keyframe_track<T>::interpolation( size_type n )
+  const noexcept
+{
+  assert( n < size() && "index out of range" );
+
+  return m_interpolations[n];
+}
+
+//----------------------------------------------------------------------------
+// Sampling
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline typename bit::math::keyframe_track<T>::size_type
+  bit::math::keyframe_track<T>::find_segment( float_t time )
+  const noexcept
+{
+  if( size() < 2 ) return 0;
+
+  // The last segment starts at the second-to-last key
+  const auto first = m_times.begin() + 1;
+  const auto last  = m_times.end() - 1;
+
+  return static_cast<size_type>( std::upper_bound( first, last, time ) - first );
+}
+
+template<typename T>
+inline typename bit::math::keyframe_track<T>::size_type
+  bit::math::keyframe_track<T>::find_segment( float_t time,
+                                              keyframe_cursor& cursor )
+  const noexcept
+{
+  // The number of keys stepped over before giving up on a linear scan
+  constexpr size_type max_steps = 4;
+
+  if( size() < 2 ) return (cursor.m_segment = 0);
+
+  const auto last_segment = size() - 2;
+
+  auto segment = cursor.m_segment;
+
+  // Time went backwards, or the track changed since the cursor was used
+  if( segment > last_segment || time < m_times[segment] ) {
+    return (cursor.m_segment = find_segment( time ));
+  }
+
+  // Time went forwards; the next segment is usually at most a few keys away
+  for( auto step = size_type{0}; step < max_steps; ++step ) {
+    if( segment == last_segment || time < m_times[segment + 1] ) {
+      return (cursor.m_segment = segment);
+    }
+    ++segment;
+  }
+
+  // Search only the keys after the cursor
+  const auto first = m_times.begin() + 1;
+  const auto last  = m_times.end() - 1;
+  const auto it    = std::upper_bound( first + segment, last, time );
+
+  return (cursor.m_segment = static_cast<size_type>( it - first ));
+}
+
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline T bit::math::keyframe_track<T>::sample( float_t time )
+  const noexcept
+{
+  assert( !empty() && "cannot sample an empty track" );
+
+  return sample_segment( find_segment( time ), time );
+}
+
+template<typename T>
+inline T bit::math::keyframe_track<T>::sample( float_t time,
+                                               keyframe_cursor& cursor )
+  const noexcept
+{
+  assert( !empty() && "cannot sample an empty track" );
+
+  return sample_segment( find_segment( time, cursor ), time );
+}
+
+template<typename T>
+inline void bit::math::keyframe_track<T>::sample( const float_t* times,
+                                                  T* out,
+                                                  size_type n )
+  const noexcept
+{
+  assert( !empty() && "cannot sample an empty track" );
+  assert( (times != nullptr && out != nullptr) || n == 0 );
+
+  auto cursor = keyframe_cursor{};
+  for( auto i = size_type{0}; i < n; ++i ) {
+    out[i] = sample_segment( find_segment( times[i], cursor ), times[i] );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Private Member Functions
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline T bit::math::keyframe_track<T>::sample_segment( size_type segment,
+                                                       float_t time )
+  const noexcept
+{
+  if( size() == 1 ) return m_values[0];
+
+  const auto t0 = m_times[segment];
+  const auto t1 = m_times[segment + 1];
+
+  // Clamp samples outside of the track
+  if( time <= t0 ) return m_values[segment];
+  if( time >= t1 ) return m_values[segment + 1];
+
+  const auto t = (time - t0) / (t1 - t0);
+
+  // The interpolation functions are evaluated on the weight alone, so that
+  // T only needs to support scaling and addition
+  auto weight = t;
+  switch( m_interpolations[segment] ) {
+  case keyframe_interpolation::linear:
+    weight = linear( float_t(0), float_t(1), t );
+    break;
+  case keyframe_interpolation::cubic:
+    weight = cubic( float_t(0), float_t(1), t );
+    break;
+  case keyframe_interpolation::quintic:
+    weight = quintic( float_t(0), float_t(1), t );
+    break;
+  }
+
+  return m_values[segment] * (float_t(1) - weight) + m_values[segment + 1] * weight;
+}
+
+//============================================================================
+// Batch Sampling
+//============================================================================
+
+template<typename T>
+inline void bit::math::sample_tracks( const keyframe_track<T>* tracks,
+                                      keyframe_cursor* cursors,
+                                      float_t time,
+                                      T* out,
+                                      std::size_t n )
+  noexcept
+{
+  assert( (tracks != nullptr && cursors != nullptr && out != nullptr) || n == 0 );
+
+  for( auto i = std::size_t{0}; i < n; ++i ) {
+    out[i] = tracks[i].sample( time, cursors[i] );
+  }
+}
+
+#endif /* BIT_MATH_DETAIL_KEYFRAME_TRACK_INL */
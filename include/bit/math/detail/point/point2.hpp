@@ -187,7 +187,7 @@ namespace bit {
     ///
     /// \param lhs the left point2 to swap
     /// \param rhs the right point2 to swap
-    constexpr void swap( point2& lhs, point2& rhs ) noexcept;
+    void swap( point2& lhs, point2& rhs ) noexcept;
 
     /// \{
     /// \brief Performs the dot product between \p lhs and \p rhs
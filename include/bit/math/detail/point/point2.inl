@@ -106,7 +106,7 @@ inline void bit::math::point2::swap( point2& other )
 // Free Operators
 //----------------------------------------------------------------------------
 
-inline bit::math::vector2<float_t>
+inline bit::math::vector2<bit::math::float_t>
   bit::math::operator - ( const point2& lhs, const point2& rhs )
   noexcept
 {
@@ -133,7 +133,7 @@ inline bit::math::point2
 // Free Functions
 //------------------------------------------------------------------------
 
-inline constexpr void  bit::math::swap( point2& lhs, point2& rhs )
+inline void bit::math::swap( point2& lhs, point2& rhs )
   noexcept
 {
   lhs.swap(rhs);
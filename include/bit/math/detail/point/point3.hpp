@@ -195,7 +195,7 @@ namespace bit {
     ///
     /// \param lhs the left point3 to swap
     /// \param rhs the right point3 to swap
-    constexpr void swap( point3& lhs, point3& rhs ) noexcept;
+    void swap( point3& lhs, point3& rhs ) noexcept;
 
     /// \{
     /// \brief Performs the dot product between \p lhs and \p rhs
@@ -39,7 +39,7 @@ bit::math::point3& bit::math::point3::operator-=( const vector3<T>& rhs )
   noexcept
 {
   for( auto i=0; i<3; ++i ) {
-    m_data[i] += rhs[i];
+    m_data[i] -= rhs[i];
   }
   return (*this);
 }
@@ -142,7 +142,7 @@ inline constexpr bit::math::float_t bit::math::dot( const point3& lhs,
 // Free Operators
 //----------------------------------------------------------------------------
 
-inline bit::math::vector3<float_t>
+inline bit::math::vector3<bit::math::float_t>
   bit::math::operator - ( const point3& lhs, const point3& rhs )
   noexcept
 {
@@ -169,7 +169,7 @@ inline bit::math::point3
 // Free Functions
 //------------------------------------------------------------------------
 
-inline constexpr void  bit::math::swap( point3& lhs, point3& rhs )
+inline void bit::math::swap( point3& lhs, point3& rhs )
   noexcept
 {
   lhs.swap(rhs);
@@ -0,0 +1,300 @@
+#ifndef BIT_MATH_DETAIL_SPLINE_INL
+#define BIT_MATH_DETAIL_SPLINE_INL
+
+#ifndef BIT_MATH_SPLINE_HPP
+# error "spline.inl included without first including declaration header spline.hpp"
+#endif
+
+//----------------------------------------------------------------------------
+// Cubic Segments
+//----------------------------------------------------------------------------
+
+template<typename V, typename T>
+inline constexpr V bit::math::catmull_rom( const V& p0, const V& p1,
+                                           const V& p2, const V& p3, T t )
+  noexcept
+{
+  const auto t2 = t * t;
+  const auto t3 = t2 * t;
+
+  const auto w0 = (-t3 + T(2) * t2 - t) * T(0.5);
+  const auto w1 = (T(3) * t3 - T(5) * t2 + T(2)) * T(0.5);
+  const auto w2 = (T(-3) * t3 + T(4) * t2 + t) * T(0.5);
+  const auto w3 = (t3 - t2) * T(0.5);
+
+  return static_cast<V>( p0 * w0 + p1 * w1 + p2 * w2 + p3 * w3 );
+}
+
+template<typename V, typename T>
+inline constexpr V bit::math::bezier( const V& p0, const V& p1,
+                                      const V& p2, const V& p3, T t )
+  noexcept
+{
+  const auto s = T(1) - t;
+
+  const auto w0 = s * s * s;
+  const auto w1 = T(3) * s * s * t;
+  const auto w2 = T(3) * s * t * t;
+  const auto w3 = t * t * t;
+
+  return static_cast<V>( p0 * w0 + p1 * w1 + p2 * w2 + p3 * w3 );
+}
+
+template<typename V, typename T>
+inline constexpr V bit::math::hermite( const V& p0, const V& m0,
+                                       const V& p1, const V& m1, T t )
+  noexcept
+{
+  const auto t2 = t * t;
+  const auto t3 = t2 * t;
+
+  const auto h00 = T(2) * t3 - T(3) * t2 + T(1);
+  const auto h10 = t3 - T(2) * t2 + t;
+  const auto h01 = T(-2) * t3 + T(3) * t2;
+  const auto h11 = t3 - t2;
+
+  return static_cast<V>( p0 * h00 + m0 * h10 + p1 * h01 + m1 * h11 );
+}
+
+template<typename V, typename T>
+inline constexpr V bit::math::bspline( const V& p0, const V& p1,
+                                       const V& p2, const V& p3, T t )
+  noexcept
+{
+  const auto s  = T(1) - t;
+  const auto t2 = t * t;
+  const auto t3 = t2 * t;
+
+  const auto w0 = s * s * s / T(6);
+  const auto w1 = (T(3) * t3 - T(6) * t2 + T(4)) / T(6);
+  const auto w2 = (T(-3) * t3 + T(3) * t2 + T(3) * t + T(1)) / T(6);
+  const auto w3 = t3 / T(6);
+
+  return static_cast<V>( p0 * w0 + p1 * w1 + p2 * w2 + p3 * w3 );
+}
+
+//============================================================================
+// spline<V>
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Constructors
+//----------------------------------------------------------------------------
+
+template<typename V>
+inline bit::math::spline<V>::spline( spline_basis basis,
+                                     std::vector<V> points,
+                                     size_type samples_per_segment )
+  : m_points(std::move(points)),
+    m_lengths(),
+    m_samples_per_segment{samples_per_segment},
+    m_basis{basis}
+{
+  assert( m_points.size() >= 4 && "spline requires at least one segment" );
+  assert( (m_points.size() - 4) % stride(basis) == 0 &&
+          "spline requires a whole number of segments" );
+  assert( samples_per_segment > 0 );
+
+  // Approximates the length with chords between evenly spaced parameters
+  const auto samples = segment_count() * samples_per_segment;
+  const auto step    = float_t(1) / static_cast<float_t>(samples_per_segment);
+
+  m_lengths.reserve( samples + 1 );
+  m_lengths.push_back( float_t(0) );
+
+  auto previous = evaluate_segment( 0, float_t(0) );
+  for( auto i = size_type{1}; i <= samples; ++i ) {
+    const auto segment = (i - 1) / samples_per_segment;
+    const auto local   = static_cast<float_t>(i - segment * samples_per_segment) * step;
+    const auto current = evaluate_segment( segment, local );
+
+    m_lengths.push_back( m_lengths.back() + static_cast<float_t>((current - previous).magnitude()) );
+    previous = current;
+  }
+}
+
+//----------------------------------------------------------------------------
+// Observers
+//----------------------------------------------------------------------------
+
+template<typename V>
+inline bit::math::spline_basis bit::math::spline<V>::basis()
+  const noexcept
+{
+  return m_basis;
+}
+
+template<typename V>
+inline typename bit::math::spline<V>::size_type
+  bit::math::spline<V>::size()
+  const noexcept
+{
+  return m_points.size();
+}
+
+template<typename V>
+inline const V* bit::math::spline<V>::points()
+  const noexcept
+{
+  return m_points.data();
+}
+
+template<typename V>
+inline typename bit::math::spline<V>::size_type
+  bit::math::spline<V>::segment_count()
+  const noexcept
+{
+  return (m_points.size() - 4) / stride( m_basis ) + 1;
+}
+
+template<typename V>
+inline bit::math::float_t bit::math::spline<V>::length()
+  const noexcept
+{
+  return m_lengths.back();
+}
+
+//----------------------------------------------------------------------------
+// Evaluation
+//----------------------------------------------------------------------------
+
+template<typename V>
+inline V bit::math::spline<V>::evaluate( float_t t )
+  const noexcept
+{
+  const auto last = segment_count() - 1;
+
+  if( !(t > float_t(0)) ) return evaluate_segment( 0, float_t(0) );
+  if( t >= static_cast<float_t>(last + 1) ) return evaluate_segment( last, float_t(1) );
+
+  const auto segment = std::min( static_cast<size_type>( t ), last );
+
+  return evaluate_segment( segment, t - static_cast<float_t>(segment) );
+}
+
+template<typename V>
+inline void bit::math::spline<V>::evaluate( const float_t* t,
+                                            V* out,
+                                            size_type n )
+  const noexcept
+{
+  assert( (t != nullptr && out != nullptr) || n == 0 );
+
+  for( auto i = size_type{0}; i < n; ++i ) {
+    out[i] = evaluate( t[i] );
+  }
+}
+
+//----------------------------------------------------------------------------
+
+template<typename V>
+inline bit::math::float_t bit::math::spline<V>::parameter_at( float_t distance )
+  const noexcept
+{
+  return sample_parameter( find_sample( distance, 0 ), distance );
+}
+
+template<typename V>
+inline V bit::math::spline<V>::evaluate_at( float_t distance )
+  const noexcept
+{
+  return evaluate( parameter_at( distance ) );
+}
+
+template<typename V>
+inline void bit::math::spline<V>::evaluate_at( const float_t* distances,
+                                               V* out,
+                                               size_type n )
+  const noexcept
+{
+  assert( (distances != nullptr && out != nullptr) || n == 0 );
+
+  auto sample = size_type{0};
+  for( auto i = size_type{0}; i < n; ++i ) {
+    sample = find_sample( distances[i], sample );
+    out[i] = evaluate( sample_parameter( sample, distances[i] ) );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Private Member Functions
+//----------------------------------------------------------------------------
+
+template<typename V>
+inline typename bit::math::spline<V>::size_type
+  bit::math::spline<V>::stride( spline_basis basis )
+  noexcept
+{
+  switch( basis ) {
+  case spline_basis::catmull_rom: return 1;
+  case spline_basis::bezier:      return 3;
+  case spline_basis::hermite:     return 2;
+  case spline_basis::bspline:     return 1;
+  }
+  return 1;
+}
+
+template<typename V>
+inline V bit::math::spline<V>::evaluate_segment( size_type segment,
+                                                 float_t t )
+  const noexcept
+{
+  const auto p = m_points.data() + segment * stride( m_basis );
+
+  switch( m_basis ) {
+  case spline_basis::catmull_rom: return catmull_rom( p[0], p[1], p[2], p[3], t );
+  case spline_basis::bezier:      return bezier( p[0], p[1], p[2], p[3], t );
+  case spline_basis::hermite:     return hermite( p[0], p[1], p[2], p[3], t );
+  case spline_basis::bspline:     return bspline( p[0], p[1], p[2], p[3], t );
+  }
+  return p[0];
+}
+
+template<typename V>
+inline typename bit::math::spline<V>::size_type
+  bit::math::spline<V>::find_sample( float_t distance, size_type hint )
+  const noexcept
+{
+  // The number of entries stepped over before giving up on a linear scan
+  constexpr size_type max_steps = 4;
+
+  const auto last = m_lengths.size() - 2;
+
+  auto sample = std::min( hint, last );
+  if( distance >= m_lengths[sample] ) {
+    for( auto step = size_type{0}; step < max_steps; ++step ) {
+      if( sample == last || distance < m_lengths[sample + 1] ) return sample;
+      ++sample;
+    }
+  } else {
+    sample = 0;
+  }
+
+  // The last entry at or before 'distance', limited to the last entry that
+  // has a following entry
+  const auto first = m_lengths.begin() + 1;
+  const auto it    = std::upper_bound( first + sample, m_lengths.end() - 1, distance );
+
+  return static_cast<size_type>( it - first );
+}
+
+template<typename V>
+inline bit::math::float_t
+  bit::math::spline<V>::sample_parameter( size_type sample,
+                                          float_t distance )
+  const noexcept
+{
+  const auto l0 = m_lengths[sample];
+  const auto l1 = m_lengths[sample + 1];
+
+  auto fraction = float_t(0);
+  if( l1 > l0 ) {
+    fraction = (distance - l0) / (l1 - l0);
+    fraction = fraction < float_t(0) ? float_t(0) : (fraction > float_t(1) ? float_t(1) : fraction);
+  }
+
+  return (static_cast<float_t>(sample) + fraction) /
+         static_cast<float_t>(m_samples_per_segment);
+}
+
+#endif /* BIT_MATH_DETAIL_SPLINE_INL */
@@ -1,6 +1,108 @@
 #ifndef BIT_MATH_DETAIL_TRANSFORM_INL
 #define BIT_MATH_DETAIL_TRANSFORM_INL
 
+//============================================================================
+// detail
+//============================================================================
+
+inline bit::math::mat4
+  bit::math::detail::compose_trs( const vec3& translation,
+                                  const quaternion& rotation,
+                                  const vec3& scale )
+  noexcept
+{
+  auto result = mat4();
+  rotation.extract_rotation_matrix(&result);
+
+  // Scaling first scales each column of the rotation
+  for( auto c = 0; c < 3; ++c ) {
+    for( auto r = 0; r < 3; ++r ) {
+      result(r,c) *= scale[c];
+    }
+  }
+
+  result(0,3) = translation.x();
+  result(1,3) = translation.y();
+  result(2,3) = translation.z();
+
+  return result;
+}
+
+inline bit::math::mat4
+  bit::math::detail::compose_affine( const mat4& outer, const mat4& inner )
+  noexcept
+{
+  auto result = mat4::identity;
+
+  for( auto r = 0; r < 3; ++r ) {
+    for( auto c = 0; c < 4; ++c ) {
+      result(r,c) = outer(r,0) * inner(0,c) +
+                    outer(r,1) * inner(1,c) +
+                    outer(r,2) * inner(2,c);
+    }
+    result(r,3) += outer(r,3);
+  }
+
+  return result;
+}
+
+inline bit::math::mat4
+  bit::math::detail::compose_inverse_trs( const vec3& translation,
+                                          const quaternion& rotation,
+                                          const vec3& scale )
+  noexcept
+{
+  // The conjugate of a unit quaternion is its inverse rotation, and is the
+  // transpose of its matrix
+  const auto conjugate = quaternion{
+    rotation.w(), -rotation.x(), -rotation.y(), -rotation.z()
+  };
+
+  auto result = mat4();
+  conjugate.extract_rotation_matrix(&result);
+
+  // Unscaling last divides each row of the inverse rotation
+  for( auto r = 0; r < 3; ++r ) {
+    const auto inverse_scale = float_t(1) / scale[r];
+
+    for( auto c = 0; c < 3; ++c ) {
+      result(r,c) *= inverse_scale;
+    }
+  }
+
+  // Untranslating first is folded into the translation column
+  for( auto r = 0; r < 3; ++r ) {
+    result(r,3) = -( result(r,0) * translation.x() +
+                     result(r,1) * translation.y() +
+                     result(r,2) * translation.z() );
+  }
+
+  return result;
+}
+
+inline bit::math::mat3
+  bit::math::detail::compose_normal_matrix( const quaternion& rotation,
+                                            const vec3& scale )
+  noexcept
+{
+  auto result = mat3();
+  rotation.extract_rotation_matrix(&result);
+
+  for( auto c = 0; c < 3; ++c ) {
+    const auto inverse_scale = float_t(1) / scale[c];
+
+    for( auto r = 0; r < 3; ++r ) {
+      result(r,c) *= inverse_scale;
+    }
+  }
+
+  return result;
+}
+
+//============================================================================
+// transform
+//============================================================================
+
 
 //----------------------------------------------------------------------------
 // Constructors
@@ -9,14 +111,42 @@
 inline bit::math::transform::transform()
   noexcept
   : m_transform(mat4::identity),
+    m_inverse(mat4::identity),
+    m_normal(mat3::identity),
     m_rotation{},
     m_translation(0.0,0.0,0.0),
     m_scale(1.0,1.0,1.0),
-    m_is_dirty(false)
+    m_state(matrix_state::clean),
+    m_inverse_state(matrix_state::clean),
+    m_normal_state(matrix_state::clean)
 {
 
 }
 
+inline bit::math::transform::transform( const transform& other )
+  noexcept
+  : transform()
+{
+  (*this) = other;
+}
+
+//----------------------------------------------------------------------------
+
+inline bit::math::transform&
+  bit::math::transform::operator=( const transform& other )
+  noexcept
+{
+  m_rotation    = other.m_rotation;
+  m_translation = other.m_translation;
+  m_scale       = other.m_scale;
+
+  assign( m_transform, m_state, other.m_transform, other.m_state );
+  assign( m_inverse, m_inverse_state, other.m_inverse, other.m_inverse_state );
+  assign( m_normal, m_normal_state, other.m_normal, other.m_normal_state );
+
+  return (*this);
+}
+
 //----------------------------------------------------------------------------
 // Modifiers
 //----------------------------------------------------------------------------
@@ -31,7 +161,7 @@ inline void bit::math::transform::translate( const vec3& translation )
   noexcept
 {
   m_translation += translation;
-  m_is_dirty = true;
+  invalidate();
 }
 
 
@@ -39,21 +169,21 @@ inline void bit::math::transform::translate_x( float_t x )
   noexcept
 {
   m_translation.x() += x;
-  m_is_dirty = true;
+  invalidate();
 }
 
 inline void bit::math::transform::translate_y( float_t y )
   noexcept
 {
   m_translation.y() += y;
-  m_is_dirty = true;
+  invalidate();
 }
 
 inline void bit::math::transform::translate_z( float_t z )
   noexcept
 {
   m_translation.z() += z;
-  m_is_dirty = true;
+  invalidate();
 }
 
 //----------------------------------------------------------------------
@@ -68,7 +198,7 @@ inline void bit::math::transform::set_position( const vec3& position )
   noexcept
 {
   m_translation = position;
-  m_is_dirty = true;
+  invalidate();
 }
 
 
@@ -76,21 +206,21 @@ inline void bit::math::transform::set_position_x( float_t x )
   noexcept
 {
   m_translation.x() = x;
-  m_is_dirty = true;
+  invalidate();
 }
 
 inline void bit::math::transform::set_position_y( float_t y )
   noexcept
 {
   m_translation.y() = y;
-  m_is_dirty = true;
+  invalidate();
 }
 
 inline void bit::math::transform::set_position_z( float_t z )
   noexcept
 {
   m_translation.z() = z;
-  m_is_dirty = true;
+  invalidate();
 }
 
 //----------------------------------------------------------------------------
@@ -110,8 +240,8 @@ inline void bit::math::transform::rotate( radian angle, const vec3& axis )
 inline void bit::math::transform::rotate( const quaternion& rotation )
   noexcept
 {
-  m_rotation += rotation;
-  m_is_dirty = true;
+  m_rotation = rotation * m_rotation;
+  invalidate();
 }
 
 inline void bit::math::transform::rotate_yaw( radian angle )
@@ -150,7 +280,7 @@ inline void bit::math::transform::set_rotation( const quaternion& quaternion )
   noexcept
 {
   m_rotation = quaternion;
-  m_is_dirty = true;
+  invalidate();
 }
 
 inline void bit::math::transform::set_angle_roll( radian angle )
@@ -183,7 +313,7 @@ inline void bit::math::transform::scale( vec3 scale )
   noexcept
 {
   m_scale += scale;
-  m_is_dirty = true;
+  invalidate();
 }
 
 
@@ -191,21 +321,21 @@ inline void bit::math::transform::scale_x( float_t scale )
   noexcept
 {
   m_scale.x() += scale;
-  m_is_dirty = true;
+  invalidate();
 }
 
 inline void bit::math::transform::scale_y( float_t scale )
   noexcept
 {
   m_scale.y() += scale;
-  m_is_dirty = true;
+  invalidate();
 }
 
 inline void bit::math::transform::scale_z( float_t scale )
   noexcept
 {
   m_scale.z() += scale;
-  m_is_dirty = true;
+  invalidate();
 
 }
 
@@ -221,28 +351,28 @@ inline void bit::math::transform::set_scale( vec3 scale )
   noexcept
 {
   m_scale = scale;
-  m_is_dirty = true;
+  invalidate();
 }
 
 inline void bit::math::transform::set_scale_x( float_t scale )
   noexcept
 {
   m_scale.x() = scale;
-  m_is_dirty = true;
+  invalidate();
 }
 
 inline void bit::math::transform::set_scale_y( float_t scale )
   noexcept
 {
   m_scale.y() = scale;
-  m_is_dirty = true;
+  invalidate();
 }
 
 inline void bit::math::transform::set_scale_z( float_t scale )
   noexcept
 {
   m_scale.z() = scale;
-  m_is_dirty = true;
+  invalidate();
 }
 
 //----------------------------------------------------------------------------
@@ -332,33 +462,140 @@ inline bit::math::radian bit::math::transform::yaw()
 inline const bit::math::mat4& bit::math::transform::matrix()
   const noexcept
 {
-  if( m_is_dirty ) update();
+  update( m_state, [this]{
+    m_transform = detail::compose_trs( m_translation, m_rotation, m_scale );
+  });
   return m_transform;
 }
 
+inline const bit::math::mat4& bit::math::transform::inverse_matrix()
+  const noexcept
+{
+  update( m_inverse_state, [this]{
+    m_inverse = detail::compose_inverse_trs( m_translation, m_rotation, m_scale );
+  });
+  return m_inverse;
+}
+
+inline const bit::math::mat3& bit::math::transform::normal_matrix()
+  const noexcept
+{
+  update( m_normal_state, [this]{
+    m_normal = detail::compose_normal_matrix( m_rotation, m_scale );
+  });
+  return m_normal;
+}
+
+inline bit::math::transform_snapshot bit::math::transform::snapshot()
+  const noexcept
+{
+  return { m_translation, m_rotation, m_scale };
+}
+
 //----------------------------------------------------------------------------
 // Private Member Functions
 //----------------------------------------------------------------------------
 
-inline void bit::math::transform::update()
-  const noexcept
+template<typename Fn>
+inline void bit::math::transform::update( state_type& state, Fn rebuild )
+  noexcept
 {
-  auto rotation    = bit::math::mat4();
-  auto translation = bit::math::mat4::identity;
-  auto scale       = bit::math::mat4::identity;
+  if( state.load( std::memory_order_acquire ) == matrix_state::clean ) return;
+
+  auto expected = matrix_state::dirty;
 
-  m_rotation.extract_rotation_matrix(&rotation);
+  // Only the reader that claims the stale matrix rebuilds it
+  if( state.compare_exchange_strong( expected, matrix_state::updating,
+                                     std::memory_order_acquire ) ) {
+    rebuild();
+    state.store( matrix_state::clean, std::memory_order_release );
+    return;
+  }
 
-  translation(3,0) = m_translation.x();
-  translation(3,1) = m_translation.y();
-  translation(3,2) = m_translation.z();
+  // The rebuild is a few dozen multiplies, so waiting readers only spin
+  // briefly
+  while( state.load( std::memory_order_acquire ) != matrix_state::clean ) {
+    std::this_thread::yield();
+  }
+}
+
+template<typename Matrix>
+inline void bit::math::transform::assign( Matrix& to,
+                                          state_type& to_state,
+                                          const Matrix& from,
+                                          const state_type& from_state )
+  noexcept
+{
+  // A reader of the source may be mid-rebuild, in which case the
+  // destination rebuilds its own matrix instead
+  if( from_state.load( std::memory_order_acquire ) == matrix_state::clean ) {
+    to = from;
+    to_state.store( matrix_state::clean, std::memory_order_relaxed );
+  } else {
+    to_state.store( matrix_state::dirty, std::memory_order_relaxed );
+  }
+}
 
-  scale(1,1) = m_scale.x();
-  scale(2,2) = m_scale.y();
-  scale(3,3) = m_scale.z();
+inline void bit::math::transform::invalidate()
+  noexcept
+{
+  // Modifiers have exclusive access, so nothing needs to be published
+  m_state.store( matrix_state::dirty, std::memory_order_relaxed );
+  m_inverse_state.store( matrix_state::dirty, std::memory_order_relaxed );
+  m_normal_state.store( matrix_state::dirty, std::memory_order_relaxed );
+}
+
+//============================================================================
+// Interpolation
+//============================================================================
+
+inline bit::math::mat4
+  bit::math::detail::compose_interpolated( const transform_snapshot& from,
+                                           const transform_snapshot& to,
+                                           float_t alpha )
+  noexcept
+{
+  // 'q' and '-q' are the same rotation; blending towards whichever is
+  // nearer takes the shorter arc
+  const auto to_rotation = from.rotation.dot( to.rotation ) < 0
+                         ? -to.rotation
+                         : to.rotation;
+
+  const auto rotation = from.rotation * (float_t(1) - alpha) + to_rotation * alpha;
+
+  return compose_trs( from.translation + (to.translation - from.translation) * alpha,
+                      rotation.normalized(),
+                      from.scale + (to.scale - from.scale) * alpha );
+}
+
+//----------------------------------------------------------------------------
+
+inline void bit::math::interpolate_transforms( const transform_snapshot* prev,
+                                               const transform_snapshot* curr,
+                                               float_t alpha,
+                                               mat4* out,
+                                               std::size_t n )
+  noexcept
+{
+  assert( (prev != nullptr && curr != nullptr && out != nullptr) || n == 0 );
+
+  for( auto i = std::size_t{0}; i < n; ++i ) {
+    out[i] = detail::compose_interpolated( prev[i], curr[i], alpha );
+  }
+}
+
+inline void bit::math::interpolate_transforms( const transform_snapshot* prev,
+                                               const transform* curr,
+                                               float_t alpha,
+                                               mat4* out,
+                                               std::size_t n )
+  noexcept
+{
+  assert( (prev != nullptr && curr != nullptr && out != nullptr) || n == 0 );
 
-  m_transform = translation * rotation * scale;
-  m_is_dirty  = false;
+  for( auto i = std::size_t{0}; i < n; ++i ) {
+    out[i] = detail::compose_interpolated( prev[i], curr[i].snapshot(), alpha );
+  }
 }
 
 #endif /* BIT_MATH_DETAIL_TRANSFORM_INL */
@@ -0,0 +1,102 @@
+#ifndef BIT_MATH_DETAIL_TRANSFORM_BUFFER_INL
+#define BIT_MATH_DETAIL_TRANSFORM_BUFFER_INL
+
+#ifndef BIT_MATH_TRANSFORM_BUFFER_HPP
+# error "transform_buffer.inl included without first including declaration header transform_buffer.hpp"
+#endif
+
+//----------------------------------------------------------------------------
+// Constructors
+//----------------------------------------------------------------------------
+
+inline bit::math::transform_buffer::transform_buffer( size_type n )
+  : m_frames{
+      frame_type( n, mat4::identity ),
+      frame_type( n, mat4::identity ),
+      frame_type( n, mat4::identity )
+    },
+    m_write{0},
+    m_padding0{},
+    m_shared{1},
+    m_padding1{},
+    m_read{2}
+{
+
+}
+
+//----------------------------------------------------------------------------
+// Writer
+//----------------------------------------------------------------------------
+
+inline bit::math::mat4* bit::math::transform_buffer::write_data()
+  noexcept
+{
+  return m_frames[m_write].data();
+}
+
+inline void bit::math::transform_buffer::write( index_type n,
+                                                const transform& t )
+  noexcept
+{
+  write( n, t.matrix() );
+}
+
+inline void bit::math::transform_buffer::write( index_type n,
+                                                const mat4& matrix )
+  noexcept
+{
+  assert( n < size() && "index out of range" );
+
+  m_frames[m_write][n] = matrix;
+}
+
+inline void bit::math::transform_buffer::publish()
+  noexcept
+{
+  // Releases the written frame to the reader, and acquires whichever frame
+  // the reader last gave back
+  const auto previous = m_shared.exchange( static_cast<slot_type>(m_write | fresh_bit),
+                                           std::memory_order_acq_rel );
+  m_write = previous & slot_mask;
+}
+
+//----------------------------------------------------------------------------
+// Reader
+//----------------------------------------------------------------------------
+
+inline bool bit::math::transform_buffer::has_update()
+  const noexcept
+{
+  return (m_shared.load( std::memory_order_relaxed ) & fresh_bit) != 0;
+}
+
+inline const bit::math::mat4* bit::math::transform_buffer::read()
+  noexcept
+{
+  // Only the writer sets the fresh bit, so it cannot be lost between the
+  // check and the exchange
+  if( has_update() ) {
+    const auto shared = m_shared.exchange( m_read, std::memory_order_acq_rel );
+    m_read = shared & slot_mask;
+  }
+  return m_frames[m_read].data();
+}
+
+//----------------------------------------------------------------------------
+// Observers
+//----------------------------------------------------------------------------
+
+inline bit::math::transform_buffer::size_type
+  bit::math::transform_buffer::size()
+  const noexcept
+{
+  return m_frames[0].size();
+}
+
+inline std::size_t bit::math::transform_buffer::size_bytes()
+  const noexcept
+{
+  return size() * sizeof(mat4);
+}
+
+#endif /* BIT_MATH_DETAIL_TRANSFORM_BUFFER_INL */
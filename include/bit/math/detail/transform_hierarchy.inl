@@ -0,0 +1,202 @@
+#ifndef BIT_MATH_DETAIL_TRANSFORM_HIERARCHY_INL
+#define BIT_MATH_DETAIL_TRANSFORM_HIERARCHY_INL
+
+#ifndef BIT_MATH_TRANSFORM_HIERARCHY_HPP
+# error "transform_hierarchy.inl included without first including declaration header transform_hierarchy.hpp"
+#endif
+
+//----------------------------------------------------------------------------
+// Constructors
+//----------------------------------------------------------------------------
+
+inline bit::math::transform_hierarchy::transform_hierarchy()
+  noexcept
+  : m_first_dirty{0}
+{
+
+}
+
+//----------------------------------------------------------------------------
+// Modifiers
+//----------------------------------------------------------------------------
+
+inline void bit::math::transform_hierarchy::reserve( size_type n )
+{
+  m_parents.reserve( n );
+  m_translations.reserve( n );
+  m_rotations.reserve( n );
+  m_scales.reserve( n );
+  m_world.reserve( n );
+  m_dirty.reserve( n );
+}
+
+inline bit::math::transform_hierarchy::index_type
+  bit::math::transform_hierarchy::add_node( index_type parent )
+{
+  return add_node( transform{}, parent );
+}
+
+inline bit::math::transform_hierarchy::index_type
+  bit::math::transform_hierarchy::add_node( const transform& local,
+                                            index_type parent )
+{
+  assert( (parent == no_parent || parent < size()) && "parent must be added before its children" );
+
+  const auto n = size();
+
+  m_parents.push_back( parent );
+  m_translations.push_back( local.position() );
+  m_rotations.push_back( local.rotation() );
+  m_scales.push_back( local.scale() );
+  m_world.push_back( mat4::identity );
+  m_dirty.push_back( 0 );
+
+  mark_dirty( n );
+  return n;
+}
+
+inline void bit::math::transform_hierarchy::clear()
+  noexcept
+{
+  m_parents.clear();
+  m_translations.clear();
+  m_rotations.clear();
+  m_scales.clear();
+  m_world.clear();
+  m_dirty.clear();
+  m_first_dirty = 0;
+}
+
+//----------------------------------------------------------------------------
+
+inline void bit::math::transform_hierarchy::set_position( index_type n,
+                                                          const vec3& position )
+  noexcept
+{
+  assert( n < size() && "index out of range" );
+
+  m_translations[n] = position;
+  mark_dirty( n );
+}
+
+inline void bit::math::transform_hierarchy::set_rotation( index_type n,
+                                                          const quaternion& rotation )
+  noexcept
+{
+  assert( n < size() && "index out of range" );
+
+  m_rotations[n] = rotation;
+  mark_dirty( n );
+}
+
+inline void bit::math::transform_hierarchy::set_scale( index_type n,
+                                                       const vec3& scale )
+  noexcept
+{
+  assert( n < size() && "index out of range" );
+
+  m_scales[n] = scale;
+  mark_dirty( n );
+}
+
+inline void bit::math::transform_hierarchy::set_local( index_type n,
+                                                       const transform& local )
+  noexcept
+{
+  assert( n < size() && "index out of range" );
+
+  m_translations[n] = local.position();
+  m_rotations[n]    = local.rotation();
+  m_scales[n]       = local.scale();
+  mark_dirty( n );
+}
+
+//----------------------------------------------------------------------------
+// Observers
+//----------------------------------------------------------------------------
+
+inline bit::math::transform_hierarchy::size_type
+  bit::math::transform_hierarchy::size()
+  const noexcept
+{
+  return m_parents.size();
+}
+
+inline bool bit::math::transform_hierarchy::empty()
+  const noexcept
+{
+  return m_parents.empty();
+}
+
+inline bit::math::transform_hierarchy::index_type
+  bit::math::transform_hierarchy::parent( index_type n )
+  const noexcept
+{
+  assert( n < size() && "index out of range" );
+
+  return m_parents[n];
+}
+
+inline const bit::math::vec3&
+  bit::math::transform_hierarchy::position( index_type n )
+  const noexcept
+{
+  assert( n < size() && "index out of range" );
+
+  return m_translations[n];
+}
+
+inline const bit::math::quaternion&
+  bit::math::transform_hierarchy::rotation( index_type n )
+  const noexcept
+{
+  assert( n < size() && "index out of range" );
+
+  return m_rotations[n];
+}
+
+inline const bit::math::vec3&
+  bit::math::transform_hierarchy::scale( index_type n )
+  const noexcept
+{
+  assert( n < size() && "index out of range" );
+
+  return m_scales[n];
+}
+
+inline bool bit::math::transform_hierarchy::is_dirty( index_type n )
+  const noexcept
+{
+  assert( n < size() && "index out of range" );
+
+  return m_dirty[n] != 0;
+}
+
+inline const bit::math::mat4&
+  bit::math::transform_hierarchy::world_matrix( index_type n )
+  const noexcept
+{
+  assert( n < size() && "index out of range" );
+
+  return m_world[n];
+}
+
+inline const bit::math::mat4*
+  bit::math::transform_hierarchy::world_matrices()
+  const noexcept
+{
+  return m_world.data();
+}
+
+//----------------------------------------------------------------------------
+// Private Member Functions
+//----------------------------------------------------------------------------
+
+inline void bit::math::transform_hierarchy::mark_dirty( index_type n )
+  noexcept
+{
+  m_dirty[n] = 1;
+  if( n < m_first_dirty ) m_first_dirty = n;
+}
+
+#endif /* BIT_MATH_DETAIL_TRANSFORM_HIERARCHY_INL */
@@ -0,0 +1,337 @@
+#ifndef BIT_MATH_DETAIL_TRANSFORM_POOL_INL
+#define BIT_MATH_DETAIL_TRANSFORM_POOL_INL
+
+#ifndef BIT_MATH_TRANSFORM_POOL_HPP
+# error "transform_pool.inl included without first including declaration header transform_pool.hpp"
+#endif
+
+//============================================================================
+// transform_pool
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Modifiers
+//----------------------------------------------------------------------------
+
+inline void bit::math::transform_pool::reserve( size_type n )
+{
+  for( auto& c : m_components ) {
+    c.reserve( n );
+  }
+  m_dirty.reserve( n );
+  m_matrices.reserve( n );
+}
+
+inline bit::math::transform_pool::handle bit::math::transform_pool::add()
+{
+  return add( transform{} );
+}
+
+inline bit::math::transform_pool::handle
+  bit::math::transform_pool::add( const transform& t )
+{
+  const auto n = size();
+
+  for( auto& c : m_components ) {
+    c.push_back( float_t(0) );
+  }
+  m_dirty.push_back( 1 );
+  m_matrices.push_back( mat4::identity );
+
+  set_position( n, t.position() );
+  set_rotation( n, t.rotation() );
+  set_scale( n, t.scale() );
+
+  return handle{ *this, n };
+}
+
+inline void bit::math::transform_pool::clear()
+  noexcept
+{
+  for( auto& c : m_components ) {
+    c.clear();
+  }
+  m_dirty.clear();
+  m_matrices.clear();
+}
+
+inline bit::math::transform_pool::handle
+  bit::math::transform_pool::operator[]( index_type n )
+  noexcept
+{
+  assert( n < size() && "index out of range" );
+
+  return handle{ *this, n };
+}
+
+//----------------------------------------------------------------------------
+// Observers
+//----------------------------------------------------------------------------
+
+inline bit::math::transform_pool::size_type
+  bit::math::transform_pool::size()
+  const noexcept
+{
+  return m_dirty.size();
+}
+
+inline bool bit::math::transform_pool::empty()
+  const noexcept
+{
+  return m_dirty.empty();
+}
+
+inline bit::math::vec3 bit::math::transform_pool::position( index_type n )
+  const noexcept
+{
+  assert( n < size() && "index out of range" );
+
+  return {
+    m_components[position_x][n],
+    m_components[position_y][n],
+    m_components[position_z][n]
+  };
+}
+
+inline bit::math::quaternion bit::math::transform_pool::rotation( index_type n )
+  const noexcept
+{
+  assert( n < size() && "index out of range" );
+
+  // The real part comes first in the component constructor
+  return {
+    m_components[rotation_w][n],
+    m_components[rotation_x][n],
+    m_components[rotation_y][n],
+    m_components[rotation_z][n]
+  };
+}
+
+inline bit::math::vec3 bit::math::transform_pool::scale( index_type n )
+  const noexcept
+{
+  assert( n < size() && "index out of range" );
+
+  return {
+    m_components[scale_x][n],
+    m_components[scale_y][n],
+    m_components[scale_z][n]
+  };
+}
+
+inline bool bit::math::transform_pool::is_dirty( index_type n )
+  const noexcept
+{
+  assert( n < size() && "index out of range" );
+
+  return m_dirty[n] != 0;
+}
+
+inline const bit::math::mat4& bit::math::transform_pool::matrix( index_type n )
+  const noexcept
+{
+  assert( n < size() && "index out of range" );
+
+  return m_matrices[n];
+}
+
+inline const bit::math::mat4* bit::math::transform_pool::matrices()
+  const noexcept
+{
+  return m_matrices.data();
+}
+
+//----------------------------------------------------------------------------
+// Private Member Functions
+//----------------------------------------------------------------------------
+
+inline void bit::math::transform_pool::set_position( index_type n,
+                                                     const vec3& position )
+  noexcept
+{
+  m_components[position_x][n] = position.x();
+  m_components[position_y][n] = position.y();
+  m_components[position_z][n] = position.z();
+  m_dirty[n] = 1;
+}
+
+inline void bit::math::transform_pool::set_rotation( index_type n,
+                                                     const quaternion& rotation )
+  noexcept
+{
+  m_components[rotation_x][n] = rotation.x();
+  m_components[rotation_y][n] = rotation.y();
+  m_components[rotation_z][n] = rotation.z();
+  m_components[rotation_w][n] = rotation.w();
+  m_dirty[n] = 1;
+}
+
+inline void bit::math::transform_pool::set_scale( index_type n,
+                                                  const vec3& scale )
+  noexcept
+{
+  m_components[scale_x][n] = scale.x();
+  m_components[scale_y][n] = scale.y();
+  m_components[scale_z][n] = scale.z();
+  m_dirty[n] = 1;
+}
+
+//============================================================================
+// transform_pool::handle
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Constructors
+//----------------------------------------------------------------------------
+
+inline bit::math::transform_pool::handle::handle( transform_pool& pool,
+                                                  index_type n )
+  noexcept
+  : m_pool{&pool},
+    m_index{n}
+{
+
+}
+
+//----------------------------------------------------------------------------
+// Modifiers
+//----------------------------------------------------------------------------
+
+inline void bit::math::transform_pool::handle::translate( float_t x,
+                                                          float_t y,
+                                                          float_t z )
+  noexcept
+{
+  translate( {x,y,z} );
+}
+
+inline void bit::math::transform_pool::handle::translate( const vec3& translation )
+  noexcept
+{
+  m_pool->set_position( m_index, position() + translation );
+}
+
+inline void bit::math::transform_pool::handle::set_position( float_t x,
+                                                             float_t y,
+                                                             float_t z )
+  noexcept
+{
+  set_position( {x,y,z} );
+}
+
+inline void bit::math::transform_pool::handle::set_position( const vec3& position )
+  noexcept
+{
+  m_pool->set_position( m_index, position );
+}
+
+//----------------------------------------------------------------------------
+
+inline void bit::math::transform_pool::handle::rotate( radian yaw,
+                                                       radian pitch,
+                                                       radian roll )
+  noexcept
+{
+  rotate( quaternion{ yaw, pitch, roll } );
+}
+
+inline void bit::math::transform_pool::handle::rotate( radian angle,
+                                                       const vec3& axis )
+  noexcept
+{
+  rotate( quaternion{ angle, axis } );
+}
+
+inline void bit::math::transform_pool::handle::rotate( const quaternion& rotation )
+  noexcept
+{
+  m_pool->set_rotation( m_index, rotation * this->rotation() );
+}
+
+inline void bit::math::transform_pool::handle::set_rotation( radian yaw,
+                                                             radian pitch,
+                                                             radian roll )
+  noexcept
+{
+  set_rotation( quaternion{ yaw, pitch, roll } );
+}
+
+inline void bit::math::transform_pool::handle::set_rotation( radian angle,
+                                                             const vec3& axis )
+  noexcept
+{
+  set_rotation( quaternion{ angle, axis } );
+}
+
+inline void bit::math::transform_pool::handle::set_rotation( const quaternion& rotation )
+  noexcept
+{
+  m_pool->set_rotation( m_index, rotation );
+}
+
+//----------------------------------------------------------------------------
+
+inline void bit::math::transform_pool::handle::scale( float_t x,
+                                                      float_t y,
+                                                      float_t z )
+  noexcept
+{
+  scale( {x,y,z} );
+}
+
+inline void bit::math::transform_pool::handle::scale( const vec3& scale )
+  noexcept
+{
+  m_pool->set_scale( m_index, this->scale() + scale );
+}
+
+inline void bit::math::transform_pool::handle::set_scale( float_t x,
+                                                          float_t y,
+                                                          float_t z )
+  noexcept
+{
+  set_scale( {x,y,z} );
+}
+
+inline void bit::math::transform_pool::handle::set_scale( const vec3& scale )
+  noexcept
+{
+  m_pool->set_scale( m_index, scale );
+}
+
+//----------------------------------------------------------------------------
+// Observers
+//----------------------------------------------------------------------------
+
+inline bit::math::transform_pool::index_type
+  bit::math::transform_pool::handle::index()
+  const noexcept
+{
+  return m_index;
+}
+
+inline bit::math::vec3 bit::math::transform_pool::handle::position()
+  const noexcept
+{
+  return m_pool->position( m_index );
+}
+
+inline bit::math::quaternion bit::math::transform_pool::handle::rotation()
+  const noexcept
+{
+  return m_pool->rotation( m_index );
+}
+
+inline bit::math::vec3 bit::math::transform_pool::handle::scale()
+  const noexcept
+{
+  return m_pool->scale( m_index );
+}
+
+inline const bit::math::mat4& bit::math::transform_pool::handle::matrix()
+  const noexcept
+{
+  return m_pool->matrix( m_index );
+}
+
+#endif /* BIT_MATH_DETAIL_TRANSFORM_POOL_INL */
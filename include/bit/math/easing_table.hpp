@@ -0,0 +1,266 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains easing curves that can be evaluated at
+ *        compile time, and lookup tables that bake them for evaluation
+ *        without transcendental calls
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  Bit Math Library.
+  https://github.com/bitwizeshift/bit-math
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_MATH_EASING_TABLE_HPP
+#define BIT_MATH_EASING_TABLE_HPP
+
+#include "math.hpp"          // bit::math::float_t, bit::math::pi
+#include "interpolation.hpp" // bit::math::linear
+
+#include <algorithm>   // std::min
+#include <cstddef>     // std::size_t
+#include <limits>      // std::numeric_limits
+#include <type_traits> // std::common_type_t
+
+namespace bit {
+  namespace math {
+    namespace detail {
+
+      // Compile-time approximations of the functions the easing curves are
+      // built from. They are accurate to long double precision over the
+      // ranges the curves use, but far slower than the <cmath> functions at
+      // runtime
+
+      /// \brief Computes the square root of \p x >= 0 by Newton's method
+      constexpr long double constexpr_sqrt( long double x ) noexcept;
+
+      /// \brief Computes the sine of \p x in [-pi,pi] by its Taylor series
+      constexpr long double constexpr_sin( long double x ) noexcept;
+
+      /// \brief Computes the cosine of \p x in [-pi,pi] by its Taylor series
+      constexpr long double constexpr_cos( long double x ) noexcept;
+
+    } // namespace detail
+
+    //------------------------------------------------------------------------
+    // Easing Curves
+    //------------------------------------------------------------------------
+
+    // Each curve maps a position t in [0,1] to the weight of the end point,
+    // identically to the interpolation function of the same name in
+    // 'interpolation.hpp'; for example, cosine(v0,v1,t) is equivalent to
+    // linear(v0,v1,cosine_curve{}(t)). Unlike those functions, the curves
+    // can be evaluated at compile time to generate an easing_table.
+    //
+    // max_second_derivative() bounds |f''(t)| over [0,1], which bounds the
+    // error of an easing_table of the curve.
+
+    struct linear_curve
+    {
+      constexpr float_t operator()( float_t t ) const noexcept;
+      static constexpr float_t max_second_derivative() noexcept;
+    };
+
+    struct quadratic_curve
+    {
+      constexpr float_t operator()( float_t t ) const noexcept;
+      static constexpr float_t max_second_derivative() noexcept;
+    };
+
+    struct cubic_curve
+    {
+      constexpr float_t operator()( float_t t ) const noexcept;
+      static constexpr float_t max_second_derivative() noexcept;
+    };
+
+    struct quartic_curve
+    {
+      constexpr float_t operator()( float_t t ) const noexcept;
+      static constexpr float_t max_second_derivative() noexcept;
+    };
+
+    struct quintic_curve
+    {
+      constexpr float_t operator()( float_t t ) const noexcept;
+      static constexpr float_t max_second_derivative() noexcept;
+    };
+
+    /// \note The second derivative of this curve is unbounded as t
+    ///       approaches 1, so max_second_derivative() is infinite. Tables of
+    ///       it are instead accurate to sqrt(2/(N-1)), which is the rise of
+    ///       the curve over its last interval.
+    struct circular_curve
+    {
+      constexpr float_t operator()( float_t t ) const noexcept;
+      static constexpr float_t max_second_derivative() noexcept;
+    };
+
+    struct half_cosine_curve
+    {
+      constexpr float_t operator()( float_t t ) const noexcept;
+      static constexpr float_t max_second_derivative() noexcept;
+    };
+
+    struct cosine_curve
+    {
+      constexpr float_t operator()( float_t t ) const noexcept;
+      static constexpr float_t max_second_derivative() noexcept;
+    };
+
+    struct half_sine_curve
+    {
+      constexpr float_t operator()( float_t t ) const noexcept;
+      static constexpr float_t max_second_derivative() noexcept;
+    };
+
+    struct sine_curve
+    {
+      constexpr float_t operator()( float_t t ) const noexcept;
+      static constexpr float_t max_second_derivative() noexcept;
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief An easing curve sampled at \p N evenly spaced positions, and
+    ///        evaluated by linearly interpolating between the samples
+    ///
+    /// Evaluating a table costs one multiply, one truncation, and one lerp,
+    /// regardless of the curve. Tables are created with make_easing_table,
+    /// and are literal types, so a constexpr table is generated entirely at
+    /// compile time.
+    ///
+    /// For a curve f with |f''| <= M over [0,1], the lookup differs from f
+    /// by at most error_bound(M) = M * h^2 / 8, where h = 1/(N-1) is the
+    /// spacing of the samples. For example, a 256-entry table of
+    /// sine_curve is accurate to 1.9e-5.
+    ///
+    /// \tparam N the number of samples; at least 2
+    //////////////////////////////////////////////////////////////////////////
+    template<std::size_t N>
+    class easing_table
+    {
+      static_assert( N >= 2, "easing_table requires at least two samples" );
+
+      //----------------------------------------------------------------------
+      // Public Types
+      //----------------------------------------------------------------------
+    public:
+
+      using size_type = std::size_t;
+
+      //----------------------------------------------------------------------
+      // Constructors
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a table by sampling \p curve
+      ///
+      /// \param curve the curve to sample; evaluated at i/(N-1) for every
+      ///        sample i
+      template<typename Curve>
+      constexpr explicit easing_table( Curve curve ) noexcept;
+
+      //----------------------------------------------------------------------
+      // Observers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the number of samples in this table
+      ///
+      /// \return N
+      static constexpr size_type size() noexcept;
+
+      /// \brief Gets the maximum error of a table of a curve whose second
+      ///        derivative is bounded by \p max_second_derivative
+      ///
+      /// \param max_second_derivative the bound of |f''| over [0,1]
+      /// \return the maximum difference between the table and the curve
+      static constexpr float_t error_bound( float_t max_second_derivative ) noexcept;
+
+      /// \brief Gets the \p n th sample of this table
+      ///
+      /// \param n the index of the sample
+      /// \return the curve at n/(N-1)
+      constexpr float_t operator[]( size_type n ) const noexcept;
+
+      //----------------------------------------------------------------------
+      // Evaluation
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Evaluates the curve at \p t
+      ///
+      /// \param t the position, clamped to [0,1]
+      /// \return the weight of the end point at \p t
+      constexpr float_t operator()( float_t t ) const noexcept;
+
+      /// \brief Evaluates the curve at each of \p n positions
+      ///
+      /// \param t pointer to the \p n positions
+      /// \param out pointer to the \p n results
+      /// \param n the number of positions
+      void operator()( const float_t* t, float_t* out, size_type n ) const noexcept;
+
+      /// \brief Interpolates between \p v0 and \p v1 by the curve at \p t
+      ///
+      /// \param v0 the starting point
+      /// \param v1 the ending point
+      /// \param t the position, clamped to [0,1]
+      /// \return the interpolated point
+      template<typename V0, typename V1>
+      constexpr std::common_type_t<V0,V1,float_t>
+        interpolate( const V0& v0, const V1& v1, float_t t ) const noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      float_t m_samples[N];
+    };
+
+    //------------------------------------------------------------------------
+    // Generation
+    //------------------------------------------------------------------------
+
+    /// \brief Makes an \p N entry table of \p curve
+    ///
+    /// The table is generated at compile time when the result is constexpr,
+    /// which requires \p curve to be evaluable at compile time, such as the
+    /// curves in this header:
+    ///
+    /// \code
+    /// constexpr auto table = make_easing_table<256>( sine_curve{} );
+    /// \endcode
+    ///
+    /// \tparam N the number of samples
+    /// \param curve the curve to sample
+    /// \return the table
+    template<std::size_t N, typename Curve>
+    constexpr easing_table<N> make_easing_table( Curve curve ) noexcept;
+
+  } // namespace math
+} // namespace bit
+
+#include "detail/easing_table.inl"
+
+#endif /* BIT_MATH_EASING_TABLE_HPP */
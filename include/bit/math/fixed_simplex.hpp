@@ -0,0 +1,159 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains a deterministic, fixed-point implementation of
+ *        simplex noise
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  Bit Math Library.
+  https://github.com/bitwizeshift/bit-math
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_MATH_FIXED_SIMPLEX_HPP
+#define BIT_MATH_FIXED_SIMPLEX_HPP
+
+// bit::map library
+#include "math.hpp" // bit::math::float_t
+
+#include <cmath>   // std::floor
+#include <cstddef> // std::size_t
+#include <cstdint> // std::int32_t
+
+namespace bit {
+  namespace math {
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief Simplex noise computed entirely with integer arithmetic
+    ///
+    /// The functions in \c bit::math::simplex depend on the floating point
+    /// environment; the results differ between compilers, between x87 and
+    /// SSE code generation, and with FMA contraction. The functions in this
+    /// namespace take and return Q16.16 fixed-point numbers and compute
+    /// with 30 fractional bits internally, so they produce bit-identical
+    /// results on every platform. This makes them suitable for lockstep
+    /// simulations.
+    ///
+    /// The noise is the same as \c simplex::raw_noise to within about
+    /// 1e-5, and coordinates may span the whole Q16.16 range.
+    //////////////////////////////////////////////////////////////////////////
+    namespace fixed_simplex {
+
+      /// \brief A Q16.16 fixed-point number
+      using fixed_t = std::int32_t;
+
+      /// The fixed-point representation of 1
+      constexpr fixed_t fixed_one = 65536;
+
+      //----------------------------------------------------------------------
+      // Conversions
+      //----------------------------------------------------------------------
+
+      /// \brief Converts \p value to the nearest Q16.16 fixed-point number
+      ///
+      /// The conversion is exact in double precision, so it is also
+      /// deterministic; \p value must be within the Q16.16 range
+      ///
+      /// \param value the value to convert
+      /// \return the fixed-point value
+      fixed_t to_fixed( float_t value ) noexcept;
+
+      /// \brief Converts the Q16.16 fixed-point \p value to a float_t
+      ///
+      /// \param value the fixed-point value to convert
+      /// \return the floating point value
+      float_t to_float( fixed_t value ) noexcept;
+
+      //----------------------------------------------------------------------
+      // Raw Noise
+      //----------------------------------------------------------------------
+
+      /// \brief Generates 2-dimensional raw simplex noise
+      ///
+      /// \param x the Q16.16 x-coordinate
+      /// \param y the Q16.16 y-coordinate
+      /// \return the Q16.16 result of the raw noise, in the range [-1,1]
+      fixed_t raw_noise( fixed_t x, fixed_t y ) noexcept;
+
+      /// \brief Generates 3-dimensional raw simplex noise
+      ///
+      /// \param x the Q16.16 x-coordinate
+      /// \param y the Q16.16 y-coordinate
+      /// \param z the Q16.16 z-coordinate
+      /// \return the Q16.16 result of the raw noise, in the range [-1,1]
+      fixed_t raw_noise( fixed_t x, fixed_t y, fixed_t z ) noexcept;
+
+      //----------------------------------------------------------------------
+
+      /// \brief Generates 2-dimensional raw simplex noise for \p n samples
+      ///        at once
+      ///
+      /// \param x pointer to the \p n Q16.16 x-coordinates
+      /// \param y pointer to the \p n Q16.16 y-coordinates
+      /// \param out pointer to the \p n Q16.16 results
+      /// \param n the number of samples
+      void batch_raw_noise( const fixed_t* x,
+                            const fixed_t* y,
+                            fixed_t* out,
+                            std::size_t n ) noexcept;
+
+      /// \brief Generates 3-dimensional raw simplex noise for \p n samples
+      ///        at once
+      ///
+      /// \param x pointer to the \p n Q16.16 x-coordinates
+      /// \param y pointer to the \p n Q16.16 y-coordinates
+      /// \param z pointer to the \p n Q16.16 z-coordinates
+      /// \param out pointer to the \p n Q16.16 results
+      /// \param n the number of samples
+      void batch_raw_noise( const fixed_t* x,
+                            const fixed_t* y,
+                            const fixed_t* z,
+                            fixed_t* out,
+                            std::size_t n ) noexcept;
+
+    } // namespace fixed_simplex
+  } // namespace math
+} // namespace bit
+
+//----------------------------------------------------------------------------
+// Conversions
+//----------------------------------------------------------------------------
+
+inline bit::math::fixed_simplex::fixed_t
+  bit::math::fixed_simplex::to_fixed( float_t value )
+  noexcept
+{
+  // Scaling by a power of two and adding a half are both exact in double
+  // precision for any value in range
+  return static_cast<fixed_t>(
+    std::floor( static_cast<double>(value) * fixed_one + 0.5 )
+  );
+}
+
+inline bit::math::float_t
+  bit::math::fixed_simplex::to_float( fixed_t value )
+  noexcept
+{
+  return static_cast<float_t>( value ) / fixed_one;
+}
+
+#endif /* BIT_MATH_FIXED_SIMPLEX_HPP */
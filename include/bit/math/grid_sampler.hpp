@@ -0,0 +1,384 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains samplers that filter regular grids of
+ *        texels, such as heightmaps and signed distance fields
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  Bit Math Library.
+  https://github.com/bitwizeshift/bit-math
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_MATH_GRID_SAMPLER_HPP
+#define BIT_MATH_GRID_SAMPLER_HPP
+
+#include "math.hpp"          // bit::math::float_t
+#include "vector.hpp"        // bit::math::vec2, bit::math::vec3
+#include "interpolation.hpp" // bit::math::bilinear, bit::math::trilinear
+
+#include <algorithm> // std::min
+#include <cassert>   // assert
+#include <cmath>     // std::floor
+#include <cstddef>   // std::size_t, std::ptrdiff_t
+
+namespace bit {
+  namespace math {
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief How coordinates outside of a grid are mapped back onto it
+    //////////////////////////////////////////////////////////////////////////
+    enum class grid_address
+    {
+      clamp,  ///< Repeats the texels on the edge of the grid
+      wrap,   ///< Tiles the grid
+      mirror, ///< Tiles the grid, reflecting every other tile
+    };
+
+    namespace detail {
+
+      /// \brief The number of samples that the batch samplers address,
+      ///        fetch, and blend at a time
+      constexpr std::size_t grid_sampler_chunk = 64;
+
+      /// \brief Maps the texel index \p i onto a grid of \p size texels
+      ///
+      /// \param i the texel index
+      /// \param size the number of texels along the axis
+      /// \param address the addressing mode
+      /// \return the index of the texel within [0, size)
+      std::size_t address_texel( std::ptrdiff_t i,
+                                 std::size_t size,
+                                 grid_address address ) noexcept;
+
+      /// \brief Computes the addressed texels on either side of each of
+      ///        \p n coordinates along a single axis
+      ///
+      /// This is the lane-parallel kernel of the batch samplers; the
+      /// results are identical to address_texel for every coordinate
+      ///
+      /// \param coords pointer to the \p n coordinates
+      /// \param n the number of coordinates
+      /// \param size the number of texels along the axis
+      /// \param address the addressing mode
+      /// \param lo pointer to the \p n texels at or below each coordinate
+      /// \param hi pointer to the \p n texels above each coordinate
+      /// \param fraction pointer to the \p n distances from \p lo, in [0,1)
+      void address_texels( const float_t* coords,
+                           std::size_t n,
+                           std::size_t size,
+                           grid_address address,
+                           int* lo,
+                           int* hi,
+                           float_t* fraction ) noexcept;
+
+    } // namespace detail
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief Bilinearly filters a 2D grid of texels at continuous
+    ///        coordinates
+    ///
+    /// The sampler is a non-owning view over a row-major buffer of texels.
+    /// Texel (x,y) is centered on the integer coordinate (x,y), so sampling
+    /// at integer coordinates returns texels exactly. Coordinates outside of
+    /// the grid are mapped back onto it by the grid_address.
+    ///
+    /// Coordinates must be within +/-2^24, where every integer is exactly
+    /// representable as a float.
+    ///
+    /// \tparam T the type of the texels; float or half
+    //////////////////////////////////////////////////////////////////////////
+    template<typename T>
+    class grid_sampler_2d
+    {
+      //----------------------------------------------------------------------
+      // Public Types
+      //----------------------------------------------------------------------
+    public:
+
+      using texel_type = T;
+      using size_type  = std::size_t;
+
+      //----------------------------------------------------------------------
+      // Constructors
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a sampler over a \p width by \p height grid
+      ///
+      /// \pre \p width and \p height are non-zero and within the range of
+      ///      \c int
+      /// \pre \p row_stride >= \p width
+      ///
+      /// \param texels pointer to the first texel of the grid
+      /// \param width the number of texels in each row
+      /// \param height the number of rows
+      /// \param row_stride the number of texels from one row to the next
+      /// \param address the addressing mode of both axes
+      grid_sampler_2d( const T* texels,
+                       size_type width,
+                       size_type height,
+                       size_type row_stride,
+                       grid_address address = grid_address::clamp ) noexcept;
+
+      //----------------------------------------------------------------------
+      // Observers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets a pointer to the first texel of the grid
+      ///
+      /// \return pointer to the texels
+      const T* texels() const noexcept;
+
+      /// \brief Gets the number of texels in each row
+      ///
+      /// \return the width
+      size_type width() const noexcept;
+
+      /// \brief Gets the number of rows
+      ///
+      /// \return the height
+      size_type height() const noexcept;
+
+      /// \brief Gets the number of texels from one row to the next
+      ///
+      /// \return the row stride
+      size_type row_stride() const noexcept;
+
+      /// \brief Gets the addressing mode of this sampler
+      ///
+      /// \return the addressing mode
+      grid_address address() const noexcept;
+
+      //----------------------------------------------------------------------
+      // Sampling
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Fetches the texel at (\p x, \p y) after addressing
+      ///
+      /// \param x the column of the texel
+      /// \param y the row of the texel
+      /// \return the texel
+      float_t fetch( std::ptrdiff_t x, std::ptrdiff_t y ) const noexcept;
+
+      /// \brief Bilinearly samples the grid at (\p x, \p y)
+      ///
+      /// \param x the x-coordinate to sample
+      /// \param y the y-coordinate to sample
+      /// \return the filtered value
+      float_t sample( float_t x, float_t y ) const noexcept;
+
+      /// \brief Bilinearly samples the grid at \p p
+      ///
+      /// \param p the coordinate to sample
+      /// \return the filtered value
+      float_t sample( const vec2& p ) const noexcept;
+
+      /// \brief Bilinearly samples the grid at each of \p n coordinates
+      ///
+      /// The addressing and blending are computed in SIMD lanes, a chunk of
+      /// coordinates at a time. The results are equivalent to calling
+      /// sample( float_t, float_t ) for every coordinate.
+      ///
+      /// \param x pointer to the \p n x-coordinates
+      /// \param y pointer to the \p n y-coordinates
+      /// \param out pointer to the \p n results
+      /// \param n the number of samples
+      void sample( const float_t* x,
+                   const float_t* y,
+                   float_t* out,
+                   size_type n ) const noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      const T*     m_texels;
+      size_type    m_width;
+      size_type    m_height;
+      size_type    m_row_stride;
+      grid_address m_address;
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief Trilinearly filters a 3D grid of texels at continuous
+    ///        coordinates
+    ///
+    /// The sampler is a non-owning view over a buffer of row-major slices.
+    /// Texel (x,y,z) is centered on the integer coordinate (x,y,z), so
+    /// sampling at integer coordinates returns texels exactly. Coordinates
+    /// outside of the grid are mapped back onto it by the grid_address.
+    ///
+    /// Coordinates must be within +/-2^24, where every integer is exactly
+    /// representable as a float.
+    ///
+    /// \tparam T the type of the texels; float or half
+    //////////////////////////////////////////////////////////////////////////
+    template<typename T>
+    class grid_sampler_3d
+    {
+      //----------------------------------------------------------------------
+      // Public Types
+      //----------------------------------------------------------------------
+    public:
+
+      using texel_type = T;
+      using size_type  = std::size_t;
+
+      //----------------------------------------------------------------------
+      // Constructors
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a sampler over a \p width by \p height by
+      ///        \p depth grid
+      ///
+      /// \pre \p width, \p height and \p depth are non-zero and within the
+      ///      range of \c int
+      /// \pre \p row_stride >= \p width
+      /// \pre \p slice_stride >= \p row_stride * \p height
+      ///
+      /// \param texels pointer to the first texel of the grid
+      /// \param width the number of texels in each row
+      /// \param height the number of rows in each slice
+      /// \param depth the number of slices
+      /// \param row_stride the number of texels from one row to the next
+      /// \param slice_stride the number of texels from one slice to the next
+      /// \param address the addressing mode of all three axes
+      grid_sampler_3d( const T* texels,
+                       size_type width,
+                       size_type height,
+                       size_type depth,
+                       size_type row_stride,
+                       size_type slice_stride,
+                       grid_address address = grid_address::clamp ) noexcept;
+
+      //----------------------------------------------------------------------
+      // Observers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets a pointer to the first texel of the grid
+      ///
+      /// \return pointer to the texels
+      const T* texels() const noexcept;
+
+      /// \brief Gets the number of texels in each row
+      ///
+      /// \return the width
+      size_type width() const noexcept;
+
+      /// \brief Gets the number of rows in each slice
+      ///
+      /// \return the height
+      size_type height() const noexcept;
+
+      /// \brief Gets the number of slices
+      ///
+      /// \return the depth
+      size_type depth() const noexcept;
+
+      /// \brief Gets the number of texels from one row to the next
+      ///
+      /// \return the row stride
+      size_type row_stride() const noexcept;
+
+      /// \brief Gets the number of texels from one slice to the next
+      ///
+      /// \return the slice stride
+      size_type slice_stride() const noexcept;
+
+      /// \brief Gets the addressing mode of this sampler
+      ///
+      /// \return the addressing mode
+      grid_address address() const noexcept;
+
+      //----------------------------------------------------------------------
+      // Sampling
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Fetches the texel at (\p x, \p y, \p z) after addressing
+      ///
+      /// \param x the column of the texel
+      /// \param y the row of the texel
+      /// \param z the slice of the texel
+      /// \return the texel
+      float_t fetch( std::ptrdiff_t x,
+                     std::ptrdiff_t y,
+                     std::ptrdiff_t z ) const noexcept;
+
+      /// \brief Trilinearly samples the grid at (\p x, \p y, \p z)
+      ///
+      /// \param x the x-coordinate to sample
+      /// \param y the y-coordinate to sample
+      /// \param z the z-coordinate to sample
+      /// \return the filtered value
+      float_t sample( float_t x, float_t y, float_t z ) const noexcept;
+
+      /// \brief Trilinearly samples the grid at \p p
+      ///
+      /// \param p the coordinate to sample
+      /// \return the filtered value
+      float_t sample( const vec3& p ) const noexcept;
+
+      /// \brief Trilinearly samples the grid at each of \p n coordinates
+      ///
+      /// The addressing and blending are computed in SIMD lanes, a chunk of
+      /// coordinates at a time. The results are equivalent to calling
+      /// sample( float_t, float_t, float_t ) for every coordinate.
+      ///
+      /// \param x pointer to the \p n x-coordinates
+      /// \param y pointer to the \p n y-coordinates
+      /// \param z pointer to the \p n z-coordinates
+      /// \param out pointer to the \p n results
+      /// \param n the number of samples
+      void sample( const float_t* x,
+                   const float_t* y,
+                   const float_t* z,
+                   float_t* out,
+                   size_type n ) const noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      const T*     m_texels;
+      size_type    m_width;
+      size_type    m_height;
+      size_type    m_depth;
+      size_type    m_row_stride;
+      size_type    m_slice_stride;
+      grid_address m_address;
+    };
+
+  } // namespace math
+} // namespace bit
+
+#include "detail/grid_sampler.inl"
+
+#endif /* BIT_MATH_GRID_SAMPLER_HPP */
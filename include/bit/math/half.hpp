@@ -32,6 +32,9 @@
 #ifndef BIT_MATH_HALF_HPP
 #define BIT_MATH_HALF_HPP
 
+#include "math.hpp" // bit::math::float_t, bit::math::nan_policy
+
+#include <cstddef> // std::size_t
 #include <cstdint> // std::uint16_t, std::uint32_t
 #include <limits>  // std::numeric_limits
 #include <climits> // CHAR_BIT
@@ -281,6 +284,47 @@ namespace bit {
     /// \return a half
     half operator""_h( long double f ) noexcept;
 
+    //------------------------------------------------------------------------
+    // Batch Interpolation
+    //------------------------------------------------------------------------
+
+    namespace detail {
+
+      // Declared in 'interpolation.hpp'. Only the declaration is needed here,
+      // so that including half does not pull in the vector and interpolation
+      // headers
+      enum class easing;
+
+      // Kernels for the batch interpolation functions in 'interpolation.hpp'.
+      // The values are widened to float_t a chunk at a time, interpolated
+      // lane-parallel, and narrowed back to half
+
+      void interpolate_batch( easing e, const half* v0, const half* v1,
+                              const float_t* t, half* out,
+                              std::size_t n ) noexcept;
+      void interpolate_batch( easing e, const half* v0, const half* v1,
+                              float_t t, half* out,
+                              std::size_t n ) noexcept;
+
+    } // namespace detail
+
+    //------------------------------------------------------------------------
+    // Batch Clamping
+    //------------------------------------------------------------------------
+
+    /// \brief Clamps each of the \p n halves in \p in to \c [0,1]
+    ///
+    /// The values are widened to float a chunk at a time, saturated
+    /// lane-parallel, and narrowed back to half. \p in and \p out may be the
+    /// same array.
+    ///
+    /// \param in pointer to the \p n values to saturate
+    /// \param out pointer to the \p n saturated results
+    /// \param n the number of values
+    /// \param policy the result for NaN inputs
+    void saturate( const half* in, half* out, std::size_t n,
+                   nan_policy policy = nan_policy::propagate ) noexcept;
+
   } // namespace math
 } // namespace bit
 
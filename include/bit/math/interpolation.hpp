@@ -34,6 +34,9 @@
 
 #include "math.hpp"
 #include "angles.hpp"
+#include "vector.hpp" // bit::math::vector2, bit::math::vector3, bit::math::vector4
+
+#include <cstddef> // std::size_t
 
 namespace bit {
   namespace math {
@@ -83,7 +86,7 @@ namespace bit {
     /// \return the result of the interpolation
     template<typename V0, typename V1, typename T>
     constexpr std::common_type_t<V0,V1,T>
-      cubic( const V0& v0, const V0& v1, const T& t ) noexcept;
+      cubic( const V0& v0, const V1& v1, const T& t ) noexcept;
 
     /// \brief Quartically interpolates a point between \p v0 and \p v1 at
     ///        position \p t
@@ -94,7 +97,7 @@ namespace bit {
     /// \return the result of the interpolation
     template<typename V0, typename V1, typename T>
     constexpr std::common_type_t<V0,V1,T>
-      quartic( const V0& v0, const V0& v1, const T& t ) noexcept;
+      quartic( const V0& v0, const V1& v1, const T& t ) noexcept;
 
     /// \brief Performs quintic linear interpolation on a point between \p v0
     ///        and \p v1 at position \p t
@@ -105,7 +108,7 @@ namespace bit {
     /// \return the result of the interpolation
     template<typename V0, typename V1, typename T>
     constexpr std::common_type_t<V0,V1,T>
-      quintic( const V0& v0, const V0& v1, const T& t ) noexcept;
+      quintic( const V0& v0, const V1& v1, const T& t ) noexcept;
 
     //------------------------------------------------------------------------
 
@@ -118,7 +121,7 @@ namespace bit {
     /// \return the result of the interpolation
     template<typename V0, typename V1, typename T>
     std::common_type_t<V0,V1,T>
-      circular( const V0& v0, const V0& v1, const T& t ) noexcept;
+      circular( const V0& v0, const V1& v1, const T& t ) noexcept;
 
     //------------------------------------------------------------------------
 
@@ -131,7 +134,7 @@ namespace bit {
     /// \return the result of the interpolation
     template<typename V0, typename V1, typename T>
     std::common_type_t<V0,V1,T>
-      half_cosine( const V0& v0, const V0& v1, const T& t ) noexcept;
+      half_cosine( const V0& v0, const V1& v1, const T& t ) noexcept;
 
     /// \brief Performs cosine linear interpolation on a point between \p v0
     ///        and \p v1 at position \p t
@@ -142,7 +145,7 @@ namespace bit {
     /// \return the result of the interpolation
     template<typename V0, typename V1, typename T>
     std::common_type_t<V0,V1,T>
-      cosine( const V0& v0, const V0& v1, const T& t ) noexcept;
+      cosine( const V0& v0, const V1& v1, const T& t ) noexcept;
 
     //------------------------------------------------------------------------
 
@@ -155,7 +158,7 @@ namespace bit {
     /// \return the result of the interpolation
     template<typename V0, typename V1, typename T>
     std::common_type_t<V0,V1,T>
-      half_sine( const V0& v0, const V0& v1, const T& t ) noexcept;
+      half_sine( const V0& v0, const V1& v1, const T& t ) noexcept;
 
     /// \brief Performs sine linear interpolation on a point between \p v0
     ///        and \p v1 at position \p t
@@ -166,7 +169,7 @@ namespace bit {
     /// \return the result of the interpolation
     template<typename V0, typename V1, typename T>
     std::common_type_t<V0,V1,T>
-      sine( const V0& v0, const V0& v1, const T& t ) noexcept;
+      sine( const V0& v0, const V1& v1, const T& t ) noexcept;
 
     //------------------------------------------------------------------------
 
@@ -182,6 +185,321 @@ namespace bit {
                  const V001& v001, const V101& v101, const V011& v011, const V111& v111,
                  const Tx& tx, const Ty& ty, const Tz& tz ) noexcept;
 
+
+    //------------------------------------------------------------------------
+    // Batch Interpolation
+    //------------------------------------------------------------------------
+
+    // The following interpolate \p n values at once, and are each equivalent
+    // to calling the scalar function of the same name for every index. They
+    // are provided for float_t, vec2, vec3, vec4, and (from 'half.hpp') half.
+    //
+    // The overloads taking a pointer to \p t use a separate position for
+    // each value; the overloads taking a single \p t share it between all of
+    // the values.
+
+    namespace detail {
+
+      /// \brief The easing curves that the batch interpolation functions
+      ///        dispatch on
+      enum class easing
+      {
+        linear,
+        quadratic,
+        cubic,
+        quartic,
+        quintic,
+        circular,
+        half_cosine,
+        cosine,
+        half_sine,
+        sine,
+      };
+
+      // The lane-parallel kernels that every batch function forwards to.
+      // These are found through argument-dependent lookup on 'easing', which
+      // lets other headers (such as 'half.hpp') add overloads for their types
+
+      void interpolate_batch( easing e, const float_t* v0, const float_t* v1,
+                              const float_t* t, float_t* out,
+                              std::size_t n ) noexcept;
+      void interpolate_batch( easing e, const float_t* v0, const float_t* v1,
+                              float_t t, float_t* out,
+                              std::size_t n ) noexcept;
+
+      void interpolate_batch( easing e, const vec2* v0, const vec2* v1,
+                              const float_t* t, vec2* out,
+                              std::size_t n ) noexcept;
+      void interpolate_batch( easing e, const vec2* v0, const vec2* v1,
+                              float_t t, vec2* out,
+                              std::size_t n ) noexcept;
+
+      void interpolate_batch( easing e, const vec3* v0, const vec3* v1,
+                              const float_t* t, vec3* out,
+                              std::size_t n ) noexcept;
+      void interpolate_batch( easing e, const vec3* v0, const vec3* v1,
+                              float_t t, vec3* out,
+                              std::size_t n ) noexcept;
+
+      void interpolate_batch( easing e, const vec4* v0, const vec4* v1,
+                              const float_t* t, vec4* out,
+                              std::size_t n ) noexcept;
+      void interpolate_batch( easing e, const vec4* v0, const vec4* v1,
+                              float_t t, vec4* out,
+                              std::size_t n ) noexcept;
+
+    } // namespace detail
+
+    //------------------------------------------------------------------------
+
+    /// \brief Linearly interpolates \p n points between \p v0 and \p v1
+    ///
+    /// \param v0  Pointer to the \p n starting points
+    /// \param v1  Pointer to the \p n ending points
+    /// \param t   Pointer to the \p n positions to interpolate to [0,1]
+    /// \param out Pointer to the \p n results
+    /// \param n   The number of points
+    template<typename T>
+    void linear( const T* v0, const T* v1, const float_t* t,
+                 T* out, std::size_t n ) noexcept;
+
+    /// \brief Linearly interpolates \p n points between \p v0 and \p v1 at the
+    ///        same position \p t
+    ///
+    /// \param v0  Pointer to the \p n starting points
+    /// \param v1  Pointer to the \p n ending points
+    /// \param t   The position to interpolate to [0,1]
+    /// \param out Pointer to the \p n results
+    /// \param n   The number of points
+    template<typename T>
+    void linear( const T* v0, const T* v1, float_t t,
+                 T* out, std::size_t n ) noexcept;
+
+    //------------------------------------------------------------------------
+
+    /// \brief Quadratically interpolates \p n points between \p v0 and \p v1
+    ///
+    /// \param v0  Pointer to the \p n starting points
+    /// \param v1  Pointer to the \p n ending points
+    /// \param t   Pointer to the \p n positions to interpolate to [0,1]
+    /// \param out Pointer to the \p n results
+    /// \param n   The number of points
+    template<typename T>
+    void quadratic( const T* v0, const T* v1, const float_t* t,
+                    T* out, std::size_t n ) noexcept;
+
+    /// \brief Quadratically interpolates \p n points between \p v0 and \p v1 at the
+    ///        same position \p t
+    ///
+    /// \param v0  Pointer to the \p n starting points
+    /// \param v1  Pointer to the \p n ending points
+    /// \param t   The position to interpolate to [0,1]
+    /// \param out Pointer to the \p n results
+    /// \param n   The number of points
+    template<typename T>
+    void quadratic( const T* v0, const T* v1, float_t t,
+                    T* out, std::size_t n ) noexcept;
+
+    //------------------------------------------------------------------------
+
+    /// \brief Cubically interpolates \p n points between \p v0 and \p v1
+    ///
+    /// \param v0  Pointer to the \p n starting points
+    /// \param v1  Pointer to the \p n ending points
+    /// \param t   Pointer to the \p n positions to interpolate to [0,1]
+    /// \param out Pointer to the \p n results
+    /// \param n   The number of points
+    template<typename T>
+    void cubic( const T* v0, const T* v1, const float_t* t,
+                T* out, std::size_t n ) noexcept;
+
+    /// \brief Cubically interpolates \p n points between \p v0 and \p v1 at the
+    ///        same position \p t
+    ///
+    /// \param v0  Pointer to the \p n starting points
+    /// \param v1  Pointer to the \p n ending points
+    /// \param t   The position to interpolate to [0,1]
+    /// \param out Pointer to the \p n results
+    /// \param n   The number of points
+    template<typename T>
+    void cubic( const T* v0, const T* v1, float_t t,
+                T* out, std::size_t n ) noexcept;
+
+    //------------------------------------------------------------------------
+
+    /// \brief Quartically interpolates \p n points between \p v0 and \p v1
+    ///
+    /// \param v0  Pointer to the \p n starting points
+    /// \param v1  Pointer to the \p n ending points
+    /// \param t   Pointer to the \p n positions to interpolate to [0,1]
+    /// \param out Pointer to the \p n results
+    /// \param n   The number of points
+    template<typename T>
+    void quartic( const T* v0, const T* v1, const float_t* t,
+                  T* out, std::size_t n ) noexcept;
+
+    /// \brief Quartically interpolates \p n points between \p v0 and \p v1 at the
+    ///        same position \p t
+    ///
+    /// \param v0  Pointer to the \p n starting points
+    /// \param v1  Pointer to the \p n ending points
+    /// \param t   The position to interpolate to [0,1]
+    /// \param out Pointer to the \p n results
+    /// \param n   The number of points
+    template<typename T>
+    void quartic( const T* v0, const T* v1, float_t t,
+                  T* out, std::size_t n ) noexcept;
+
+    //------------------------------------------------------------------------
+
+    /// \brief Performs quintic interpolation between \p n points between \p v0 and \p v1
+    ///
+    /// \param v0  Pointer to the \p n starting points
+    /// \param v1  Pointer to the \p n ending points
+    /// \param t   Pointer to the \p n positions to interpolate to [0,1]
+    /// \param out Pointer to the \p n results
+    /// \param n   The number of points
+    template<typename T>
+    void quintic( const T* v0, const T* v1, const float_t* t,
+                  T* out, std::size_t n ) noexcept;
+
+    /// \brief Performs quintic interpolation between \p n points between \p v0 and \p v1 at the
+    ///        same position \p t
+    ///
+    /// \param v0  Pointer to the \p n starting points
+    /// \param v1  Pointer to the \p n ending points
+    /// \param t   The position to interpolate to [0,1]
+    /// \param out Pointer to the \p n results
+    /// \param n   The number of points
+    template<typename T>
+    void quintic( const T* v0, const T* v1, float_t t,
+                  T* out, std::size_t n ) noexcept;
+
+    //------------------------------------------------------------------------
+
+    /// \brief Performs circular interpolation between \p n points between \p v0 and \p v1
+    ///
+    /// \param v0  Pointer to the \p n starting points
+    /// \param v1  Pointer to the \p n ending points
+    /// \param t   Pointer to the \p n positions to interpolate to [0,1]
+    /// \param out Pointer to the \p n results
+    /// \param n   The number of points
+    template<typename T>
+    void circular( const T* v0, const T* v1, const float_t* t,
+                   T* out, std::size_t n ) noexcept;
+
+    /// \brief Performs circular interpolation between \p n points between \p v0 and \p v1 at the
+    ///        same position \p t
+    ///
+    /// \param v0  Pointer to the \p n starting points
+    /// \param v1  Pointer to the \p n ending points
+    /// \param t   The position to interpolate to [0,1]
+    /// \param out Pointer to the \p n results
+    /// \param n   The number of points
+    template<typename T>
+    void circular( const T* v0, const T* v1, float_t t,
+                   T* out, std::size_t n ) noexcept;
+
+    //------------------------------------------------------------------------
+
+    /// \brief Performs half-cosine interpolation between \p n points between \p v0 and \p v1
+    ///
+    /// \param v0  Pointer to the \p n starting points
+    /// \param v1  Pointer to the \p n ending points
+    /// \param t   Pointer to the \p n positions to interpolate to [0,1]
+    /// \param out Pointer to the \p n results
+    /// \param n   The number of points
+    template<typename T>
+    void half_cosine( const T* v0, const T* v1, const float_t* t,
+                      T* out, std::size_t n ) noexcept;
+
+    /// \brief Performs half-cosine interpolation between \p n points between \p v0 and \p v1 at the
+    ///        same position \p t
+    ///
+    /// \param v0  Pointer to the \p n starting points
+    /// \param v1  Pointer to the \p n ending points
+    /// \param t   The position to interpolate to [0,1]
+    /// \param out Pointer to the \p n results
+    /// \param n   The number of points
+    template<typename T>
+    void half_cosine( const T* v0, const T* v1, float_t t,
+                      T* out, std::size_t n ) noexcept;
+
+    //------------------------------------------------------------------------
+
+    /// \brief Performs cosine interpolation between \p n points between \p v0 and \p v1
+    ///
+    /// \param v0  Pointer to the \p n starting points
+    /// \param v1  Pointer to the \p n ending points
+    /// \param t   Pointer to the \p n positions to interpolate to [0,1]
+    /// \param out Pointer to the \p n results
+    /// \param n   The number of points
+    template<typename T>
+    void cosine( const T* v0, const T* v1, const float_t* t,
+                 T* out, std::size_t n ) noexcept;
+
+    /// \brief Performs cosine interpolation between \p n points between \p v0 and \p v1 at the
+    ///        same position \p t
+    ///
+    /// \param v0  Pointer to the \p n starting points
+    /// \param v1  Pointer to the \p n ending points
+    /// \param t   The position to interpolate to [0,1]
+    /// \param out Pointer to the \p n results
+    /// \param n   The number of points
+    template<typename T>
+    void cosine( const T* v0, const T* v1, float_t t,
+                 T* out, std::size_t n ) noexcept;
+
+    //------------------------------------------------------------------------
+
+    /// \brief Performs half-sine interpolation between \p n points between \p v0 and \p v1
+    ///
+    /// \param v0  Pointer to the \p n starting points
+    /// \param v1  Pointer to the \p n ending points
+    /// \param t   Pointer to the \p n positions to interpolate to [0,1]
+    /// \param out Pointer to the \p n results
+    /// \param n   The number of points
+    template<typename T>
+    void half_sine( const T* v0, const T* v1, const float_t* t,
+                    T* out, std::size_t n ) noexcept;
+
+    /// \brief Performs half-sine interpolation between \p n points between \p v0 and \p v1 at the
+    ///        same position \p t
+    ///
+    /// \param v0  Pointer to the \p n starting points
+    /// \param v1  Pointer to the \p n ending points
+    /// \param t   The position to interpolate to [0,1]
+    /// \param out Pointer to the \p n results
+    /// \param n   The number of points
+    template<typename T>
+    void half_sine( const T* v0, const T* v1, float_t t,
+                    T* out, std::size_t n ) noexcept;
+
+    //------------------------------------------------------------------------
+
+    /// \brief Performs sine interpolation between \p n points between \p v0 and \p v1
+    ///
+    /// \param v0  Pointer to the \p n starting points
+    /// \param v1  Pointer to the \p n ending points
+    /// \param t   Pointer to the \p n positions to interpolate to [0,1]
+    /// \param out Pointer to the \p n results
+    /// \param n   The number of points
+    template<typename T>
+    void sine( const T* v0, const T* v1, const float_t* t,
+               T* out, std::size_t n ) noexcept;
+
+    /// \brief Performs sine interpolation between \p n points between \p v0 and \p v1 at the
+    ///        same position \p t
+    ///
+    /// \param v0  Pointer to the \p n starting points
+    /// \param v1  Pointer to the \p n ending points
+    /// \param t   The position to interpolate to [0,1]
+    /// \param out Pointer to the \p n results
+    /// \param n   The number of points
+    template<typename T>
+    void sine( const T* v0, const T* v1, float_t t,
+               T* out, std::size_t n ) noexcept;
+
   } // namespace math
 } // namespace bit
 
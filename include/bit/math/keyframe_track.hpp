@@ -0,0 +1,318 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains a container of keyframes for animating values
+ *        over time
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  Bit Math Library.
+  https://github.com/bitwizeshift/bit-math
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_MATH_KEYFRAME_TRACK_HPP
+#define BIT_MATH_KEYFRAME_TRACK_HPP
+
+#include "math.hpp"          // bit::math::float_t
+#include "interpolation.hpp" // bit::math::linear, bit::math::cubic, ...
+
+#include <algorithm> // std::upper_bound
+#include <cassert>   // assert
+#include <cstddef>   // std::size_t
+#include <vector>    // std::vector
+
+namespace bit {
+  namespace math {
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief The interpolation used from one keyframe to the next
+    //////////////////////////////////////////////////////////////////////////
+    enum class keyframe_interpolation
+    {
+      linear,  ///< Interpolates with bit::math::linear
+      cubic,   ///< Interpolates with bit::math::cubic
+      quintic, ///< Interpolates with bit::math::quintic
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief The position of a sampler within a keyframe_track
+    ///
+    /// A cursor remembers the segment of the last sample, so that sampling
+    /// a track at increasing times only has to look at the next few keys
+    /// rather than search the whole track. Each sampler of a track should
+    /// own its own cursor.
+    //////////////////////////////////////////////////////////////////////////
+    class keyframe_cursor
+    {
+      //----------------------------------------------------------------------
+      // Constructors
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a cursor at the start of a track
+      constexpr keyframe_cursor() noexcept;
+
+      //----------------------------------------------------------------------
+      // Observers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the index of the key that starts the last sampled
+      ///        segment
+      ///
+      /// \return the segment index
+      constexpr std::size_t segment() const noexcept;
+
+      //----------------------------------------------------------------------
+      // Modifiers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Moves this cursor back to the start of the track
+      void reset() noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      std::size_t m_segment;
+
+      template<typename>
+      friend class keyframe_track;
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A sequence of values at increasing times, sampled by
+    ///        interpolating between adjacent keys
+    ///
+    /// The times and values are stored in separate contiguous arrays. Each
+    /// key chooses the interpolation used from it to the next key. Samples
+    /// before the first key or after the last key are clamped to that key's
+    /// value.
+    ///
+    /// \tparam T the type of the animated value. It must support
+    ///           \c T * float_t and \c T + T
+    //////////////////////////////////////////////////////////////////////////
+    template<typename T>
+    class keyframe_track
+    {
+      //----------------------------------------------------------------------
+      // Public Types
+      //----------------------------------------------------------------------
+    public:
+
+      using value_type = T;
+      using size_type  = std::size_t;
+
+      //----------------------------------------------------------------------
+      // Constructors
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a track with no keys
+      keyframe_track() = default;
+
+      /// \brief Copy-constructs a track from another track
+      ///
+      /// \param other the other track to copy
+      keyframe_track( const keyframe_track& other ) = default;
+
+      /// \brief Move-constructs a track from another track
+      ///
+      /// \param other the other track to move
+      keyframe_track( keyframe_track&& other ) noexcept = default;
+
+      //----------------------------------------------------------------------
+
+      /// \brief Copy-assigns a track from another track
+      ///
+      /// \param other the other track to copy
+      /// \return reference to \c (*this)
+      keyframe_track& operator=( const keyframe_track& other ) = default;
+
+      /// \brief Move-assigns a track from another track
+      ///
+      /// \param other the other track to move
+      /// \return reference to \c (*this)
+      keyframe_track& operator=( keyframe_track&& other ) noexcept = default;
+
+      //----------------------------------------------------------------------
+      // Modifiers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Reserves storage for \p n keys
+      ///
+      /// \param n the number of keys to reserve
+      void reserve( size_type n );
+
+      /// \brief Appends a key to the end of this track
+      ///
+      /// \pre \p time is greater than the time of every existing key
+      ///
+      /// \param time the time of the key
+      /// \param value the value at \p time
+      /// \param interpolation the interpolation used from this key to the
+      ///        next
+      void add_key( float_t time,
+                    const T& value,
+                    keyframe_interpolation interpolation = keyframe_interpolation::linear );
+
+      /// \brief Removes every key from this track
+      ///
+      /// \note Cursors into this track must be reset afterwards
+      void clear() noexcept;
+
+      //----------------------------------------------------------------------
+      // Observers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the number of keys in this track
+      ///
+      /// \return the number of keys
+      size_type size() const noexcept;
+
+      /// \brief Checks whether this track has no keys
+      ///
+      /// \return \c true if this track has no keys
+      bool empty() const noexcept;
+
+      /// \brief Gets a pointer to the contiguous times of the keys
+      ///
+      /// \return pointer to the size() key times
+      const float_t* times() const noexcept;
+
+      /// \brief Gets a pointer to the contiguous values of the keys
+      ///
+      /// \return pointer to the size() key values
+      const T* values() const noexcept;
+
+      /// \brief Gets the interpolation used from the \p n th key to the next
+      ///
+      /// \param n the index of the key
+      /// \return the interpolation
+      keyframe_interpolation interpolation( size_type n ) const noexcept;
+
+      //----------------------------------------------------------------------
+      // Sampling
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Finds the segment containing \p time with a binary search
+      ///
+      /// The segment is the index of the last key at or before \p time,
+      /// limited to the last key that has a following key
+      ///
+      /// \param time the time to find
+      /// \return the index of the key starting the segment
+      size_type find_segment( float_t time ) const noexcept;
+
+      /// \brief Finds the segment containing \p time, starting from the
+      ///        segment of \p cursor
+      ///
+      /// This takes amortized constant time when \p time increases between
+      /// calls, and falls back to a binary search otherwise. The result is
+      /// always identical to find_segment( float_t ).
+      ///
+      /// \param time the time to find
+      /// \param cursor the cursor of the sampler; updated to the segment
+      /// \return the index of the key starting the segment
+      size_type find_segment( float_t time,
+                              keyframe_cursor& cursor ) const noexcept;
+
+      /// \brief Samples this track at \p time
+      ///
+      /// \pre !empty()
+      ///
+      /// \param time the time to sample
+      /// \return the sampled value
+      T sample( float_t time ) const noexcept;
+
+      /// \brief Samples this track at \p time, starting from the segment of
+      ///        \p cursor
+      ///
+      /// \pre !empty()
+      ///
+      /// \param time the time to sample
+      /// \param cursor the cursor of the sampler; updated to the segment
+      /// \return the sampled value
+      T sample( float_t time, keyframe_cursor& cursor ) const noexcept;
+
+      /// \brief Samples this track at each of \p n times
+      ///
+      /// The samples share a cursor, so increasing \p times are sampled in
+      /// amortized constant time each
+      ///
+      /// \pre !empty()
+      ///
+      /// \param times pointer to the \p n times to sample
+      /// \param out pointer to the \p n results
+      /// \param n the number of samples
+      void sample( const float_t* times, T* out, size_type n ) const noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Member Functions
+      //----------------------------------------------------------------------
+    private:
+
+      /// \brief Interpolates within the segment starting at key \p segment
+      T sample_segment( size_type segment, float_t time ) const noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      std::vector<float_t> m_times;
+      std::vector<T>       m_values;
+      std::vector<keyframe_interpolation> m_interpolations;
+    };
+
+    //------------------------------------------------------------------------
+    // Batch Sampling
+    //------------------------------------------------------------------------
+
+    /// \brief Samples \p n tracks at the same \p time
+    ///
+    /// \pre none of the tracks are empty
+    ///
+    /// \param tracks pointer to the \p n tracks
+    /// \param cursors pointer to the \p n cursors, one per track
+    /// \param time the time to sample
+    /// \param out pointer to the \p n results
+    /// \param n the number of tracks
+    template<typename T>
+    void sample_tracks( const keyframe_track<T>* tracks,
+                        keyframe_cursor* cursors,
+                        float_t time,
+                        T* out,
+                        std::size_t n ) noexcept;
+
+  } // namespace math
+} // namespace bit
+
+#include "detail/keyframe_track.inl"
+
+#endif /* BIT_MATH_KEYFRAME_TRACK_HPP */
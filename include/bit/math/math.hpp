@@ -33,6 +33,7 @@
 #define BIT_MATH_MATH_HPP
 
 #include <cmath>
+#include <cstddef>
 #include <type_traits>
 #include <utility>
 
@@ -245,6 +246,77 @@ namespace bit {
     template<typename Float>
     constexpr Float saturate( Float val ) noexcept;
 
+    //------------------------------------------------------------------------
+    // Batch Clamping
+    //------------------------------------------------------------------------
+
+    /// \brief The treatment of NaN inputs by the batch clamping functions
+    ///
+    /// Vectorized min/max do not agree on NaN operands across instruction
+    /// sets, so each batch function tests for NaN explicitly and applies one
+    /// of these policies instead
+    enum class nan_policy
+    {
+      propagate, ///< NaN inputs produce NaN, as with the scalar functions
+      lower,     ///< NaN inputs produce the lower bound, or \c out_lo for remap
+      zero,      ///< NaN inputs produce zero
+    };
+
+    // The following process \p n values at once, and are each equivalent to
+    // calling the scalar function of the same name for every index, aside
+    // from the handling of NaN. \p in and \p out may be the same array.
+
+    /// \brief Clamps each of the \p n values in \p in to [\p lo, \p hi]
+    ///
+    /// \pre \p lo <= \p hi
+    ///
+    /// \param in pointer to the \p n values to clamp
+    /// \param out pointer to the \p n clamped results
+    /// \param n the number of values
+    /// \param lo the lower bound
+    /// \param hi the upper bound
+    /// \param policy the result for NaN inputs
+    void clamp( const float* in, float* out, std::size_t n,
+                float lo, float hi,
+                nan_policy policy = nan_policy::propagate ) noexcept;
+    void clamp( const double* in, double* out, std::size_t n,
+                double lo, double hi,
+                nan_policy policy = nan_policy::propagate ) noexcept;
+
+    /// \brief Clamps each of the \p n values in \p in to \c [0,1]
+    ///
+    /// \param in pointer to the \p n values to saturate
+    /// \param out pointer to the \p n saturated results
+    /// \param n the number of values
+    /// \param policy the result for NaN inputs
+    void saturate( const float* in, float* out, std::size_t n,
+                   nan_policy policy = nan_policy::propagate ) noexcept;
+    void saturate( const double* in, double* out, std::size_t n,
+                   nan_policy policy = nan_policy::propagate ) noexcept;
+
+    /// \brief Linearly maps each of the \p n values in \p in from
+    ///        [\p in_lo, \p in_hi] onto [\p out_lo, \p out_hi]
+    ///
+    /// Values outside of the input range are clamped to it first, so every
+    /// result lies within the output range. Either range may be reversed.
+    ///
+    /// \pre \p in_lo != \p in_hi
+    ///
+    /// \param in pointer to the \p n values to remap
+    /// \param out pointer to the \p n remapped results
+    /// \param n the number of values
+    /// \param in_lo the value that maps to \p out_lo
+    /// \param in_hi the value that maps to \p out_hi
+    /// \param out_lo the lower bound of the output
+    /// \param out_hi the upper bound of the output
+    /// \param policy the result for NaN inputs
+    void remap( const float* in, float* out, std::size_t n,
+                float in_lo, float in_hi, float out_lo, float out_hi,
+                nan_policy policy = nan_policy::propagate ) noexcept;
+    void remap( const double* in, double* out, std::size_t n,
+                double in_lo, double in_hi, double out_lo, double out_hi,
+                nan_policy policy = nan_policy::propagate ) noexcept;
+
     //========================================================================
     // Floating Point Math
     //========================================================================
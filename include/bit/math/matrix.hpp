@@ -68,9 +68,11 @@ namespace bit {
 
     // Optimize the common case by pre-instantiating the matrix
 
+#ifndef BIT_MATH_MATRIX_INSTANTIATION
     extern template class matrix2<float_t>;
     extern template class matrix3<float_t>;
     extern template class matrix4<float_t>;
+#endif
 
     using mat2 = matrix2<float_t>;
     using mat3 = matrix3<float_t>;
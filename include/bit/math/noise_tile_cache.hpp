@@ -0,0 +1,257 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains a disk-backed cache of simplex noise tiles
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  Bit Math Library.
+  https://github.com/bitwizeshift/bit-math
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_MATH_NOISE_TILE_CACHE_HPP
+#define BIT_MATH_NOISE_TILE_CACHE_HPP
+
+// bit::map library
+#include "simplex.hpp" // bit::math::simplex_generator, bit::math::octave_schedule
+
+#include <cstddef>       // std::size_t
+#include <cstdint>       // std::int32_t, std::uint64_t
+#include <unordered_map> // std::unordered_map
+
+namespace bit {
+  namespace math {
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A memory-mapped file of precomputed octave noise tiles
+    ///
+    /// A tile is a square of tile_size() x tile_size() samples of
+    /// \c simplex_generator::octave_noise, taken at integer coordinates
+    /// starting from <tt>(tile_x, tile_y) * tile_size()</tt>, and stored in
+    /// row-major order.
+    ///
+    /// Tiles are keyed by the generator's seed, the octave schedule, and the
+    /// tile coordinate. They are kept in a file that is mapped into memory,
+    /// so that tiles generated by an earlier process are served without being
+    /// regenerated, and cached tiles are returned without being copied.
+    ///
+    /// The file never grows beyond the size cap given on construction. When
+    /// it is full, the least recently used tile is evicted to make room.
+    ///
+    /// An empty or newly created file is initialized as a cache file. A cache
+    /// file whose layout does not match the requested tile size, capacity,
+    /// or float_t has its tiles discarded. Any other file is rejected, so
+    /// that passing the wrong path never overwrites an unrelated file.
+    ///
+    /// A cache file is owned by a single noise_tile_cache for its lifetime.
+    /// The file is locked on construction, and opening it again, from this or
+    /// any other process, fails until the owner is destroyed.
+    ///
+    /// \note This type is not thread-safe.
+    //////////////////////////////////////////////////////////////////////////
+    class noise_tile_cache
+    {
+      //----------------------------------------------------------------------
+      // Constructors / Destructor / Assignment
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Opens or creates the cache file at \p path
+      ///
+      /// \throw std::invalid_argument if \p max_bytes cannot hold a single
+      ///        tile of \p tile_size, or if \p path names a non-empty file
+      ///        that is not a cache file
+      /// \throw std::system_error if the file cannot be opened, locked, or
+      ///        mapped, or if it is already owned by another noise_tile_cache
+      ///
+      /// \param path the path to the cache file
+      /// \param tile_size the number of samples along each edge of a tile
+      /// \param max_bytes the maximum size of the cache file, in bytes
+      noise_tile_cache( const char* path,
+                        std::size_t tile_size,
+                        std::size_t max_bytes );
+
+      noise_tile_cache( const noise_tile_cache& other ) = delete;
+
+      noise_tile_cache( noise_tile_cache&& other ) = delete;
+
+      //----------------------------------------------------------------------
+
+      /// \brief Unmaps and closes the cache file
+      ~noise_tile_cache();
+
+      //----------------------------------------------------------------------
+
+      noise_tile_cache& operator=( const noise_tile_cache& other ) = delete;
+
+      noise_tile_cache& operator=( noise_tile_cache&& other ) = delete;
+
+      //----------------------------------------------------------------------
+      // Tiles
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the tile at (\p tile_x, \p tile_y), generating it on a
+      ///        cache miss
+      ///
+      /// \note The returned pointer refers directly into the mapped file. It
+      ///       remains valid until the next call to tile() or until the cache
+      ///       is destroyed, whichever comes first.
+      ///
+      /// \throw std::bad_alloc if the tile cannot be indexed
+      ///
+      /// \param generator the generator to sample
+      /// \param schedule the octaves to sample
+      /// \param tile_x the x-coordinate of the tile
+      /// \param tile_y the y-coordinate of the tile
+      /// \return pointer to the tile_size() * tile_size() samples
+      const float_t* tile( const simplex_generator& generator,
+                           const octave_schedule& schedule,
+                           std::int32_t tile_x,
+                           std::int32_t tile_y );
+
+      /// \brief Checks whether the tile at (\p tile_x, \p tile_y) is cached
+      ///
+      /// \param generator the generator to sample
+      /// \param schedule the octaves to sample
+      /// \param tile_x the x-coordinate of the tile
+      /// \param tile_y the y-coordinate of the tile
+      /// \return \c true if the tile is cached
+      bool contains( const simplex_generator& generator,
+                     const octave_schedule& schedule,
+                     std::int32_t tile_x,
+                     std::int32_t tile_y ) const noexcept;
+
+      /// \brief Writes all cached tiles back to the file
+      ///
+      /// \throw std::system_error if the file cannot be synchronized
+      void flush();
+
+      //----------------------------------------------------------------------
+      // Observers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the number of samples along each edge of a tile
+      ///
+      /// \return the tile size
+      std::size_t tile_size() const noexcept;
+
+      /// \brief Gets the maximum number of tiles that can be cached
+      ///
+      /// \return the capacity
+      std::size_t capacity() const noexcept;
+
+      /// \brief Gets the number of tiles currently cached
+      ///
+      /// \return the number of cached tiles
+      std::size_t size() const noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Member Types
+      //----------------------------------------------------------------------
+    private:
+
+      struct tile_key
+      {
+        std::uint64_t seed;
+        std::uint64_t schedule;
+        std::int32_t  x;
+        std::int32_t  y;
+      };
+
+      struct tile_key_hash
+      {
+        std::size_t operator()( const tile_key& key ) const noexcept;
+      };
+
+      struct tile_key_equal
+      {
+        bool operator()( const tile_key& lhs,
+                         const tile_key& rhs ) const noexcept;
+      };
+
+      using slot_map = std::unordered_map<tile_key,std::size_t,
+                                          tile_key_hash,tile_key_equal>;
+
+      //----------------------------------------------------------------------
+      // Private Member Functions
+      //----------------------------------------------------------------------
+    private:
+
+      static tile_key make_key( const simplex_generator& generator,
+                                const octave_schedule& schedule,
+                                std::int32_t tile_x,
+                                std::int32_t tile_y ) noexcept;
+
+      /// \brief Maps the opened cache file, initializing it if it is empty
+      ///        or has a different layout, and indexes its cached tiles
+      void open_mapping();
+
+      /// \brief Gets the slot to store a new tile in, evicting the least
+      ///        recently used tile if the cache is full
+      std::size_t acquire_slot() noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      int         m_file;
+      void*       m_mapping;
+      std::size_t m_mapping_size;
+      std::size_t m_tile_size;
+      std::size_t m_capacity;
+      slot_map    m_slots; ///< the slot of each cached tile
+    };
+
+  } // namespace math
+} // namespace bit
+
+//============================================================================
+// noise_tile_cache
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Observers
+//----------------------------------------------------------------------------
+
+inline std::size_t bit::math::noise_tile_cache::tile_size()
+  const noexcept
+{
+  return m_tile_size;
+}
+
+inline std::size_t bit::math::noise_tile_cache::capacity()
+  const noexcept
+{
+  return m_capacity;
+}
+
+inline std::size_t bit::math::noise_tile_cache::size()
+  const noexcept
+{
+  return m_slots.size();
+}
+
+#endif /* BIT_MATH_NOISE_TILE_CACHE_HPP */
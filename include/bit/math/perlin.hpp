@@ -0,0 +1,242 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains algorithms for classic Perlin noise generation
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  Bit Math Library.
+  https://github.com/bitwizeshift/bit-math
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_MATH_PERLIN_HPP
+#define BIT_MATH_PERLIN_HPP
+
+// bit::map library
+#include "vector.hpp" // bit::math::vector2, bit::math::vector3
+
+#include <cstddef> // std::size_t
+
+namespace bit {
+  namespace math {
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief Classic gradient noise, interpolated across the corners of a
+    ///        square (or cube) lattice
+    ///
+    /// This uses the same permutation table and gradients as
+    /// \c bit::math::simplex, with Perlin's quintic fade curve. Classic noise
+    /// evaluates 4 (or 8) corners rather than 3 (or 4), but is smooth in a
+    /// way that is aligned to the lattice, which some effects rely on.
+    //////////////////////////////////////////////////////////////////////////
+    namespace perlin {
+
+      //----------------------------------------------------------------------
+      // Raw Noise
+      //----------------------------------------------------------------------
+
+      /// \brief Generates 2-dimensional classic Perlin noise
+      ///
+      /// \param x the x-coordinate
+      /// \param y the y-coordinate
+      /// \return the result of the raw noise, in the range [-1,1]
+      float_t raw_noise( float_t x, float_t y ) noexcept;
+
+      /// \brief Generates 3-dimensional classic Perlin noise
+      ///
+      /// \param x the x-coordinate
+      /// \param y the y-coordinate
+      /// \param z the z-coordinate
+      /// \return the result of the raw noise, in the range [-1,1]
+      float_t raw_noise( float_t x, float_t y, float_t z ) noexcept;
+
+      float_t raw_noise( const vec2& pos ) noexcept;
+
+      float_t raw_noise( const vec3& pos ) noexcept;
+
+      //----------------------------------------------------------------------
+
+      /// \brief Generates 2-dimensional classic Perlin noise for \p n
+      ///        samples at once
+      ///
+      /// Samples are evaluated across SIMD lanes, as in
+      /// \c simplex::batch_raw_noise
+      ///
+      /// \param x pointer to the \p n x-coordinates
+      /// \param y pointer to the \p n y-coordinates
+      /// \param out pointer to the \p n results
+      /// \param n the number of samples
+      void batch_raw_noise( const float_t* x,
+                            const float_t* y,
+                            float_t* out,
+                            std::size_t n ) noexcept;
+
+      //----------------------------------------------------------------------
+      // Octave Noise
+      //----------------------------------------------------------------------
+
+      /// \brief Generates 2-dimensional octave Perlin noise
+      ///
+      /// \param octaves the number of octaves to sum
+      /// \param persistence the amplitude multiplier for each octave
+      /// \param scale the frequency of the first octave
+      /// \param x the x-coordinate
+      /// \param y the y-coordinate
+      /// \return the result of the octave noise, in the range [-1,1]
+      float_t octave_noise( float_t octaves,
+                            float_t persistence,
+                            float_t scale,
+                            float_t x,
+                            float_t y ) noexcept;
+
+      /// \brief Generates 3-dimensional octave Perlin noise
+      ///
+      /// \param octaves the number of octaves to sum
+      /// \param persistence the amplitude multiplier for each octave
+      /// \param scale the frequency of the first octave
+      /// \param x the x-coordinate
+      /// \param y the y-coordinate
+      /// \param z the z-coordinate
+      /// \return the result of the octave noise, in the range [-1,1]
+      float_t octave_noise( float_t octaves,
+                            float_t persistence,
+                            float_t scale,
+                            float_t x,
+                            float_t y,
+                            float_t z ) noexcept;
+
+      float_t octave_noise( float_t octaves,
+                            float_t persistence,
+                            float_t scale,
+                            const vec2& pos ) noexcept;
+
+      float_t octave_noise( float_t octaves,
+                            float_t persistence,
+                            float_t scale,
+                            const vec3& pos ) noexcept;
+
+      //----------------------------------------------------------------------
+      // Grid Fill
+      //----------------------------------------------------------------------
+
+      /// \brief Fills a 2-dimensional grid with octave Perlin noise
+      ///
+      /// The sample at column \c c and row \c r is written to
+      /// \c out[r * width + c], and is equal to
+      /// \c octave_noise(octaves,persistence,scale,origin + step * (c,r)).
+      ///
+      /// Rows are evaluated across SIMD lanes, so samples may differ from
+      /// the scalar octave_noise in the last few bits.
+      ///
+      /// \param origin the position of the first sample
+      /// \param step the distance between adjacent samples on each axis
+      /// \param width the number of samples along the x-axis
+      /// \param height the number of samples along the y-axis
+      /// \param octaves the number of octaves to sum
+      /// \param persistence the amplitude multiplier for each octave
+      /// \param scale the frequency of the first octave
+      /// \param out the buffer to write to; must hold width * height samples
+      void fill_grid_2d( const vec2& origin,
+                         const vec2& step,
+                         std::size_t width,
+                         std::size_t height,
+                         float_t octaves,
+                         float_t persistence,
+                         float_t scale,
+                         float_t* out ) noexcept;
+
+      /// \brief Fills a 3-dimensional grid with octave Perlin noise
+      ///
+      /// The sample at column \c c, row \c r and slice \c s is written to
+      /// \c out[(s * height + r) * width + c], and is equal to
+      /// \c octave_noise(octaves,persistence,scale,origin + step * (c,r,s)).
+      ///
+      /// \param origin the position of the first sample
+      /// \param step the distance between adjacent samples on each axis
+      /// \param width the number of samples along the x-axis
+      /// \param height the number of samples along the y-axis
+      /// \param depth the number of samples along the z-axis
+      /// \param octaves the number of octaves to sum
+      /// \param persistence the amplitude multiplier for each octave
+      /// \param scale the frequency of the first octave
+      /// \param out the buffer to write to; must hold
+      ///            width * height * depth samples
+      void fill_grid_3d( const vec3& origin,
+                         const vec3& step,
+                         std::size_t width,
+                         std::size_t height,
+                         std::size_t depth,
+                         float_t octaves,
+                         float_t persistence,
+                         float_t scale,
+                         float_t* out ) noexcept;
+
+    } // namespace perlin
+  } // namespace math
+} // namespace bit
+
+//----------------------------------------------------------------------------
+// Raw Noise
+//----------------------------------------------------------------------------
+
+inline bit::math::float_t bit::math::perlin::raw_noise( const vec2& pos )
+  noexcept
+{
+  return raw_noise( pos.x(), pos.y() );
+}
+
+//----------------------------------------------------------------------------
+
+inline bit::math::float_t bit::math::perlin::raw_noise( const vec3& pos )
+  noexcept
+{
+  return raw_noise( pos.x(), pos.y(), pos.z() );
+}
+
+//----------------------------------------------------------------------------
+// Octave Noise
+//----------------------------------------------------------------------------
+
+inline bit::math::float_t
+  bit::math::perlin::octave_noise( float_t octaves,
+                                   float_t persistence,
+                                   float_t scale,
+                                   const vec2& pos )
+  noexcept
+{
+  return octave_noise( octaves, persistence, scale, pos.x(), pos.y() );
+}
+
+//----------------------------------------------------------------------------
+
+inline bit::math::float_t
+  bit::math::perlin::octave_noise( float_t octaves,
+                                   float_t persistence,
+                                   float_t scale,
+                                   const vec3& pos )
+  noexcept
+{
+  return octave_noise( octaves, persistence, scale,
+                       pos.x(), pos.y(), pos.z() );
+}
+
+#endif /* BIT_MATH_PERLIN_HPP */
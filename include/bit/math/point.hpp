@@ -34,7 +34,7 @@
 #define BIT_MATH_DETAIL_GEOMETRY_POINT_HPP
 
 // bit::math library
-#include "../vector.hpp"
+#include "vector.hpp"
 
 // std library
 #include <cstddef> // std::size_t, std::ptrdiff_t
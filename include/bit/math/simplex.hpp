@@ -33,12 +33,125 @@
 #define BIT_MATH_SIMPLEX_HPP
 
 // bit::map library
-#include "vector.hpp" // bit::math::vector2, bit::math::vector3
+#include "vector.hpp" // bit::math::vector2, bit::math::vector3, bit::math::vector4
 
 #include <cassert> // assert
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint8_t, std::uint64_t
+#include <vector>  // std::vector
 
 namespace bit {
   namespace math {
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A precomputed set of octaves for octave noise
+    ///
+    /// octave_noise recomputes the frequency, amplitude and normalization of
+    /// every octave on each call. An octave_schedule computes these once so
+    /// that they may be reused for any number of samples.
+    ///
+    /// A schedule may optionally be given a quantum, which is the size of
+    /// the buckets that the output is ultimately quantized to (for example
+    /// \c 2/255 for 8-bit output). Octaves then stop being accumulated as
+    /// soon as the remaining octaves can no longer move the sample out of its
+    /// current bucket \c floor((n+1)/quantum) . Without a quantum, every
+    /// octave is accumulated and the result is identical to octave_noise.
+    ///
+    /// A schedule holds at most \ref max_octaves octaves. The requested
+    /// number of octaves is clamped to \c [0,max_octaves] , so a larger
+    /// count is truncated and a negative one yields an empty schedule.
+    //////////////////////////////////////////////////////////////////////////
+    class octave_schedule
+    {
+      //----------------------------------------------------------------------
+      // Public Constants
+      //----------------------------------------------------------------------
+    public:
+
+      /// The maximum number of octaves in a schedule
+      static constexpr std::size_t max_octaves = 32;
+
+      //----------------------------------------------------------------------
+      // Constructors
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a schedule that accumulates every octave
+      ///
+      /// \param octaves the number of octaves to sum
+      /// \param persistence the amplitude multiplier for each octave
+      /// \param scale the frequency of the first octave
+      octave_schedule( float_t octaves,
+                       float_t persistence,
+                       float_t scale ) noexcept;
+
+      /// \brief Constructs a schedule that stops accumulating octaves once
+      ///        the result can no longer leave its quantization bucket
+      ///
+      /// \param octaves the number of octaves to sum
+      /// \param persistence the amplitude multiplier for each octave
+      /// \param scale the frequency of the first octave
+      /// \param quantum the size of the quantization buckets, or 0 to
+      ///        accumulate every octave
+      octave_schedule( float_t octaves,
+                       float_t persistence,
+                       float_t scale,
+                       float_t quantum ) noexcept;
+
+      //----------------------------------------------------------------------
+      // Observers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the number of octaves in this schedule
+      ///
+      /// \return the number of octaves
+      std::size_t octaves() const noexcept;
+
+      /// \brief Gets the frequency of the \p octave'th octave
+      ///
+      /// \param octave the index of the octave
+      /// \return the frequency
+      float_t frequency( std::size_t octave ) const noexcept;
+
+      /// \brief Gets the amplitude of the \p octave'th octave
+      ///
+      /// \param octave the index of the octave
+      /// \return the amplitude, before normalization
+      float_t amplitude( std::size_t octave ) const noexcept;
+
+      /// \brief Gets the sum of all amplitudes, which the accumulated octaves
+      ///        are divided by
+      ///
+      /// \return the maximum amplitude
+      float_t max_amplitude() const noexcept;
+
+      /// \brief Gets the size of the quantization buckets
+      ///
+      /// \return the quantum, or 0 if early termination is disabled
+      float_t quantum() const noexcept;
+
+      /// \brief Determines whether the octaves after \p octave can no longer
+      ///        change the quantized result
+      ///
+      /// \param octave the index of the last accumulated octave
+      /// \param total the un-normalized sum of octaves [0, octave]
+      /// \return \c true if no further octaves need to be accumulated
+      bool is_settled( std::size_t octave, float_t total ) const noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      float_t     m_frequencies[max_octaves];
+      float_t     m_amplitudes[max_octaves];
+      float_t     m_remaining[max_octaves]; ///< amplitude after each octave
+      std::size_t m_octaves;
+      float_t     m_max_amplitude;
+      float_t     m_quantum;
+    };
+
     namespace simplex {
 
       //----------------------------------------------------------------------
@@ -60,6 +173,17 @@ namespace bit {
       /// \return the result of the raw noise
       float_t raw_noise( float_t x, float_t y, float_t z ) noexcept;
 
+      /// \brief Generates 4-dimensional raw simplex noise
+      ///
+      /// The 4th dimension is commonly used as time to animate volumes
+      ///
+      /// \param x the x-coordinate
+      /// \param y the y-coordinate
+      /// \param z the z-coordinate
+      /// \param w the w-coordinate
+      /// \return the result of the raw noise
+      float_t raw_noise( float_t x, float_t y, float_t z, float_t w ) noexcept;
+
       //----------------------------------------------------------------------
 
       /// \brief Generates 2-dimensional raw simplex noise
@@ -74,6 +198,30 @@ namespace bit {
       /// \return the result of the raw noise
       float_t raw_noise( const vec3& pos ) noexcept;
 
+      /// \brief Generates 4-dimensional raw simplex noise
+      ///
+      /// \param pos the 4-dimensional vector position
+      /// \return the result of the raw noise
+      float_t raw_noise( const vec4& pos ) noexcept;
+
+      //----------------------------------------------------------------------
+
+      /// \brief Generates 2-dimensional raw simplex noise for a batch of
+      ///        sample points
+      ///
+      /// Samples are evaluated several at a time across SIMD lanes (4 with
+      /// SSE2, 8 with AVX2) using masks rather than branches. Results match
+      /// the scalar \ref raw_noise to within floating-point tolerance.
+      ///
+      /// \param x the x-coordinates of each sample
+      /// \param y the y-coordinates of each sample
+      /// \param out the buffer to write the \p n results to
+      /// \param n the number of samples
+      void batch_raw_noise( const float_t* x,
+                            const float_t* y,
+                            float_t* out,
+                            std::size_t n ) noexcept;
+
       //----------------------------------------------------------------------
       // Raw Scaled Noise
       //----------------------------------------------------------------------
@@ -89,6 +237,13 @@ namespace bit {
                                 float_t y,
                                 float_t z ) noexcept;
 
+      float_t scaled_raw_noise( float_t low,
+                                float_t high,
+                                float_t x,
+                                float_t y,
+                                float_t z,
+                                float_t w ) noexcept;
+
       //----------------------------------------------------------------------
 
       float_t scaled_raw_noise( float_t low, float_t high,
@@ -97,6 +252,9 @@ namespace bit {
       float_t scaled_raw_noise( float_t low, float_t high,
                                 const vec3& pos ) noexcept;
 
+      float_t scaled_raw_noise( float_t low, float_t high,
+                                const vec4& pos ) noexcept;
+
       //----------------------------------------------------------------------
       // Octave Noise
       //----------------------------------------------------------------------
@@ -114,6 +272,14 @@ namespace bit {
                             float_t y,
                             float_t z ) noexcept;
 
+      float_t octave_noise( float_t octaves,
+                            float_t persistence,
+                            float_t scale,
+                            float_t x,
+                            float_t y,
+                            float_t z,
+                            float_t w ) noexcept;
+
       //----------------------------------------------------------------------
 
       float_t octave_noise( float_t octaves,
@@ -126,46 +292,778 @@ namespace bit {
                             float_t scale,
                             const vec3& pos ) noexcept;
 
+      float_t octave_noise( float_t octaves,
+                            float_t persistence,
+                            float_t scale,
+                            const vec4& pos ) noexcept;
+
+      //----------------------------------------------------------------------
+
+      /// \brief Generates 2-dimensional octave noise from a precomputed
+      ///        schedule
+      ///
+      /// \param schedule the octaves to accumulate
+      /// \param x the x-coordinate
+      /// \param y the y-coordinate
+      /// \return the result of the octave noise
+      float_t octave_noise( const octave_schedule& schedule,
+                            float_t x,
+                            float_t y ) noexcept;
+
+      /// \brief Generates 3-dimensional octave noise from a precomputed
+      ///        schedule
+      ///
+      /// \param schedule the octaves to accumulate
+      /// \param x the x-coordinate
+      /// \param y the y-coordinate
+      /// \param z the z-coordinate
+      /// \return the result of the octave noise
+      float_t octave_noise( const octave_schedule& schedule,
+                            float_t x,
+                            float_t y,
+                            float_t z ) noexcept;
+
+      /// \brief Generates 4-dimensional octave noise from a precomputed
+      ///        schedule
+      ///
+      /// \param schedule the octaves to accumulate
+      /// \param x the x-coordinate
+      /// \param y the y-coordinate
+      /// \param z the z-coordinate
+      /// \param w the w-coordinate
+      /// \return the result of the octave noise
+      float_t octave_noise( const octave_schedule& schedule,
+                            float_t x,
+                            float_t y,
+                            float_t z,
+                            float_t w ) noexcept;
+
+      float_t octave_noise( const octave_schedule& schedule,
+                            const vec2& pos ) noexcept;
+
+      float_t octave_noise( const octave_schedule& schedule,
+                            const vec3& pos ) noexcept;
+
+      float_t octave_noise( const octave_schedule& schedule,
+                            const vec4& pos ) noexcept;
+
+      //----------------------------------------------------------------------
+
+      /// \brief Generates 2-dimensional octave noise for \p n samples at once
+      ///
+      /// Each octave is evaluated across SIMD lanes as in batch_raw_noise.
+      /// With early termination, a set of lanes stops once every lane in
+      /// it has settled.
+      ///
+      /// \param schedule the octaves to accumulate
+      /// \param x pointer to the \p n x-coordinates
+      /// \param y pointer to the \p n y-coordinates
+      /// \param out pointer to the \p n results
+      /// \param n the number of samples
+      void batch_octave_noise( const octave_schedule& schedule,
+                               const float_t* x,
+                               const float_t* y,
+                               float_t* out,
+                               std::size_t n ) noexcept;
+
       //----------------------------------------------------------------------
       // Scaled Octave Noise
       //----------------------------------------------------------------------
 
-      float_t scaled_octave_noise( float_t octaves,
-                                   float_t persistence,
-                                   float_t scale,
-                                   float_t low,
-                                   float_t high,
-                                   float_t x,
-                                   float_t y ) noexcept;
+      float_t scaled_octave_noise( float_t octaves,
+                                   float_t persistence,
+                                   float_t scale,
+                                   float_t low,
+                                   float_t high,
+                                   float_t x,
+                                   float_t y ) noexcept;
+
+      float_t scaled_octave_noise( float_t octaves,
+                                   float_t persistence,
+                                   float_t scale,
+                                   float_t low,
+                                   float_t high,
+                                   float_t x,
+                                   float_t y,
+                                   float_t z ) noexcept;
+
+      float_t scaled_octave_noise( float_t octaves,
+                                   float_t persistence,
+                                   float_t scale,
+                                   float_t low,
+                                   float_t high,
+                                   float_t x,
+                                   float_t y,
+                                   float_t z,
+                                   float_t w ) noexcept;
+
+      //----------------------------------------------------------------------
+
+      float_t scaled_octave_noise( float_t octaves,
+                                   float_t persistence,
+                                   float_t scale,
+                                   float_t low,
+                                   float_t high,
+                                   const vec2& pos ) noexcept;
+
+      float_t scaled_octave_noise( float_t octaves,
+                                   float_t persistence,
+                                   float_t scale,
+                                   float_t low,
+                                   float_t high,
+                                   const vec3& pos ) noexcept;
+
+      float_t scaled_octave_noise( float_t octaves,
+                                   float_t persistence,
+                                   float_t scale,
+                                   float_t low,
+                                   float_t high,
+                                   const vec4& pos ) noexcept;
+
+      //----------------------------------------------------------------------
+      // Noise Gradients
+      //----------------------------------------------------------------------
+
+      /// \brief Generates 2-dimensional raw simplex noise along with its
+      ///        analytic gradient
+      ///
+      /// The gradient is computed from the same evaluation as the noise,
+      /// which is cheaper and more accurate than finite differences.
+      ///
+      /// \param x the x-coordinate
+      /// \param y the y-coordinate
+      /// \param gradient pointer to the vector to receive the gradient
+      /// \return the result of the raw noise
+      float_t raw_noise_with_gradient( float_t x, float_t y,
+                                       vec2* gradient ) noexcept;
+
+      /// \brief Generates 3-dimensional raw simplex noise along with its
+      ///        analytic gradient
+      ///
+      /// \param x the x-coordinate
+      /// \param y the y-coordinate
+      /// \param z the z-coordinate
+      /// \param gradient pointer to the vector to receive the gradient
+      /// \return the result of the raw noise
+      float_t raw_noise_with_gradient( float_t x, float_t y, float_t z,
+                                       vec3* gradient ) noexcept;
+
+      float_t raw_noise_with_gradient( const vec2& pos,
+                                       vec2* gradient ) noexcept;
+
+      float_t raw_noise_with_gradient( const vec3& pos,
+                                       vec3* gradient ) noexcept;
+
+      //----------------------------------------------------------------------
+
+      /// \brief Generates 2-dimensional octave noise along with its analytic
+      ///        gradient
+      ///
+      /// \param octaves the number of octaves to sum
+      /// \param persistence the amplitude multiplier for each octave
+      /// \param scale the frequency of the first octave
+      /// \param x the x-coordinate
+      /// \param y the y-coordinate
+      /// \param gradient pointer to the vector to receive the gradient
+      /// \return the result of the octave noise
+      float_t octave_noise_with_gradient( float_t octaves,
+                                          float_t persistence,
+                                          float_t scale,
+                                          float_t x,
+                                          float_t y,
+                                          vec2* gradient ) noexcept;
+
+      /// \brief Generates 3-dimensional octave noise along with its analytic
+      ///        gradient
+      ///
+      /// \param octaves the number of octaves to sum
+      /// \param persistence the amplitude multiplier for each octave
+      /// \param scale the frequency of the first octave
+      /// \param x the x-coordinate
+      /// \param y the y-coordinate
+      /// \param z the z-coordinate
+      /// \param gradient pointer to the vector to receive the gradient
+      /// \return the result of the octave noise
+      float_t octave_noise_with_gradient( float_t octaves,
+                                          float_t persistence,
+                                          float_t scale,
+                                          float_t x,
+                                          float_t y,
+                                          float_t z,
+                                          vec3* gradient ) noexcept;
+
+      float_t octave_noise_with_gradient( float_t octaves,
+                                          float_t persistence,
+                                          float_t scale,
+                                          const vec2& pos,
+                                          vec2* gradient ) noexcept;
+
+      float_t octave_noise_with_gradient( float_t octaves,
+                                          float_t persistence,
+                                          float_t scale,
+                                          const vec3& pos,
+                                          vec3* gradient ) noexcept;
+
+      //----------------------------------------------------------------------
+      // Grid Fill
+      //----------------------------------------------------------------------
+
+      /// \brief Fills a 2-dimensional grid with octave noise
+      ///
+      /// The sample at column \c c and row \c r is written to
+      /// \c out[r * width + c], and matches
+      /// \c octave_noise(octaves,persistence,scale,origin + step * (c,r))
+      /// to within floating-point tolerance.
+      ///
+      /// The octave setup is computed once for the entire grid, and each row
+      /// is evaluated one octave at a time across SIMD lanes, as in
+      /// batch_raw_noise, so that per-row terms are only computed once.
+      ///
+      /// \param origin the position of the first sample
+      /// \param step the distance between adjacent samples on each axis
+      /// \param width the number of samples along the x-axis
+      /// \param height the number of samples along the y-axis
+      /// \param octaves the number of octaves to sum
+      /// \param persistence the amplitude multiplier for each octave
+      /// \param scale the frequency of the first octave
+      /// \param out the buffer to write to; must hold width * height samples
+      void fill_grid_2d( const vec2& origin,
+                         const vec2& step,
+                         std::size_t width,
+                         std::size_t height,
+                         float_t octaves,
+                         float_t persistence,
+                         float_t scale,
+                         float_t* out ) noexcept;
+
+      /// \brief Fills a 3-dimensional grid with octave noise
+      ///
+      /// The sample at column \c c, row \c r and slice \c s is written to
+      /// \c out[(s * height + r) * width + c], and matches
+      /// \c octave_noise(octaves,persistence,scale,origin + step * (c,r,s))
+      /// to within floating-point tolerance. Rows are evaluated across SIMD
+      /// lanes as in \ref fill_grid_2d.
+      ///
+      /// \param origin the position of the first sample
+      /// \param step the distance between adjacent samples on each axis
+      /// \param width the number of samples along the x-axis
+      /// \param height the number of samples along the y-axis
+      /// \param depth the number of samples along the z-axis
+      /// \param octaves the number of octaves to sum
+      /// \param persistence the amplitude multiplier for each octave
+      /// \param scale the frequency of the first octave
+      /// \param out the buffer to write to; must hold
+      ///            width * height * depth samples
+      void fill_grid_3d( const vec3& origin,
+                         const vec3& step,
+                         std::size_t width,
+                         std::size_t height,
+                         std::size_t depth,
+                         float_t octaves,
+                         float_t persistence,
+                         float_t scale,
+                         float_t* out ) noexcept;
+
+      //----------------------------------------------------------------------
+      // Parallel Grid Fill
+      //----------------------------------------------------------------------
+
+      /// \brief Fills a 2-dimensional grid with octave noise using multiple
+      ///        threads
+      ///
+      /// The grid is split into cache-sized tiles which are distributed
+      /// across the workers; idle workers steal tiles from busy ones. Each
+      /// tile writes a disjoint region of \p out, so the result is identical
+      /// to \ref fill_grid_2d regardless of the number of threads.
+      ///
+      /// The workers are a pool of threads that is started by the first
+      /// parallel fill and reused by later ones. A fill that is called while
+      /// another parallel fill is running runs on the calling thread alone.
+      ///
+      /// \param origin the position of the first sample
+      /// \param step the distance between adjacent samples on each axis
+      /// \param width the number of samples along the x-axis
+      /// \param height the number of samples along the y-axis
+      /// \param octaves the number of octaves to sum
+      /// \param persistence the amplitude multiplier for each octave
+      /// \param scale the frequency of the first octave
+      /// \param out the buffer to write to; must hold width * height samples
+      /// \param threads the number of threads to use, including the calling
+      ///                thread. 0 uses the hardware concurrency
+      void parallel_fill_grid_2d( const vec2& origin,
+                                  const vec2& step,
+                                  std::size_t width,
+                                  std::size_t height,
+                                  float_t octaves,
+                                  float_t persistence,
+                                  float_t scale,
+                                  float_t* out,
+                                  std::size_t threads = 0 );
+
+      /// \brief Fills a 3-dimensional grid with octave noise using multiple
+      ///        threads
+      ///
+      /// The result is identical to \ref fill_grid_3d regardless of the
+      /// number of threads.
+      ///
+      /// \param origin the position of the first sample
+      /// \param step the distance between adjacent samples on each axis
+      /// \param width the number of samples along the x-axis
+      /// \param height the number of samples along the y-axis
+      /// \param depth the number of samples along the z-axis
+      /// \param octaves the number of octaves to sum
+      /// \param persistence the amplitude multiplier for each octave
+      /// \param scale the frequency of the first octave
+      /// \param out the buffer to write to; must hold
+      ///            width * height * depth samples
+      /// \param threads the number of threads to use, including the calling
+      ///                thread. 0 uses the hardware concurrency
+      void parallel_fill_grid_3d( const vec3& origin,
+                                  const vec3& step,
+                                  std::size_t width,
+                                  std::size_t height,
+                                  std::size_t depth,
+                                  float_t octaves,
+                                  float_t persistence,
+                                  float_t scale,
+                                  float_t* out,
+                                  std::size_t threads = 0 );
+
+    } // namespace simplex
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A seeded source of simplex noise
+    ///
+    /// The free functions in \c bit::math::simplex all share a single fixed
+    /// permutation table, so every caller observes the same noise. Each
+    /// simplex_generator instead builds its own permutation and gradient
+    /// tables from a 64-bit seed, allowing independent worlds and layers to
+    /// produce uncorrelated noise without offsetting coordinates.
+    ///
+    /// Both tables are 256 bytes and are indexed with a mask, rather than
+    /// through a duplicated 512-entry integer table. The tables are aligned
+    /// to a cache line so that together they occupy exactly 8 cache lines;
+    /// the seed, which noise evaluation never reads, follows them on a ninth.
+    /// Generators allocated with operator new before C++17 may not be
+    /// aligned.
+    ///
+    /// A generator is immutable after construction; all noise functions are
+    /// \c const and may be called concurrently from multiple threads.
+    //////////////////////////////////////////////////////////////////////////
+    class simplex_generator
+    {
+      //----------------------------------------------------------------------
+      // Constructors
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a generator whose tables are shuffled by \p seed
+      ///
+      /// \param seed the seed for the permutation and gradient tables
+      explicit simplex_generator( std::uint64_t seed ) noexcept;
+
+      simplex_generator( const simplex_generator& other ) noexcept = default;
+
+      simplex_generator( simplex_generator&& other ) noexcept = default;
+
+      //----------------------------------------------------------------------
+
+      simplex_generator& operator=( const simplex_generator& other ) noexcept = default;
+
+      simplex_generator& operator=( simplex_generator&& other ) noexcept = default;
+
+      //----------------------------------------------------------------------
+      // Observers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the seed this generator was constructed with
+      ///
+      /// \return the seed
+      std::uint64_t seed() const noexcept;
+
+      //----------------------------------------------------------------------
+      // Raw Noise
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Generates 2-dimensional raw simplex noise
+      ///
+      /// \param x the x-coordinate
+      /// \param y the y-coordinate
+      /// \return the result of the raw noise
+      float_t raw_noise( float_t x, float_t y ) const noexcept;
+
+      /// \brief Generates 3-dimensional raw simplex noise
+      ///
+      /// \param x the x-coordinate
+      /// \param y the y-coordinate
+      /// \param z the z-coordinate
+      /// \return the result of the raw noise
+      float_t raw_noise( float_t x, float_t y, float_t z ) const noexcept;
+
+      /// \brief Generates 4-dimensional raw simplex noise
+      ///
+      /// \param x the x-coordinate
+      /// \param y the y-coordinate
+      /// \param z the z-coordinate
+      /// \param w the w-coordinate
+      /// \return the result of the raw noise
+      float_t raw_noise( float_t x, float_t y, float_t z, float_t w ) const noexcept;
+
+      float_t raw_noise( const vec2& pos ) const noexcept;
+      float_t raw_noise( const vec3& pos ) const noexcept;
+      float_t raw_noise( const vec4& pos ) const noexcept;
+
+      //----------------------------------------------------------------------
+      // Octave Noise
+      //----------------------------------------------------------------------
+    public:
+
+      float_t octave_noise( float_t octaves,
+                            float_t persistence,
+                            float_t scale,
+                            float_t x,
+                            float_t y ) const noexcept;
+
+      float_t octave_noise( float_t octaves,
+                            float_t persistence,
+                            float_t scale,
+                            float_t x,
+                            float_t y,
+                            float_t z ) const noexcept;
+
+      float_t octave_noise( float_t octaves,
+                            float_t persistence,
+                            float_t scale,
+                            float_t x,
+                            float_t y,
+                            float_t z,
+                            float_t w ) const noexcept;
+
+      float_t octave_noise( float_t octaves,
+                            float_t persistence,
+                            float_t scale,
+                            const vec2& pos ) const noexcept;
+
+      float_t octave_noise( float_t octaves,
+                            float_t persistence,
+                            float_t scale,
+                            const vec3& pos ) const noexcept;
+
+      float_t octave_noise( float_t octaves,
+                            float_t persistence,
+                            float_t scale,
+                            const vec4& pos ) const noexcept;
+
+      float_t octave_noise( const octave_schedule& schedule,
+                            float_t x,
+                            float_t y ) const noexcept;
+
+      float_t octave_noise( const octave_schedule& schedule,
+                            float_t x,
+                            float_t y,
+                            float_t z ) const noexcept;
+
+      float_t octave_noise( const octave_schedule& schedule,
+                            float_t x,
+                            float_t y,
+                            float_t z,
+                            float_t w ) const noexcept;
+
+      float_t octave_noise( const octave_schedule& schedule,
+                            const vec2& pos ) const noexcept;
+
+      float_t octave_noise( const octave_schedule& schedule,
+                            const vec3& pos ) const noexcept;
+
+      float_t octave_noise( const octave_schedule& schedule,
+                            const vec4& pos ) const noexcept;
+
+      //----------------------------------------------------------------------
+      // Noise Gradients
+      //----------------------------------------------------------------------
+    public:
+
+      float_t raw_noise_with_gradient( float_t x, float_t y,
+                                       vec2* gradient ) const noexcept;
+
+      float_t raw_noise_with_gradient( float_t x, float_t y, float_t z,
+                                       vec3* gradient ) const noexcept;
+
+      float_t octave_noise_with_gradient( float_t octaves,
+                                          float_t persistence,
+                                          float_t scale,
+                                          float_t x,
+                                          float_t y,
+                                          vec2* gradient ) const noexcept;
+
+      float_t octave_noise_with_gradient( float_t octaves,
+                                          float_t persistence,
+                                          float_t scale,
+                                          float_t x,
+                                          float_t y,
+                                          float_t z,
+                                          vec3* gradient ) const noexcept;
+
+      //----------------------------------------------------------------------
+      // Grid Fill
+      //----------------------------------------------------------------------
+    public:
+
+      /// \copydoc simplex::fill_grid_2d
+      void fill_grid_2d( const vec2& origin,
+                         const vec2& step,
+                         std::size_t width,
+                         std::size_t height,
+                         float_t octaves,
+                         float_t persistence,
+                         float_t scale,
+                         float_t* out ) const noexcept;
+
+      /// \copydoc simplex::fill_grid_3d
+      void fill_grid_3d( const vec3& origin,
+                         const vec3& step,
+                         std::size_t width,
+                         std::size_t height,
+                         std::size_t depth,
+                         float_t octaves,
+                         float_t persistence,
+                         float_t scale,
+                         float_t* out ) const noexcept;
+
+      /// \copydoc simplex::parallel_fill_grid_2d
+      void parallel_fill_grid_2d( const vec2& origin,
+                                  const vec2& step,
+                                  std::size_t width,
+                                  std::size_t height,
+                                  float_t octaves,
+                                  float_t persistence,
+                                  float_t scale,
+                                  float_t* out,
+                                  std::size_t threads = 0 ) const;
+
+      /// \copydoc simplex::parallel_fill_grid_3d
+      void parallel_fill_grid_3d( const vec3& origin,
+                                  const vec3& step,
+                                  std::size_t width,
+                                  std::size_t height,
+                                  std::size_t depth,
+                                  float_t octaves,
+                                  float_t persistence,
+                                  float_t scale,
+                                  float_t* out,
+                                  std::size_t threads = 0 ) const;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      alignas(64) std::uint8_t m_permutation[256]; ///< shuffled lattice hash
+      std::uint8_t             m_gradients[256];   ///< m_permutation modulo 12
+      std::uint64_t            m_seed;
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A fused pipeline of domain warps followed by a fractal sum of
+    ///        2-dimensional simplex noise
+    ///
+    /// Each warp stage offsets the sample coordinates by a pair of octave
+    /// noises evaluated at the current coordinates, producing the
+    /// characteristic swirled look of noise-of-noise. The warped coordinates
+    /// are then summed with one of the fractal types.
+    ///
+    /// Every stage is applied to a sample before the next sample is started,
+    /// so the coordinates never leave registers between stages. The batch
+    /// overload of \ref evaluate does the same across SIMD lanes.
+    ///
+    /// The quantum of the schedules is not used, since warping can amplify
+    /// arbitrarily small differences in the warp offsets.
+    ///
+    /// Only the warp stages that have been added are stored, so a pipeline
+    /// without warps holds just its final schedule. A pipeline holds at most
+    /// \ref max_warps stages; any warp added beyond that is ignored.
+    //////////////////////////////////////////////////////////////////////////
+    class noise_pipeline
+    {
+      //----------------------------------------------------------------------
+      // Public Types
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief The fractal sum computed by the final stage
+      enum class fractal
+      {
+        fbm,    ///< fractional brownian motion; the sum of the octaves
+        ridged, ///< ridged multifractal; sharp ridges along the zero-crossings
+        billow, ///< the sum of absolute octaves; rounded, cloud-like lumps
+      };
+
+      //----------------------------------------------------------------------
+      // Public Constants
+      //----------------------------------------------------------------------
+    public:
+
+      /// The maximum number of warp stages in a pipeline
+      static constexpr std::size_t max_warps = 4;
+
+      //----------------------------------------------------------------------
+      // Constructors
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a pipeline without any warps
+      ///
+      /// \param schedule the octaves of the final fractal stage
+      /// \param type the fractal sum of the final stage
+      explicit noise_pipeline( const octave_schedule& schedule,
+                               fractal type = fractal::fbm ) noexcept;
+
+      //----------------------------------------------------------------------
+      // Modifiers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Appends a domain warp stage to this pipeline
+      ///
+      /// Warps are applied in the order they are added, each to the
+      /// coordinates produced by the previous warp. If the pipeline already
+      /// holds \ref max_warps stages, the warp is ignored
+      ///
+      /// \param schedule the octaves of the warp offsets
+      /// \param strength the distance the coordinates are offset by
+      /// \return reference to \c (*this)
+      /// \throw std::bad_alloc if the stage cannot be stored
+      noise_pipeline& add_warp( const octave_schedule& schedule,
+                                float_t strength );
+
+      //----------------------------------------------------------------------
+      // Observers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the fractal sum of the final stage
+      ///
+      /// \return the fractal type
+      fractal type() const noexcept;
+
+      /// \brief Gets the octaves of the final stage
+      ///
+      /// \return the schedule
+      const octave_schedule& schedule() const noexcept;
+
+      /// \brief Gets the number of warp stages
+      ///
+      /// \return the number of warps
+      std::size_t warps() const noexcept;
+
+      /// \brief Gets the octaves of the \p warp'th warp stage
+      ///
+      /// \param warp the index of the warp
+      /// \return the schedule
+      const octave_schedule& warp_schedule( std::size_t warp ) const noexcept;
+
+      /// \brief Gets the strength of the \p warp'th warp stage
+      ///
+      /// \param warp the index of the warp
+      /// \return the strength
+      float_t warp_strength( std::size_t warp ) const noexcept;
+
+      //----------------------------------------------------------------------
+      // Evaluation
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Evaluates this pipeline at a single position
+      ///
+      /// \param x the x-coordinate
+      /// \param y the y-coordinate
+      /// \return the result of the pipeline, in the range [-1,1]
+      float_t evaluate( float_t x, float_t y ) const noexcept;
+
+      /// \brief Evaluates this pipeline at a single position
+      ///
+      /// \param pos the 2-dimensional vector position
+      /// \return the result of the pipeline, in the range [-1,1]
+      float_t evaluate( const vec2& pos ) const noexcept;
+
+      /// \brief Evaluates this pipeline for \p n samples at once
+      ///
+      /// \param x pointer to the \p n x-coordinates
+      /// \param y pointer to the \p n y-coordinates
+      /// \param out pointer to the \p n results
+      /// \param n the number of samples
+      void evaluate( const float_t* x,
+                     const float_t* y,
+                     float_t* out,
+                     std::size_t n ) const noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      struct warp_stage
+      {
+        octave_schedule schedule;
+        float_t         strength;
+      };
+
+      octave_schedule         m_schedule;
+      fractal                 m_type;
+      std::vector<warp_stage> m_warps;
+    };
+  } // namespace math
+} // namespace bit
+
+//============================================================================
+// octave_schedule
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Observers
+//----------------------------------------------------------------------------
+
+inline std::size_t bit::math::octave_schedule::octaves()
+  const noexcept
+{
+  return m_octaves;
+}
+
+inline bit::math::float_t
+  bit::math::octave_schedule::frequency( std::size_t octave )
+  const noexcept
+{
+  assert( octave < m_octaves && "octave out of range" );
+
+  return m_frequencies[octave];
+}
 
-      float_t scaled_octave_noise( float_t octaves,
-                                   float_t persistence,
-                                   float_t scale,
-                                   float_t low,
-                                   float_t high,
-                                   float_t x,
-                                   float_t y,
-                                   float_t z ) noexcept;
+inline bit::math::float_t
+  bit::math::octave_schedule::amplitude( std::size_t octave )
+  const noexcept
+{
+  assert( octave < m_octaves && "octave out of range" );
 
-      //----------------------------------------------------------------------
+  return m_amplitudes[octave];
+}
 
-      float_t scaled_octave_noise( float_t octaves,
-                                   float_t persistence,
-                                   float_t scale,
-                                   float_t low,
-                                   float_t high,
-                                   const vec2& pos ) noexcept;
+inline bit::math::float_t bit::math::octave_schedule::max_amplitude()
+  const noexcept
+{
+  return m_max_amplitude;
+}
 
-      float_t scaled_octave_noise( float_t octaves,
-                                   float_t persistence,
-                                   float_t scale,
-                                   float_t low,
-                                   float_t high,
-                                   const vec3& pos ) noexcept;
+inline bit::math::float_t bit::math::octave_schedule::quantum()
+  const noexcept
+{
+  return m_quantum;
+}
 
-    } // namespace simplex
-  } // namespace math
-} // namespace bit
+//============================================================================
+// simplex
+//============================================================================
 
 //----------------------------------------------------------------------------
 // Raw Noise
@@ -187,6 +1085,15 @@ inline bit::math::float_t
   return raw_noise( pos.x(), pos.y(), pos.z() );
 }
 
+//----------------------------------------------------------------------------
+
+inline bit::math::float_t
+  bit::math::simplex::raw_noise( const vec4& pos )
+  noexcept
+{
+  return raw_noise( pos.x(), pos.y(), pos.z(), pos.w() );
+}
+
 //----------------------------------------------------------------------------
 // Raw Scaled Noise
 //----------------------------------------------------------------------------
@@ -219,6 +1126,21 @@ inline bit::math::float_t
 
 //----------------------------------------------------------------------------
 
+inline bit::math::float_t
+  bit::math::simplex::scaled_raw_noise( float_t low, float_t high,
+                                        float_t x, float_t y,
+                                        float_t z, float_t w )
+  noexcept
+{
+  assert( low < high && "Low must be less than high" );
+
+  const auto c1 = ((high - low) * 0.5);
+  const auto c2 = ((high + low) * 0.5);
+  return c1 * raw_noise(x, y, z, w) + c2;
+}
+
+//----------------------------------------------------------------------------
+
 inline bit::math::float_t
   bit::math::simplex::scaled_raw_noise( float_t low, float_t high,
                                         const vec2& pos )
@@ -237,6 +1159,16 @@ inline bit::math::float_t
   return scaled_raw_noise( low, high, pos.x(), pos.y(), pos.z() );
 }
 
+//----------------------------------------------------------------------------
+
+inline bit::math::float_t
+  bit::math::simplex::scaled_raw_noise( float_t low, float_t high,
+                                        const vec4& pos )
+  noexcept
+{
+  return scaled_raw_noise( low, high, pos.x(), pos.y(), pos.z(), pos.w() );
+}
+
 //----------------------------------------------------------------------------
 // Octave Noise
 //----------------------------------------------------------------------------
@@ -263,6 +1195,49 @@ inline bit::math::float_t
   return octave_noise( octaves, persistence, scale, pos.x(), pos.y(), pos.z() );
 }
 
+//----------------------------------------------------------------------------
+
+inline bit::math::float_t
+  bit::math::simplex::octave_noise( float_t octaves,
+                                    float_t persistence,
+                                    float_t scale,
+                                    const vec4& pos )
+  noexcept
+{
+  return octave_noise( octaves, persistence, scale,
+                       pos.x(), pos.y(), pos.z(), pos.w() );
+}
+
+//----------------------------------------------------------------------------
+
+inline bit::math::float_t
+  bit::math::simplex::octave_noise( const octave_schedule& schedule,
+                                    const vec2& pos )
+  noexcept
+{
+  return octave_noise( schedule, pos.x(), pos.y() );
+}
+
+//----------------------------------------------------------------------------
+
+inline bit::math::float_t
+  bit::math::simplex::octave_noise( const octave_schedule& schedule,
+                                    const vec3& pos )
+  noexcept
+{
+  return octave_noise( schedule, pos.x(), pos.y(), pos.z() );
+}
+
+//----------------------------------------------------------------------------
+
+inline bit::math::float_t
+  bit::math::simplex::octave_noise( const octave_schedule& schedule,
+                                    const vec4& pos )
+  noexcept
+{
+  return octave_noise( schedule, pos.x(), pos.y(), pos.z(), pos.w() );
+}
+
 //----------------------------------------------------------------------------
 // Scaled Octave Noise
 //----------------------------------------------------------------------------
@@ -307,6 +1282,27 @@ inline bit::math::float_t
 
 //----------------------------------------------------------------------------
 
+inline bit::math::float_t
+  bit::math::simplex::scaled_octave_noise( float_t octaves,
+                                           float_t persistence,
+                                           float_t scale,
+                                           float_t low,
+                                           float_t high,
+                                           float_t x,
+                                           float_t y,
+                                           float_t z,
+                                           float_t w )
+  noexcept
+{
+  assert( low < high && "Low must be less than high" );
+
+  const auto c1 = ((high - low) * 0.5);
+  const auto c2 = ((high + low) * 0.5);
+  return c1 * octave_noise( octaves, persistence, scale, x, y, z, w ) + c2;
+}
+
+//----------------------------------------------------------------------------
+
 inline bit::math::float_t
   bit::math::simplex::scaled_octave_noise( float_t octaves,
                                            float_t persistence,
@@ -335,5 +1331,238 @@ inline bit::math::float_t
                               low, high, pos.x(), pos.y(), pos.z() );
 }
 
+//----------------------------------------------------------------------------
+
+inline bit::math::float_t
+  bit::math::simplex::scaled_octave_noise( float_t octaves,
+                                           float_t persistence,
+                                           float_t scale,
+                                           float_t low,
+                                           float_t high,
+                                           const vec4& pos )
+  noexcept
+{
+  return scaled_octave_noise( octaves, persistence, scale,
+                              low, high, pos.x(), pos.y(), pos.z(), pos.w() );
+}
+
+//----------------------------------------------------------------------------
+// Noise Gradients
+//----------------------------------------------------------------------------
+
+inline bit::math::float_t
+  bit::math::simplex::raw_noise_with_gradient( const vec2& pos,
+                                               vec2* gradient )
+  noexcept
+{
+  return raw_noise_with_gradient( pos.x(), pos.y(), gradient );
+}
+
+//----------------------------------------------------------------------------
+
+inline bit::math::float_t
+  bit::math::simplex::raw_noise_with_gradient( const vec3& pos,
+                                               vec3* gradient )
+  noexcept
+{
+  return raw_noise_with_gradient( pos.x(), pos.y(), pos.z(), gradient );
+}
+
+//----------------------------------------------------------------------------
+
+inline bit::math::float_t
+  bit::math::simplex::octave_noise_with_gradient( float_t octaves,
+                                                  float_t persistence,
+                                                  float_t scale,
+                                                  const vec2& pos,
+                                                  vec2* gradient )
+  noexcept
+{
+  return octave_noise_with_gradient( octaves, persistence, scale,
+                                     pos.x(), pos.y(), gradient );
+}
+
+//----------------------------------------------------------------------------
+
+inline bit::math::float_t
+  bit::math::simplex::octave_noise_with_gradient( float_t octaves,
+                                                  float_t persistence,
+                                                  float_t scale,
+                                                  const vec3& pos,
+                                                  vec3* gradient )
+  noexcept
+{
+  return octave_noise_with_gradient( octaves, persistence, scale,
+                                     pos.x(), pos.y(), pos.z(), gradient );
+}
+
+//============================================================================
+// simplex_generator
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Observers
+//----------------------------------------------------------------------------
+
+inline std::uint64_t bit::math::simplex_generator::seed()
+  const noexcept
+{
+  return m_seed;
+}
+
+//----------------------------------------------------------------------------
+// Raw Noise
+//----------------------------------------------------------------------------
+
+inline bit::math::float_t
+  bit::math::simplex_generator::raw_noise( const vec2& pos )
+  const noexcept
+{
+  return raw_noise( pos.x(), pos.y() );
+}
+
+//----------------------------------------------------------------------------
+
+inline bit::math::float_t
+  bit::math::simplex_generator::raw_noise( const vec3& pos )
+  const noexcept
+{
+  return raw_noise( pos.x(), pos.y(), pos.z() );
+}
+
+//----------------------------------------------------------------------------
+
+inline bit::math::float_t
+  bit::math::simplex_generator::raw_noise( const vec4& pos )
+  const noexcept
+{
+  return raw_noise( pos.x(), pos.y(), pos.z(), pos.w() );
+}
+
+//----------------------------------------------------------------------------
+// Octave Noise
+//----------------------------------------------------------------------------
+
+inline bit::math::float_t
+  bit::math::simplex_generator::octave_noise( float_t octaves,
+                                              float_t persistence,
+                                              float_t scale,
+                                              const vec2& pos )
+  const noexcept
+{
+  return octave_noise( octaves, persistence, scale, pos.x(), pos.y() );
+}
+
+//----------------------------------------------------------------------------
+
+inline bit::math::float_t
+  bit::math::simplex_generator::octave_noise( float_t octaves,
+                                              float_t persistence,
+                                              float_t scale,
+                                              const vec3& pos )
+  const noexcept
+{
+  return octave_noise( octaves, persistence, scale,
+                       pos.x(), pos.y(), pos.z() );
+}
+
+//----------------------------------------------------------------------------
+
+inline bit::math::float_t
+  bit::math::simplex_generator::octave_noise( float_t octaves,
+                                              float_t persistence,
+                                              float_t scale,
+                                              const vec4& pos )
+  const noexcept
+{
+  return octave_noise( octaves, persistence, scale,
+                       pos.x(), pos.y(), pos.z(), pos.w() );
+}
+
+//----------------------------------------------------------------------------
+
+inline bit::math::float_t
+  bit::math::simplex_generator::octave_noise( const octave_schedule& schedule,
+                                              const vec2& pos )
+  const noexcept
+{
+  return octave_noise( schedule, pos.x(), pos.y() );
+}
+
+//----------------------------------------------------------------------------
+
+inline bit::math::float_t
+  bit::math::simplex_generator::octave_noise( const octave_schedule& schedule,
+                                              const vec3& pos )
+  const noexcept
+{
+  return octave_noise( schedule, pos.x(), pos.y(), pos.z() );
+}
+
+//----------------------------------------------------------------------------
+
+inline bit::math::float_t
+  bit::math::simplex_generator::octave_noise( const octave_schedule& schedule,
+                                              const vec4& pos )
+  const noexcept
+{
+  return octave_noise( schedule, pos.x(), pos.y(), pos.z(), pos.w() );
+}
+
+//============================================================================
+// noise_pipeline
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Observers
+//----------------------------------------------------------------------------
+
+inline bit::math::noise_pipeline::fractal bit::math::noise_pipeline::type()
+  const noexcept
+{
+  return m_type;
+}
+
+inline const bit::math::octave_schedule&
+  bit::math::noise_pipeline::schedule()
+  const noexcept
+{
+  return m_schedule;
+}
+
+inline std::size_t bit::math::noise_pipeline::warps()
+  const noexcept
+{
+  return m_warps.size();
+}
+
+inline const bit::math::octave_schedule&
+  bit::math::noise_pipeline::warp_schedule( std::size_t warp )
+  const noexcept
+{
+  assert( warp < m_warps.size() && "warp out of range" );
+
+  return m_warps[warp].schedule;
+}
+
+inline bit::math::float_t
+  bit::math::noise_pipeline::warp_strength( std::size_t warp )
+  const noexcept
+{
+  assert( warp < m_warps.size() && "warp out of range" );
+
+  return m_warps[warp].strength;
+}
+
+//----------------------------------------------------------------------------
+// Evaluation
+//----------------------------------------------------------------------------
+
+inline bit::math::float_t
+  bit::math::noise_pipeline::evaluate( const vec2& pos )
+  const noexcept
+{
+  return evaluate( pos.x(), pos.y() );
+}
 
 #endif /* BIT_MATH_SIMPLEX_HPP */
@@ -0,0 +1,308 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains cubic spline evaluators, and a spline
+ *        container with an arc-length table for constant-speed traversal
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  Bit Math Library.
+  https://github.com/bitwizeshift/bit-math
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_MATH_SPLINE_HPP
+#define BIT_MATH_SPLINE_HPP
+
+#include "math.hpp"   // bit::math::float_t
+#include "vector.hpp" // bit::math::is_vector
+
+#include <algorithm> // std::upper_bound, std::min
+#include <cassert>   // assert
+#include <cmath>     // std::floor
+#include <cstddef>   // std::size_t
+#include <utility>   // std::move
+#include <vector>    // std::vector
+
+namespace bit {
+  namespace math {
+
+    //------------------------------------------------------------------------
+    // Cubic Segments
+    //------------------------------------------------------------------------
+
+    // The following evaluate a single cubic segment at \p t in [0,1] as a
+    // weighted sum of its four control values, so \p V only needs to support
+    // scaling by \p T and addition. They are intended for vector2 and
+    // vector3, but work equally for scalars.
+
+    /// \brief Evaluates a uniform Catmull-Rom segment, which passes through
+    ///        \p p1 at t=0 and \p p2 at t=1
+    ///
+    /// \param p0 the point before the segment
+    /// \param p1 the start of the segment
+    /// \param p2 the end of the segment
+    /// \param p3 the point after the segment
+    /// \param t the position along the segment [0,1]
+    /// \return the point at \p t
+    template<typename V, typename T>
+    constexpr V catmull_rom( const V& p0, const V& p1, const V& p2,
+                             const V& p3, T t ) noexcept;
+
+    /// \brief Evaluates a cubic Bezier segment, which passes through \p p0
+    ///        at t=0 and \p p3 at t=1
+    ///
+    /// \param p0 the start of the segment
+    /// \param p1 the first control point
+    /// \param p2 the second control point
+    /// \param p3 the end of the segment
+    /// \param t the position along the segment [0,1]
+    /// \return the point at \p t
+    template<typename V, typename T>
+    constexpr V bezier( const V& p0, const V& p1, const V& p2,
+                        const V& p3, T t ) noexcept;
+
+    /// \brief Evaluates a cubic Hermite segment from \p p0 to \p p1 with the
+    ///        tangents \p m0 and \p m1
+    ///
+    /// \param p0 the start of the segment
+    /// \param m0 the tangent at \p p0
+    /// \param p1 the end of the segment
+    /// \param m1 the tangent at \p p1
+    /// \param t the position along the segment [0,1]
+    /// \return the point at \p t
+    template<typename V, typename T>
+    constexpr V hermite( const V& p0, const V& m0, const V& p1,
+                         const V& m1, T t ) noexcept;
+
+    /// \brief Evaluates a uniform cubic B-spline segment, which
+    ///        approximates rather than passes through its control points
+    ///
+    /// \param p0 the first control point
+    /// \param p1 the second control point
+    /// \param p2 the third control point
+    /// \param p3 the fourth control point
+    /// \param t the position along the segment [0,1]
+    /// \return the point at \p t
+    template<typename V, typename T>
+    constexpr V bspline( const V& p0, const V& p1, const V& p2,
+                         const V& p3, T t ) noexcept;
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief The cubic basis of a spline, and how its control points are
+    ///        laid out
+    ///
+    /// Every segment is evaluated from four consecutive control points; the
+    /// basis decides how far apart consecutive segments start
+    //////////////////////////////////////////////////////////////////////////
+    enum class spline_basis
+    {
+      catmull_rom, ///< Segment i uses points [i, i+4)
+      bezier,      ///< Segment i uses points [3i, 3i+4); segments share ends
+      hermite,     ///< Points alternate position, tangent; segment i uses
+                   ///< [2i, 2i+4)
+      bspline,     ///< Segment i uses points [i, i+4)
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A piecewise cubic curve with a precomputed arc-length table
+    ///
+    /// The spline is parameterized by \c t in [0, segment_count()], where
+    /// the integral part selects the segment. This parameterization does not
+    /// move at a constant speed, so the spline also tabulates the cumulative
+    /// length at evenly spaced parameters when it is constructed. Positions
+    /// at a distance along the curve are then found with a binary search of
+    /// the table rather than by integrating per query.
+    ///
+    /// \tparam V the type of the control points; vector2<T> or vector3<T>
+    //////////////////////////////////////////////////////////////////////////
+    template<typename V>
+    class spline
+    {
+      static_assert( is_vector<V>::value, "spline requires a vector type" );
+
+      //----------------------------------------------------------------------
+      // Public Types
+      //----------------------------------------------------------------------
+    public:
+
+      using value_type = V;
+      using size_type  = std::size_t;
+
+      //----------------------------------------------------------------------
+      // Constructors
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a spline through \p points and tabulates its
+      ///        arc length
+      ///
+      /// \pre \p points holds at least four points, plus a whole number of
+      ///      further segments for \p basis
+      /// \pre \p samples_per_segment > 0
+      ///
+      /// \param basis the cubic basis of the spline
+      /// \param points the control points
+      /// \param samples_per_segment the number of chords each segment's
+      ///        length is approximated with
+      spline( spline_basis basis,
+              std::vector<V> points,
+              size_type samples_per_segment = 16 );
+
+      /// \brief Copy-constructs a spline from another spline
+      ///
+      /// \param other the other spline to copy
+      spline( const spline& other ) = default;
+
+      /// \brief Move-constructs a spline from another spline
+      ///
+      /// \param other the other spline to move
+      spline( spline&& other ) noexcept = default;
+
+      //----------------------------------------------------------------------
+
+      /// \brief Copy-assigns a spline from another spline
+      ///
+      /// \param other the other spline to copy
+      /// \return reference to \c (*this)
+      spline& operator=( const spline& other ) = default;
+
+      /// \brief Move-assigns a spline from another spline
+      ///
+      /// \param other the other spline to move
+      /// \return reference to \c (*this)
+      spline& operator=( spline&& other ) noexcept = default;
+
+      //----------------------------------------------------------------------
+      // Observers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the cubic basis of this spline
+      ///
+      /// \return the basis
+      spline_basis basis() const noexcept;
+
+      /// \brief Gets the number of control points
+      ///
+      /// \return the number of control points
+      size_type size() const noexcept;
+
+      /// \brief Gets a pointer to the contiguous control points
+      ///
+      /// \return pointer to the size() control points
+      const V* points() const noexcept;
+
+      /// \brief Gets the number of cubic segments
+      ///
+      /// \return the number of segments
+      size_type segment_count() const noexcept;
+
+      /// \brief Gets the approximate length of this spline
+      ///
+      /// \return the length
+      float_t length() const noexcept;
+
+      //----------------------------------------------------------------------
+      // Evaluation
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Evaluates this spline at the parameter \p t
+      ///
+      /// \param t the parameter, clamped to [0, segment_count()]
+      /// \return the point at \p t
+      V evaluate( float_t t ) const noexcept;
+
+      /// \brief Evaluates this spline at each of \p n parameters
+      ///
+      /// \param t pointer to the \p n parameters
+      /// \param out pointer to the \p n results
+      /// \param n the number of parameters
+      void evaluate( const float_t* t, V* out, size_type n ) const noexcept;
+
+      /// \brief Gets the parameter at \p distance along this spline
+      ///
+      /// This is a binary search of the arc-length table, followed by a
+      /// linear interpolation between the two neighbouring samples
+      ///
+      /// \param distance the distance, clamped to [0, length()]
+      /// \return the parameter at \p distance
+      float_t parameter_at( float_t distance ) const noexcept;
+
+      /// \brief Evaluates this spline at \p distance along it
+      ///
+      /// \param distance the distance, clamped to [0, length()]
+      /// \return the point at \p distance
+      V evaluate_at( float_t distance ) const noexcept;
+
+      /// \brief Evaluates this spline at each of \p n distances along it
+      ///
+      /// Each search starts from the table entry of the previous distance, so
+      /// increasing \p distances, such as evenly spaced points along the
+      /// spline, are found in amortized constant time each
+      ///
+      /// \param distances pointer to the \p n distances
+      /// \param out pointer to the \p n results
+      /// \param n the number of distances
+      void evaluate_at( const float_t* distances,
+                        V* out,
+                        size_type n ) const noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Member Functions
+      //----------------------------------------------------------------------
+    private:
+
+      /// \brief Gets the number of points between the starts of consecutive
+      ///        segments
+      static size_type stride( spline_basis basis ) noexcept;
+
+      /// \brief Evaluates the \p segment th segment at \p t in [0,1]
+      V evaluate_segment( size_type segment, float_t t ) const noexcept;
+
+      /// \brief Finds the last table entry at or before \p distance,
+      ///        starting from the entry \p hint
+      size_type find_sample( float_t distance, size_type hint ) const noexcept;
+
+      /// \brief Converts the table entry \p sample and \p distance to a
+      ///        parameter
+      float_t sample_parameter( size_type sample,
+                                float_t distance ) const noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      std::vector<V>       m_points;
+      std::vector<float_t> m_lengths; ///< cumulative length at each sample
+      size_type            m_samples_per_segment;
+      spline_basis         m_basis;
+    };
+
+  } // namespace math
+} // namespace bit
+
+#include "detail/spline.inl"
+
+#endif /* BIT_MATH_SPLINE_HPP */
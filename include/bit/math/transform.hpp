@@ -38,12 +38,99 @@
 #include "matrix.hpp"     // bit::math::mat4
 #include "quaternion.hpp" // bit::math::quaternion
 
+#include <atomic>  // std::atomic
+#include <cassert> // assert
+#include <cstddef> // std::size_t
+#include <thread>  // std::this_thread::yield
+
 namespace bit {
   namespace math {
+    namespace detail {
+
+      // Matrices transform column vectors, as in 'vec4 * mat4', and store
+      // their translation in the last column
+
+      /// \brief Composes the matrix that scales by \p scale, then rotates by
+      ///        \p rotation, then translates by \p translation
+      ///
+      /// \param translation the translation
+      /// \param rotation the rotation
+      /// \param scale the scale
+      /// \return the composed matrix
+      mat4 compose_trs( const vec3& translation,
+                        const quaternion& rotation,
+                        const vec3& scale ) noexcept;
+
+      /// \brief Composes two affine matrices into the matrix that applies
+      ///        \p inner, then \p outer
+      ///
+      /// Only the upper 3x4 of each matrix is read, and the bottom row of the
+      /// result is always (0,0,0,1)
+      ///
+      /// \param outer the matrix applied last, such as a parent's world
+      ///        matrix
+      /// \param inner the matrix applied first, such as a child's local
+      ///        matrix
+      /// \return the composed matrix
+      mat4 compose_affine( const mat4& outer, const mat4& inner ) noexcept;
+
+      /// \brief Composes the inverse of compose_trs without a general
+      ///        inverse
+      ///
+      /// The inverse unscales, unrotates by the conjugate of \p rotation,
+      /// then untranslates
+      ///
+      /// \pre \p rotation is a unit quaternion, and no component of
+      ///      \p scale is zero
+      ///
+      /// \param translation the translation
+      /// \param rotation the rotation
+      /// \param scale the scale
+      /// \return the inverse of the composed matrix
+      mat4 compose_inverse_trs( const vec3& translation,
+                                const quaternion& rotation,
+                                const vec3& scale ) noexcept;
+
+      /// \brief Composes the inverse-transpose of the upper 3x3 of
+      ///        compose_trs, which transforms normals
+      ///
+      /// The transpose of the rotation cancels with that of its inverse,
+      /// leaving the rotation with each column divided by the scale
+      ///
+      /// \pre \p rotation is a unit quaternion, and no component of
+      ///      \p scale is zero
+      ///
+      /// \param rotation the rotation
+      /// \param scale the scale
+      /// \return the normal matrix
+      mat3 compose_normal_matrix( const quaternion& rotation,
+                                  const vec3& scale ) noexcept;
+
+    } // namespace detail
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief The translation, rotation and scale of a transform at one
+    ///        point in time
+    ///
+    /// Snapshots are plain values, so keeping the previous simulation state
+    /// of every transform costs no caches or synchronization.
+    //////////////////////////////////////////////////////////////////////////
+    struct transform_snapshot
+    {
+      vec3       translation = vec3{0,0,0}; ///< Position of the model
+      quaternion rotation    = quaternion{}; ///< Rotation of the model
+      vec3       scale       = vec3{1,1,1}; ///< Scale of the model
+    };
 
     //////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief A translation, rotation and scale, with a lazily composed
+    ///        matrix
     ///
+    /// The const members may be called concurrently from multiple threads,
+    /// including the matrix observers, which rebuild stale matrices without
+    /// a lock.
+    /// As with the standard library types, the non-const members require
+    /// exclusive access.
     //////////////////////////////////////////////////////////////////////////
     class transform
     {
@@ -54,15 +141,11 @@ namespace bit {
 
       transform() noexcept;
 
-      transform( const transform& other ) noexcept = default;
-
-      transform( transform&& other ) noexcept = default;
+      transform( const transform& other ) noexcept;
 
       //----------------------------------------------------------------------
 
-      transform& operator=( const transform& other ) noexcept = default;
-
-      transform& operator=( transform&& other ) noexcept = default;
+      transform& operator=( const transform& other ) noexcept;
 
       //----------------------------------------------------------------------
       // Modifiers
@@ -144,27 +227,139 @@ namespace bit {
       radian pitch() const noexcept;
       radian yaw() const noexcept;
 
+      /// \brief Gets the matrix that scales, then rotates, then translates
+      ///
+      /// The matrix is only rebuilt after the transform is modified. If
+      /// several threads read a stale matrix at once, one rebuilds it while
+      /// the others wait for the result
+      ///
+      /// \return reference to the matrix
       const mat4& matrix() const noexcept;
 
+      /// \brief Gets the translation, rotation and scale of this transform
+      ///
+      /// \return the snapshot
+      transform_snapshot snapshot() const noexcept;
+
+      /// \brief Gets the inverse of matrix()
+      ///
+      /// This is composed directly from the translation, rotation and scale
+      /// rather than by inverting matrix(), and is cached like matrix()
+      ///
+      /// \pre no component of the scale is zero
+      ///
+      /// \return reference to the inverse matrix
+      const mat4& inverse_matrix() const noexcept;
+
+      /// \brief Gets the inverse-transpose of the upper 3x3 of matrix(),
+      ///        which transforms normals
+      ///
+      /// This is composed directly from the rotation and scale, and is
+      /// cached like matrix()
+      ///
+      /// \pre no component of the scale is zero
+      ///
+      /// \return reference to the normal matrix
+      const mat3& normal_matrix() const noexcept;
+
       //----------------------------------------------------------------------
       // Private Members
       //----------------------------------------------------------------------
     private:
 
+      /// \brief The state of a cached matrix
+      enum class matrix_state : unsigned char
+      {
+        clean,    ///< The matrix matches the components
+        dirty,    ///< The matrix must be rebuilt
+        updating, ///< A reader is rebuilding the matrix
+      };
+
+      using state_type = std::atomic<matrix_state>;
+
       mutable mat4 m_transform;   ///< The cached transformation
+      mutable mat4 m_inverse;     ///< The cached inverse transformation
+      mutable mat3 m_normal;      ///< The cached normal matrix
       quaternion   m_rotation;    ///< Rotation of the model
       vec3         m_translation; ///< Position of the model
       vec3         m_scale;       ///< Scale of the model
-      mutable bool m_is_dirty;    ///< flag indicating a dirty transform
+
+      mutable state_type m_state;         ///< State of m_transform
+      mutable state_type m_inverse_state; ///< State of m_inverse
+      mutable state_type m_normal_state;  ///< State of m_normal
 
       //----------------------------------------------------------------------
       // Private Member Functions
       //----------------------------------------------------------------------
     private:
 
-      void update() const noexcept;
+      /// \brief Rebuilds a stale matrix with \p rebuild, or waits for the
+      ///        reader that is already rebuilding it
+      template<typename Fn>
+      static void update( state_type& state, Fn rebuild ) noexcept;
+
+      /// \brief Copies \p from into \p to if it is clean, or marks \p to
+      ///        stale otherwise
+      template<typename Matrix>
+      static void assign( Matrix& to,
+                          state_type& to_state,
+                          const Matrix& from,
+                          const state_type& from_state ) noexcept;
+
+      void invalidate() noexcept;
     };
 
+    //------------------------------------------------------------------------
+    // Interpolation
+    //------------------------------------------------------------------------
+
+    namespace detail {
+
+      /// \brief Composes the matrix of the transform between \p from and
+      ///        \p to at \p alpha
+      ///
+      /// The translation and scale are interpolated linearly, and the
+      /// rotation along the shorter arc with a normalized linear
+      /// interpolation
+      ///
+      /// \param from the state at \p alpha 0
+      /// \param to the state at \p alpha 1
+      /// \param alpha the interpolant, in [0,1]
+      /// \return the composed matrix
+      mat4 compose_interpolated( const transform_snapshot& from,
+                                 const transform_snapshot& to,
+                                 float_t alpha ) noexcept;
+
+    } // namespace detail
+
+    /// \brief Composes the matrices of \p n transforms between their
+    ///        previous and current states
+    ///
+    /// This is intended for rendering between two steps of a fixed-rate
+    /// simulation, with \p alpha being the fraction of a step since
+    /// \p curr was simulated
+    ///
+    /// \param prev pointer to the \p n previous states
+    /// \param curr pointer to the \p n current states
+    /// \param alpha the interpolant, in [0,1]
+    /// \param out pointer to the \p n composed matrices
+    /// \param n the number of transforms
+    void interpolate_transforms( const transform_snapshot* prev,
+                                 const transform_snapshot* curr,
+                                 float_t alpha,
+                                 mat4* out,
+                                 std::size_t n ) noexcept;
+
+    /// \copydoc interpolate_transforms
+    ///
+    /// The current states are read from the transforms directly, without
+    /// updating their cached matrices
+    void interpolate_transforms( const transform_snapshot* prev,
+                                 const transform* curr,
+                                 float_t alpha,
+                                 mat4* out,
+                                 std::size_t n ) noexcept;
+
   } // namespace math
 } // namespace bit
 
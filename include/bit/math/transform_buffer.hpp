@@ -0,0 +1,189 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains a triple-buffered store of transform
+ *        matrices, for handing frames from a simulation thread to a render
+ *        thread
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  Bit Math Library.
+  https://github.com/bitwizeshift/bit-math
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_MATH_TRANSFORM_BUFFER_HPP
+#define BIT_MATH_TRANSFORM_BUFFER_HPP
+
+#include "transform.hpp" // bit::math::transform
+#include "matrix.hpp"    // bit::math::mat4
+
+#include "detail/aligned_allocator.hpp" // detail::aligned_allocator
+
+#include <atomic>  // std::atomic
+#include <cassert> // assert
+#include <cstddef> // std::size_t
+#include <vector>  // std::vector
+
+namespace bit {
+  namespace math {
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A triple-buffered array of transform matrices, shared between
+    ///        one writer thread and one reader thread
+    ///
+    /// The writer fills its own frame of matrices and publishes it with a
+    /// single atomic exchange. The reader picks up the most recently
+    /// published frame with another exchange, and keeps a stable view of it
+    /// until it reads again. Neither side ever waits on the other, and
+    /// frames are handed over rather than copied; a frame the reader never
+    /// picked up is reused by the writer.
+    ///
+    /// Each frame is a 64-byte aligned, contiguous array of size() matrices,
+    /// so a view can be streamed directly into a GPU buffer.
+    ///
+    /// \note A frame being written still holds the matrices of an older
+    ///       frame, so the writer should write every matrix before
+    ///       publishing.
+    //////////////////////////////////////////////////////////////////////////
+    class transform_buffer
+    {
+      //----------------------------------------------------------------------
+      // Public Types
+      //----------------------------------------------------------------------
+    public:
+
+      using size_type  = std::size_t;
+      using index_type = std::size_t;
+
+      //----------------------------------------------------------------------
+      // Constructors
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a buffer of \p n identity matrices per frame
+      ///
+      /// \param n the number of matrices per frame
+      explicit transform_buffer( size_type n );
+
+      transform_buffer( const transform_buffer& other ) = delete;
+
+      //----------------------------------------------------------------------
+
+      transform_buffer& operator=( const transform_buffer& other ) = delete;
+
+      //----------------------------------------------------------------------
+      // Writer
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the frame owned by the writer
+      ///
+      /// \return pointer to the size() matrices of the frame
+      mat4* write_data() noexcept;
+
+      /// \brief Writes the matrix of \p t into the writer's frame
+      ///
+      /// \param n the index of the matrix
+      /// \param t the transform
+      void write( index_type n, const transform& t ) noexcept;
+
+      /// \brief Writes \p matrix into the writer's frame
+      ///
+      /// \param n the index of the matrix
+      /// \param matrix the matrix
+      void write( index_type n, const mat4& matrix ) noexcept;
+
+      /// \brief Publishes the writer's frame to the reader, and gives the
+      ///        writer a new frame
+      void publish() noexcept;
+
+      //----------------------------------------------------------------------
+      // Reader
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Checks whether a frame was published since the last read()
+      ///
+      /// \return \c true if read() would return a newer frame
+      bool has_update() const noexcept;
+
+      /// \brief Gets the most recently published frame
+      ///
+      /// The frame is stable until the next call to read(). Before anything
+      /// is published, this is a frame of identity matrices
+      ///
+      /// \return pointer to the size() matrices of the frame
+      const mat4* read() noexcept;
+
+      //----------------------------------------------------------------------
+      // Observers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the number of matrices per frame
+      ///
+      /// \return the number of matrices
+      size_type size() const noexcept;
+
+      /// \brief Gets the number of bytes per frame
+      ///
+      /// \return the number of bytes
+      std::size_t size_bytes() const noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Types
+      //----------------------------------------------------------------------
+    private:
+
+      using frame_type = std::vector<mat4,detail::aligned_allocator<mat4,64>>;
+      using slot_type  = unsigned char;
+
+      static constexpr std::size_t cache_line_size = 64;
+
+      /// Marks the shared slot as published and not yet read
+      static constexpr slot_type fresh_bit = 0x4;
+      static constexpr slot_type slot_mask = 0x3;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      frame_type m_frames[3];
+
+      // The writer's slot, the shared slot, and the reader's slot are each
+      // kept on their own cache line to avoid false sharing
+
+      slot_type              m_write;
+      char                   m_padding0[cache_line_size - sizeof(slot_type)];
+      std::atomic<slot_type> m_shared;
+      char                   m_padding1[cache_line_size - sizeof(std::atomic<slot_type>)];
+      slot_type              m_read;
+    };
+
+  } // namespace math
+} // namespace bit
+
+#include "detail/transform_buffer.inl"
+
+#endif /* BIT_MATH_TRANSFORM_BUFFER_HPP */
@@ -0,0 +1,258 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains a hierarchy of transforms, stored as flat
+ *        arrays in parent-before-child order
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  Bit Math Library.
+  https://github.com/bitwizeshift/bit-math
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_MATH_TRANSFORM_HIERARCHY_HPP
+#define BIT_MATH_TRANSFORM_HIERARCHY_HPP
+
+#include "transform.hpp"  // bit::math::detail::compose_trs
+#include "vector.hpp"     // bit::math::vec3
+#include "matrix.hpp"     // bit::math::mat4
+#include "quaternion.hpp" // bit::math::quaternion
+
+#include <cassert> // assert
+#include <cstddef> // std::size_t
+#include <limits>  // std::numeric_limits
+#include <vector>  // std::vector
+
+namespace bit {
+  namespace math {
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A hierarchy of transforms, each relative to its parent
+    ///
+    /// Nodes are stored in separate contiguous arrays of parent indices,
+    /// local translations, rotations and scales, world matrices, and dirty
+    /// flags. A node can only be added after its parent, so every parent
+    /// precedes its children and the world matrices are computed in a single
+    /// forward pass: a node is recomputed when it or any of its ancestors
+    /// changed, and its parent's world matrix is always already up to date.
+    ///
+    /// The pass starts from the first modified node, and only recomputes the
+    /// world matrices of dirty nodes and their descendants.
+    //////////////////////////////////////////////////////////////////////////
+    class transform_hierarchy
+    {
+      //----------------------------------------------------------------------
+      // Public Types
+      //----------------------------------------------------------------------
+    public:
+
+      using size_type  = std::size_t;
+      using index_type = std::size_t;
+
+      /// The parent index of root nodes
+      static constexpr index_type no_parent = std::numeric_limits<index_type>::max();
+
+      //----------------------------------------------------------------------
+      // Constructors
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a hierarchy with no nodes
+      transform_hierarchy() noexcept;
+
+      /// \brief Copy-constructs a hierarchy from another hierarchy
+      ///
+      /// \param other the other hierarchy to copy
+      transform_hierarchy( const transform_hierarchy& other ) = default;
+
+      /// \brief Move-constructs a hierarchy from another hierarchy
+      ///
+      /// \param other the other hierarchy to move
+      transform_hierarchy( transform_hierarchy&& other ) noexcept = default;
+
+      //----------------------------------------------------------------------
+
+      /// \brief Copy-assigns a hierarchy from another hierarchy
+      ///
+      /// \param other the other hierarchy to copy
+      /// \return reference to \c (*this)
+      transform_hierarchy& operator=( const transform_hierarchy& other ) = default;
+
+      /// \brief Move-assigns a hierarchy from another hierarchy
+      ///
+      /// \param other the other hierarchy to move
+      /// \return reference to \c (*this)
+      transform_hierarchy& operator=( transform_hierarchy&& other ) noexcept = default;
+
+      //----------------------------------------------------------------------
+      // Modifiers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Reserves storage for \p n nodes
+      ///
+      /// \param n the number of nodes to reserve
+      void reserve( size_type n );
+
+      /// \brief Appends a node with an identity local transform
+      ///
+      /// \pre \p parent is \ref no_parent or the index of an existing node
+      ///
+      /// \param parent the index of the parent node
+      /// \return the index of the new node
+      index_type add_node( index_type parent = no_parent );
+
+      /// \brief Appends a node with the local transform of \p local
+      ///
+      /// \pre \p parent is \ref no_parent or the index of an existing node
+      ///
+      /// \param local the local transform of the node
+      /// \param parent the index of the parent node
+      /// \return the index of the new node
+      index_type add_node( const transform& local, index_type parent = no_parent );
+
+      /// \brief Removes every node from this hierarchy
+      void clear() noexcept;
+
+      //----------------------------------------------------------------------
+
+      /// \brief Sets the local position of node \p n
+      ///
+      /// \param n the index of the node
+      /// \param position the position relative to the parent
+      void set_position( index_type n, const vec3& position ) noexcept;
+
+      /// \brief Sets the local rotation of node \p n
+      ///
+      /// \param n the index of the node
+      /// \param rotation the rotation relative to the parent
+      void set_rotation( index_type n, const quaternion& rotation ) noexcept;
+
+      /// \brief Sets the local scale of node \p n
+      ///
+      /// \param n the index of the node
+      /// \param scale the scale relative to the parent
+      void set_scale( index_type n, const vec3& scale ) noexcept;
+
+      /// \brief Sets the local position, rotation, and scale of node \p n
+      ///        from \p local
+      ///
+      /// \param n the index of the node
+      /// \param local the transform relative to the parent
+      void set_local( index_type n, const transform& local ) noexcept;
+
+      //----------------------------------------------------------------------
+      // Observers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the number of nodes in this hierarchy
+      ///
+      /// \return the number of nodes
+      size_type size() const noexcept;
+
+      /// \brief Checks whether this hierarchy has no nodes
+      ///
+      /// \return \c true if this hierarchy has no nodes
+      bool empty() const noexcept;
+
+      /// \brief Gets the index of the parent of node \p n
+      ///
+      /// \param n the index of the node
+      /// \return the parent index, or \ref no_parent
+      index_type parent( index_type n ) const noexcept;
+
+      /// \brief Gets the local position of node \p n
+      ///
+      /// \param n the index of the node
+      /// \return the position relative to the parent
+      const vec3& position( index_type n ) const noexcept;
+
+      /// \brief Gets the local rotation of node \p n
+      ///
+      /// \param n the index of the node
+      /// \return the rotation relative to the parent
+      const quaternion& rotation( index_type n ) const noexcept;
+
+      /// \brief Gets the local scale of node \p n
+      ///
+      /// \param n the index of the node
+      /// \return the scale relative to the parent
+      const vec3& scale( index_type n ) const noexcept;
+
+      /// \brief Checks whether node \p n was modified since the last update
+      ///
+      /// \note Descendants of a modified node are not flagged until update()
+      ///
+      /// \param n the index of the node
+      /// \return \c true if the node was modified
+      bool is_dirty( index_type n ) const noexcept;
+
+      /// \brief Gets the world matrix of node \p n, as of the last update
+      ///
+      /// \param n the index of the node
+      /// \return the world matrix
+      const mat4& world_matrix( index_type n ) const noexcept;
+
+      /// \brief Gets a pointer to the contiguous world matrices, as of the
+      ///        last update
+      ///
+      /// \return pointer to the size() world matrices
+      const mat4* world_matrices() const noexcept;
+
+      //----------------------------------------------------------------------
+      // Update
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Recomputes the world matrix of every modified node and its
+      ///        descendants, and clears the dirty flags
+      void update() noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Member Functions
+      //----------------------------------------------------------------------
+    private:
+
+      void mark_dirty( index_type n ) noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      std::vector<index_type>    m_parents;
+      std::vector<vec3>          m_translations;
+      std::vector<quaternion>    m_rotations;
+      std::vector<vec3>          m_scales;
+      std::vector<mat4>          m_world;
+      std::vector<unsigned char> m_dirty;
+      index_type                 m_first_dirty; ///< lowest dirty index, or size()
+    };
+
+  } // namespace math
+} // namespace bit
+
+#include "detail/transform_hierarchy.inl"
+
+#endif /* BIT_MATH_TRANSFORM_HIERARCHY_HPP */
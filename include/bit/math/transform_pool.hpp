@@ -0,0 +1,323 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains a pool of transforms stored as separate
+ *        arrays of components
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  Bit Math Library.
+  https://github.com/bitwizeshift/bit-math
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_MATH_TRANSFORM_POOL_HPP
+#define BIT_MATH_TRANSFORM_POOL_HPP
+
+#include "transform.hpp"  // bit::math::transform
+#include "angles.hpp"     // bit::math::radian
+#include "vector.hpp"     // bit::math::vec3
+#include "matrix.hpp"     // bit::math::mat4
+#include "quaternion.hpp" // bit::math::quaternion
+
+#include "detail/aligned_allocator.hpp" // detail::aligned_allocator
+
+#include <cassert> // assert
+#include <cstddef> // std::size_t
+#include <vector>  // std::vector
+
+namespace bit {
+  namespace math {
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A pool of transforms, stored as one array per component
+    ///
+    /// Each component of the translations, rotations, and scales is stored
+    /// in its own cache-line aligned array, separately from the dirty flags
+    /// and the output matrices. Transforms are modified through handles,
+    /// which mirror the modifiers of bit::math::transform, and every changed
+    /// matrix is rebuilt at once by update_dirty().
+    //////////////////////////////////////////////////////////////////////////
+    class transform_pool
+    {
+      //----------------------------------------------------------------------
+      // Public Types
+      //----------------------------------------------------------------------
+    public:
+
+      using size_type  = std::size_t;
+      using index_type = std::size_t;
+
+      class handle;
+
+      //----------------------------------------------------------------------
+      // Constructors
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a pool with no transforms
+      transform_pool() = default;
+
+      /// \brief Copy-constructs a pool from another pool
+      ///
+      /// \param other the other pool to copy
+      transform_pool( const transform_pool& other ) = default;
+
+      /// \brief Move-constructs a pool from another pool
+      ///
+      /// \param other the other pool to move
+      transform_pool( transform_pool&& other ) noexcept = default;
+
+      //----------------------------------------------------------------------
+
+      /// \brief Copy-assigns a pool from another pool
+      ///
+      /// \param other the other pool to copy
+      /// \return reference to \c (*this)
+      transform_pool& operator=( const transform_pool& other ) = default;
+
+      /// \brief Move-assigns a pool from another pool
+      ///
+      /// \param other the other pool to move
+      /// \return reference to \c (*this)
+      transform_pool& operator=( transform_pool&& other ) noexcept = default;
+
+      //----------------------------------------------------------------------
+      // Modifiers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Reserves storage for \p n transforms
+      ///
+      /// \param n the number of transforms to reserve
+      void reserve( size_type n );
+
+      /// \brief Appends an identity transform
+      ///
+      /// \return a handle to the new transform
+      handle add();
+
+      /// \brief Appends a copy of \p t
+      ///
+      /// \param t the transform to copy
+      /// \return a handle to the new transform
+      handle add( const transform& t );
+
+      /// \brief Removes every transform from this pool
+      ///
+      /// \note Handles into this pool are invalidated
+      void clear() noexcept;
+
+      /// \brief Gets a handle to the \p n th transform
+      ///
+      /// \param n the index of the transform
+      /// \return the handle
+      handle operator[]( index_type n ) noexcept;
+
+      //----------------------------------------------------------------------
+      // Observers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the number of transforms in this pool
+      ///
+      /// \return the number of transforms
+      size_type size() const noexcept;
+
+      /// \brief Checks whether this pool has no transforms
+      ///
+      /// \return \c true if this pool has no transforms
+      bool empty() const noexcept;
+
+      /// \brief Gets the position of the \p n th transform
+      ///
+      /// \param n the index of the transform
+      /// \return the position
+      vec3 position( index_type n ) const noexcept;
+
+      /// \brief Gets the rotation of the \p n th transform
+      ///
+      /// \param n the index of the transform
+      /// \return the rotation
+      quaternion rotation( index_type n ) const noexcept;
+
+      /// \brief Gets the scale of the \p n th transform
+      ///
+      /// \param n the index of the transform
+      /// \return the scale
+      vec3 scale( index_type n ) const noexcept;
+
+      /// \brief Checks whether the \p n th transform changed since the last
+      ///        call to update_dirty()
+      ///
+      /// \param n the index of the transform
+      /// \return \c true if the matrix is out of date
+      bool is_dirty( index_type n ) const noexcept;
+
+      /// \brief Gets the matrix of the \p n th transform, as of the last
+      ///        call to update_dirty()
+      ///
+      /// \param n the index of the transform
+      /// \return the matrix
+      const mat4& matrix( index_type n ) const noexcept;
+
+      /// \brief Gets a pointer to the contiguous matrices, as of the last
+      ///        call to update_dirty()
+      ///
+      /// \return pointer to the size() matrices
+      const mat4* matrices() const noexcept;
+
+      //----------------------------------------------------------------------
+      // Update
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Rebuilds the matrix of every dirty transform, and clears the
+      ///        dirty flags
+      ///
+      /// The matrices are composed as in transform::matrix(), one SIMD lane
+      /// per transform, and match it within rounding. Sets of lanes with no
+      /// dirty transforms are skipped.
+      void update_dirty() noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Types
+      //----------------------------------------------------------------------
+    private:
+
+      template<typename T>
+      using aligned_vector = std::vector<T,detail::aligned_allocator<T,64>>;
+
+      /// The index of each component array
+      enum component : std::size_t
+      {
+        position_x, position_y, position_z,
+        rotation_x, rotation_y, rotation_z, rotation_w,
+        scale_x, scale_y, scale_z,
+        component_count,
+      };
+
+      //----------------------------------------------------------------------
+      // Private Member Functions
+      //----------------------------------------------------------------------
+    private:
+
+      void set_position( index_type n, const vec3& position ) noexcept;
+      void set_rotation( index_type n, const quaternion& rotation ) noexcept;
+      void set_scale( index_type n, const vec3& scale ) noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      aligned_vector<float_t>       m_components[component_count];
+      aligned_vector<unsigned char> m_dirty;
+      aligned_vector<mat4>          m_matrices;
+
+      friend class handle;
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A reference to a transform in a transform_pool
+    ///
+    /// Handles are cheap to copy, and provide the same modifiers as
+    /// bit::math::transform. They are invalidated when the pool is cleared,
+    /// moved, or reallocated by adding transforms beyond its capacity.
+    //////////////////////////////////////////////////////////////////////////
+    class transform_pool::handle
+    {
+      //----------------------------------------------------------------------
+      // Constructors
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a handle to the \p n th transform of \p pool
+      ///
+      /// \param pool the pool
+      /// \param n the index of the transform
+      handle( transform_pool& pool, index_type n ) noexcept;
+
+      //----------------------------------------------------------------------
+      // Modifiers
+      //----------------------------------------------------------------------
+    public:
+
+      void translate( float_t x, float_t y, float_t z ) noexcept;
+      void translate( const vec3& translation ) noexcept;
+
+      void set_position( float_t x, float_t y, float_t z ) noexcept;
+      void set_position( const vec3& position ) noexcept;
+
+      //----------------------------------------------------------------------
+
+      void rotate( radian yaw, radian pitch, radian roll ) noexcept;
+      void rotate( radian angle, const vec3& axis ) noexcept;
+      void rotate( const quaternion& rotation ) noexcept;
+
+      void set_rotation( radian yaw, radian pitch, radian roll ) noexcept;
+      void set_rotation( radian angle, const vec3& axis ) noexcept;
+      void set_rotation( const quaternion& rotation ) noexcept;
+
+      //----------------------------------------------------------------------
+
+      void scale( float_t x, float_t y, float_t z ) noexcept;
+      void scale( const vec3& scale ) noexcept;
+
+      void set_scale( float_t x, float_t y, float_t z ) noexcept;
+      void set_scale( const vec3& scale ) noexcept;
+
+      //----------------------------------------------------------------------
+      // Observers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the index of the transform in its pool
+      ///
+      /// \return the index
+      index_type index() const noexcept;
+
+      vec3 position() const noexcept;
+      quaternion rotation() const noexcept;
+      vec3 scale() const noexcept;
+
+      /// \brief Gets the matrix of the transform, as of the last call to
+      ///        transform_pool::update_dirty()
+      ///
+      /// \return the matrix
+      const mat4& matrix() const noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      transform_pool* m_pool;
+      index_type      m_index;
+    };
+
+  } // namespace math
+} // namespace bit
+
+#include "detail/transform_pool.inl"
+
+#endif /* BIT_MATH_TRANSFORM_POOL_HPP */
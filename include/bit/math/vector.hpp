@@ -79,13 +79,15 @@ namespace bit {
 
     // Optimize the common case by pre-instantiating the vector
 
+#ifndef BIT_MATH_VECTOR_INSTANTIATION
     extern template class vector2<float_t>;
     extern template class vector3<float_t>;
     extern template class vector4<float_t>;
+#endif
 
     using vec2 = vector2<float_t>;
     using vec3 = vector3<float_t>;
-    using vec4 = vector3<float_t>;
+    using vec4 = vector4<float_t>;
 
   } // namespace math
 
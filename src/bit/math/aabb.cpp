@@ -0,0 +1,388 @@
+#include <bit/math/aabb.hpp>
+
+#include "detail/simd.hpp"
+
+#include <algorithm> // std::min, std::max
+#include <cassert>   // assert
+#include <limits>    // std::numeric_limits
+
+namespace {
+
+  using bit::math::float_t;
+  using bit::math::point2;
+  using bit::math::point3;
+  using bit::math::aabb2;
+  using bit::math::aabb3;
+  using bit::math::mat3;
+  using bit::math::mat4;
+
+  namespace simd = bit::math::detail::simd;
+
+  // Points and boxes are tightly packed arrays of float_t, so arrays of them
+  // are processed as flat arrays of components
+
+  static_assert( sizeof(point2) == 2 * sizeof(float_t), "point2 must not be padded" );
+  static_assert( sizeof(point3) == 3 * sizeof(float_t), "point3 must not be padded" );
+  static_assert( sizeof(aabb2) == 4 * sizeof(float_t), "aabb2 must not be padded" );
+  static_assert( sizeof(aabb3) == 6 * sizeof(float_t), "aabb3 must not be padded" );
+
+  template<typename T>
+  const float_t* components( const T* p )
+    noexcept
+  {
+    return reinterpret_cast<const float_t*>( p );
+  }
+
+  // The traits of the boxes in each dimension
+  template<typename Box> struct box_traits;
+
+  template<>
+  struct box_traits<aabb2>
+  {
+    static constexpr std::size_t dimensions = 2;
+
+    using point_type  = point2;
+    using matrix_type = mat3;
+
+    static aabb2 make( const float* min, const float* max ) noexcept
+    {
+      return aabb2{ point2{ min[0], min[1] }, point2{ max[0], max[1] } };
+    }
+  };
+
+  template<>
+  struct box_traits<aabb3>
+  {
+    static constexpr std::size_t dimensions = 3;
+
+    using point_type  = point3;
+    using matrix_type = mat4;
+
+    static aabb3 make( const float* min, const float* max ) noexcept
+    {
+      return aabb3{ point3{ min[0], min[1], min[2] },
+                    point3{ max[0], max[1], max[2] } };
+    }
+  };
+
+  // The offsets of component 'c' of 'simd::width' consecutive elements that
+  // are each 'stride' components long
+  inline simd::ints lane_offsets( std::size_t stride, std::size_t c )
+    noexcept
+  {
+    int offsets[simd::width];
+    for( auto lane = std::size_t{0}; lane < simd::width; ++lane ) {
+      offsets[lane] = static_cast<int>( lane * stride + c );
+    }
+    return simd::load( offsets );
+  }
+
+  //--------------------------------------------------------------------------
+  // Bounds
+  //--------------------------------------------------------------------------
+
+  // 'simd::width' points are exactly N full sets of lanes, so the points are
+  // loaded contiguously into N accumulators without a gather. Lane 'l' of
+  // accumulator 'k' only ever holds component '(k * width + l) % N', and the
+  // lanes are folded into the components at the end
+  template<typename Box>
+  Box bounds_batch( const float* points, std::size_t n )
+    noexcept
+  {
+    constexpr auto N = box_traits<Box>::dimensions;
+    constexpr auto infinity = std::numeric_limits<float>::infinity();
+
+    simd::floats min[N];
+    simd::floats max[N];
+    for( auto k = std::size_t{0}; k < N; ++k ) {
+      min[k] = simd::broadcast( infinity );
+      max[k] = simd::broadcast( -infinity );
+    }
+
+    auto i = std::size_t{0};
+    for( ; i + simd::width <= n; i += simd::width ) {
+      const auto* base = points + i * N;
+
+      for( auto k = std::size_t{0}; k < N; ++k ) {
+        const auto v = simd::load( base + k * simd::width );
+
+        min[k] = simd::min( min[k], v );
+        max[k] = simd::max( max[k], v );
+      }
+    }
+
+    float lo[N];
+    float hi[N];
+    std::fill( lo, lo + N, infinity );
+    std::fill( hi, hi + N, -infinity );
+
+    for( auto k = std::size_t{0}; k < N; ++k ) {
+      float min_lanes[simd::width];
+      float max_lanes[simd::width];
+      simd::store( min_lanes, min[k] );
+      simd::store( max_lanes, max[k] );
+
+      for( auto lane = std::size_t{0}; lane < simd::width; ++lane ) {
+        const auto c = (k * simd::width + lane) % N;
+
+        lo[c] = std::min( lo[c], min_lanes[lane] );
+        hi[c] = std::max( hi[c], max_lanes[lane] );
+      }
+    }
+
+    for( ; i < n; ++i ) {
+      for( auto c = std::size_t{0}; c < N; ++c ) {
+        lo[c] = std::min( lo[c], points[i * N + c] );
+        hi[c] = std::max( hi[c], points[i * N + c] );
+      }
+    }
+
+    if( n == 0 ) return Box{};
+    return box_traits<Box>::make( lo, hi );
+  }
+
+  // Merges each point on its own; this is used for double precision, which
+  // is not vectorized
+  template<typename Box, typename Float>
+  Box bounds_batch( const Float* points, std::size_t n )
+    noexcept
+  {
+    using point_type = typename box_traits<Box>::point_type;
+
+    const auto* p = reinterpret_cast<const point_type*>( points );
+
+    auto result = Box{};
+    for( auto i = std::size_t{0}; i < n; ++i ) {
+      result.merge( p[i] );
+    }
+    return result;
+  }
+
+  //--------------------------------------------------------------------------
+  // Intersection
+  //--------------------------------------------------------------------------
+
+  // Tests one box per lane, gathering each component from the array of
+  // boxes. A box is separated from 'box' if its min exceeds the max of
+  // 'box', or its max is below the min of 'box', along any axis
+  template<typename Box>
+  void intersects_batch( const float* boxes,
+                         const Box& box,
+                         bool* out,
+                         std::size_t n )
+    noexcept
+  {
+    constexpr auto N = box_traits<Box>::dimensions;
+
+    const auto* box_min = box.min().data();
+    const auto* box_max = box.max().data();
+
+    simd::ints min_offsets[N];
+    simd::ints max_offsets[N];
+    for( auto c = std::size_t{0}; c < N; ++c ) {
+      min_offsets[c] = lane_offsets( 2 * N, c );
+      max_offsets[c] = lane_offsets( 2 * N, N + c );
+    }
+
+    auto i = std::size_t{0};
+    for( ; i + simd::width <= n; i += simd::width ) {
+      const auto* base = boxes + i * 2 * N;
+
+      auto separated = simd::broadcast( 0 );
+      for( auto c = std::size_t{0}; c < N; ++c ) {
+        const auto min = simd::gather( base, min_offsets[c] );
+        const auto max = simd::gather( base, max_offsets[c] );
+
+        separated = separated
+                  | simd::greater( min, simd::broadcast( box_max[c] ) )
+                  | simd::less( max, simd::broadcast( box_min[c] ) );
+      }
+
+      int lanes[simd::width];
+      simd::store( lanes, separated );
+      for( auto lane = std::size_t{0}; lane < simd::width; ++lane ) {
+        out[i + lane] = (lanes[lane] == 0);
+      }
+    }
+
+    const auto* b = reinterpret_cast<const Box*>( boxes );
+    for( ; i < n; ++i ) {
+      out[i] = b[i].intersects( box );
+    }
+  }
+
+  template<typename Box, typename Float>
+  void intersects_batch( const Float* boxes,
+                         const Box& box,
+                         bool* out,
+                         std::size_t n )
+    noexcept
+  {
+    const auto* b = reinterpret_cast<const Box*>( boxes );
+
+    for( auto i = std::size_t{0}; i < n; ++i ) {
+      out[i] = b[i].intersects( box );
+    }
+  }
+
+  //--------------------------------------------------------------------------
+  // Transformation
+  //--------------------------------------------------------------------------
+
+  // Applies Arvo's method to one box per lane, accumulating the terms in
+  // the same order as the scalar 'transform_bounds'
+  template<typename Box>
+  void transform_batch( const float* in,
+                        const typename box_traits<Box>::matrix_type& matrix,
+                        Box* out,
+                        std::size_t n )
+    noexcept
+  {
+    constexpr auto N = box_traits<Box>::dimensions;
+
+    const auto* in_boxes = reinterpret_cast<const Box*>( in );
+
+    simd::ints min_offsets[N];
+    simd::ints max_offsets[N];
+    for( auto c = std::size_t{0}; c < N; ++c ) {
+      min_offsets[c] = lane_offsets( 2 * N, c );
+      max_offsets[c] = lane_offsets( 2 * N, N + c );
+    }
+
+    auto i = std::size_t{0};
+    for( ; i + simd::width <= n; i += simd::width ) {
+      const auto* base = in + i * 2 * N;
+
+      simd::floats lo[N];
+      simd::floats hi[N];
+      for( auto c = std::size_t{0}; c < N; ++c ) {
+        lo[c] = simd::gather( base, min_offsets[c] );
+        hi[c] = simd::gather( base, max_offsets[c] );
+      }
+
+      float min[N][simd::width];
+      float max[N][simd::width];
+      for( auto r = std::size_t{0}; r < N; ++r ) {
+        const auto row = static_cast<std::ptrdiff_t>( r );
+        auto row_min = simd::broadcast( matrix(row, static_cast<std::ptrdiff_t>(N)) );
+        auto row_max = row_min;
+
+        for( auto c = std::size_t{0}; c < N; ++c ) {
+          const auto m = simd::broadcast( matrix(row, static_cast<std::ptrdiff_t>(c)) );
+          const auto a = m * lo[c];
+          const auto b = m * hi[c];
+
+          row_min = row_min + simd::min( a, b );
+          row_max = row_max + simd::max( a, b );
+        }
+        simd::store( min[r], row_min );
+        simd::store( max[r], row_max );
+      }
+
+      // Every lane is computed before any box is written, so 'out' may be
+      // 'in'
+      for( auto lane = std::size_t{0}; lane < simd::width; ++lane ) {
+        auto& result = out[i + lane];
+        if( in_boxes[i + lane].is_empty() ) {
+          result = Box{};
+          continue;
+        }
+
+        float lane_min[N];
+        float lane_max[N];
+        for( auto r = std::size_t{0}; r < N; ++r ) {
+          lane_min[r] = min[r][lane];
+          lane_max[r] = max[r][lane];
+        }
+        result = box_traits<Box>::make( lane_min, lane_max );
+      }
+    }
+
+    for( ; i < n; ++i ) {
+      out[i] = bit::math::transform_bounds( in_boxes[i], matrix );
+    }
+  }
+
+  template<typename Box, typename Float>
+  void transform_batch( const Float* in,
+                        const typename box_traits<Box>::matrix_type& matrix,
+                        Box* out,
+                        std::size_t n )
+    noexcept
+  {
+    const auto* in_boxes = reinterpret_cast<const Box*>( in );
+
+    for( auto i = std::size_t{0}; i < n; ++i ) {
+      out[i] = bit::math::transform_bounds( in_boxes[i], matrix );
+    }
+  }
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Batch Operations
+//----------------------------------------------------------------------------
+
+bit::math::aabb2 bit::math::bounds_of( const point2* points, std::size_t n )
+  noexcept
+{
+  assert( points != nullptr || n == 0 );
+
+  return bounds_batch<aabb2>( components(points), n );
+}
+
+bit::math::aabb3 bit::math::bounds_of( const point3* points, std::size_t n )
+  noexcept
+{
+  assert( points != nullptr || n == 0 );
+
+  return bounds_batch<aabb3>( components(points), n );
+}
+
+//----------------------------------------------------------------------------
+
+void bit::math::intersects( const aabb2* boxes,
+                            const aabb2& box,
+                            bool* out,
+                            std::size_t n )
+  noexcept
+{
+  assert( (boxes != nullptr && out != nullptr) || n == 0 );
+
+  intersects_batch( components(boxes), box, out, n );
+}
+
+void bit::math::intersects( const aabb3* boxes,
+                            const aabb3& box,
+                            bool* out,
+                            std::size_t n )
+  noexcept
+{
+  assert( (boxes != nullptr && out != nullptr) || n == 0 );
+
+  intersects_batch( components(boxes), box, out, n );
+}
+
+//----------------------------------------------------------------------------
+
+void bit::math::transform_bounds( const aabb2* in,
+                                  const mat3& matrix,
+                                  aabb2* out,
+                                  std::size_t n )
+  noexcept
+{
+  assert( (in != nullptr && out != nullptr) || n == 0 );
+
+  transform_batch( components(in), matrix, out, n );
+}
+
+void bit::math::transform_bounds( const aabb3* in,
+                                  const mat4& matrix,
+                                  aabb3* out,
+                                  std::size_t n )
+  noexcept
+{
+  assert( (in != nullptr && out != nullptr) || n == 0 );
+
+  transform_batch( components(in), matrix, out, n );
+}
@@ -0,0 +1,499 @@
+#include <bit/math/cellular.hpp>
+
+#include "detail/noise_tables.hpp"
+#include "detail/simd.hpp"
+
+#include <algorithm> // std::min, std::max
+#include <cassert>   // assert
+#include <cmath>     // std::sqrt, std::abs
+#include <limits>    // std::numeric_limits
+
+namespace {
+
+  using bit::math::float_t;
+  using bit::math::vec2;
+  using bit::math::vec3;
+
+  using bit::math::cellular::distance;
+  using bit::math::cellular::feature;
+
+  using bit::math::detail::floor_f_to_i;
+  using bit::math::detail::g_permutation_table;
+
+  namespace simd = bit::math::detail::simd;
+
+  //--------------------------------------------------------------------------
+  // Feature Points
+  //--------------------------------------------------------------------------
+
+  // The position of each cell's feature point within the cell, indexed by
+  // the cell's hash. Each axis reads a different part of the permutation
+  // table so that the axes are uncorrelated
+  struct feature_point_table
+  {
+    float x[256];
+    float y[256];
+    float z[256];
+  };
+
+  constexpr feature_point_table make_feature_point_table()
+  {
+    auto result = feature_point_table{};
+    for( auto i = 0; i < 256; ++i ) {
+      result.x[i] = (g_permutation_table[i] + 0.5f) / 256.0f;
+      result.y[i] = (g_permutation_table[i + 128] + 0.5f) / 256.0f;
+      result.z[i] = (g_permutation_table[i + 64] + 0.5f) / 256.0f;
+    }
+    return result;
+  }
+
+  constexpr feature_point_table g_feature_points = make_feature_point_table();
+
+  //--------------------------------------------------------------------------
+  // Distance Metrics
+  //--------------------------------------------------------------------------
+
+  // Each metric measures a distance in a form that orders the same as the
+  // true distance, and then 'finish'es the nearest distances into the true
+  // distance. This lets the euclidean metric defer its square roots
+
+  struct euclidean_metric
+  {
+    static float_t measure( float_t dx, float_t dy ) noexcept
+    {
+      return dx*dx + dy*dy;
+    }
+    static float_t measure( float_t dx, float_t dy, float_t dz ) noexcept
+    {
+      return dx*dx + dy*dy + dz*dz;
+    }
+    static simd::floats measure( simd::floats dx, simd::floats dy ) noexcept
+    {
+      return dx*dx + dy*dy;
+    }
+    static float_t finish( float_t d ) noexcept { return std::sqrt( d ); }
+    static simd::floats finish( simd::floats d ) noexcept { return simd::sqrt( d ); }
+  };
+
+  struct manhattan_metric
+  {
+    static float_t measure( float_t dx, float_t dy ) noexcept
+    {
+      return std::abs(dx) + std::abs(dy);
+    }
+    static float_t measure( float_t dx, float_t dy, float_t dz ) noexcept
+    {
+      return std::abs(dx) + std::abs(dy) + std::abs(dz);
+    }
+    static simd::floats measure( simd::floats dx, simd::floats dy ) noexcept
+    {
+      return simd::abs(dx) + simd::abs(dy);
+    }
+    static float_t finish( float_t d ) noexcept { return d; }
+    static simd::floats finish( simd::floats d ) noexcept { return d; }
+  };
+
+  struct chebyshev_metric
+  {
+    static float_t measure( float_t dx, float_t dy ) noexcept
+    {
+      return std::max( std::abs(dx), std::abs(dy) );
+    }
+    static float_t measure( float_t dx, float_t dy, float_t dz ) noexcept
+    {
+      return std::max( std::max( std::abs(dx), std::abs(dy) ), std::abs(dz) );
+    }
+    static simd::floats measure( simd::floats dx, simd::floats dy ) noexcept
+    {
+      return simd::max( simd::abs(dx), simd::abs(dy) );
+    }
+    static float_t finish( float_t d ) noexcept { return d; }
+    static simd::floats finish( simd::floats d ) noexcept { return d; }
+  };
+
+  // Invokes 'fn' with the metric object for 'metric', so that the metric is
+  // resolved once per call rather than once per feature point
+  template<typename Fn>
+  auto with_metric( distance metric, Fn fn )
+    -> decltype(fn( euclidean_metric{} ))
+  {
+    switch( metric ) {
+    case distance::manhattan:
+      return fn( manhattan_metric{} );
+    case distance::chebyshev:
+      return fn( chebyshev_metric{} );
+    case distance::euclidean:
+      break;
+    }
+    return fn( euclidean_metric{} );
+  }
+
+  template<typename T>
+  T select_feature( feature type, T f1, T f2 )
+    noexcept
+  {
+    switch( type ) {
+    case feature::f2:
+      return f2;
+    case feature::f2_minus_f1:
+      return f2 - f1;
+    case feature::f1:
+      break;
+    }
+    return f1;
+  }
+
+  //--------------------------------------------------------------------------
+  // Noise Kernels
+  //--------------------------------------------------------------------------
+
+  // A feature point may lie anywhere within its cell, so the nearest two
+  // points are not necessarily in the adjacent cells. Cells are searched in
+  // square rings of increasing radius around the sample's cell, and the
+  // search stops once every cell of the next ring is further than F2.
+  //
+  // A point of ring r+1 is at least 'ring_gap' from the sample along some
+  // axis, and every metric is at least its largest axis distance. F2 is
+  // always less than 4 (at most 2 cells away along one axis and 1 along the
+  // others), and the gap of ring r+1 is at least r, so no more than
+  // 'g_max_ring' rings are ever needed; the cap only guards against
+  // non-finite coordinates
+
+  constexpr int g_max_ring = 4;
+
+  // The smallest distance along one axis from the position 'f' within the
+  // sample's cell to any cell of ring 'r + 1'
+  inline float_t ring_gap( float_t f, int r )
+    noexcept
+  {
+    return std::min( float_t(r + 1) - f, float_t(r) + f );
+  }
+
+  inline simd::floats ring_gap( simd::floats f, int r )
+    noexcept
+  {
+    return simd::min( simd::broadcast( float(r + 1) ) - f,
+                      simd::broadcast( float(r) ) + f );
+  }
+
+  // The step between the cells of row 'd' of ring 'r'. Rows on the edge of
+  // the ring are visited in full; interior rows only have their two ends
+  inline int ring_step( bool is_edge, int r )
+    noexcept
+  {
+    return (is_edge || r == 0) ? 1 : 2 * r;
+  }
+
+  template<typename Metric>
+  float_t raw_noise_2d( float_t x, float_t y, feature type )
+    noexcept
+  {
+    const auto i = floor_f_to_i( x );
+    const auto j = floor_f_to_i( y );
+
+    const auto fx = x - float_t(i);
+    const auto fy = y - float_t(j);
+
+    auto f1 = std::numeric_limits<float_t>::max();
+    auto f2 = std::numeric_limits<float_t>::max();
+
+    for( auto r = 0; r <= g_max_ring; ++r ) {
+      for( auto dj = -r; dj <= r; ++dj ) {
+        const auto cj   = j + dj;
+        const auto pj   = g_permutation_table[cj & 255];
+        const auto step = ring_step( dj == -r || dj == r, r );
+
+        for( auto ci = i - r; ci <= i + r; ci += step ) {
+          const auto h = g_permutation_table[(ci & 255) + pj];
+
+          const auto dx = (ci + float_t(g_feature_points.x[h])) - x;
+          const auto dy = (cj + float_t(g_feature_points.y[h])) - y;
+          const auto d  = Metric::measure( dx, dy );
+
+          f2 = std::min( std::max( f1, d ), f2 );
+          f1 = std::min( f1, d );
+        }
+      }
+
+      const auto gap = std::min( ring_gap( fx, r ), ring_gap( fy, r ) );
+      if( Metric::measure( gap, float_t(0) ) >= f2 ) break;
+    }
+
+    return select_feature( type, Metric::finish( f1 ), Metric::finish( f2 ) );
+  }
+
+  template<typename Metric>
+  float_t raw_noise_3d( float_t x, float_t y, float_t z, feature type )
+    noexcept
+  {
+    const auto i = floor_f_to_i( x );
+    const auto j = floor_f_to_i( y );
+    const auto k = floor_f_to_i( z );
+
+    const auto fx = x - float_t(i);
+    const auto fy = y - float_t(j);
+    const auto fz = z - float_t(k);
+
+    auto f1 = std::numeric_limits<float_t>::max();
+    auto f2 = std::numeric_limits<float_t>::max();
+
+    for( auto r = 0; r <= g_max_ring; ++r ) {
+      for( auto dk = -r; dk <= r; ++dk ) {
+        const auto ck = k + dk;
+        const auto pk = g_permutation_table[ck & 255];
+
+        for( auto dj = -r; dj <= r; ++dj ) {
+          const auto cj   = j + dj;
+          const auto pj   = g_permutation_table[(cj & 255) + pk];
+          const auto step = ring_step( dk == -r || dk == r || dj == -r || dj == r, r );
+
+          for( auto ci = i - r; ci <= i + r; ci += step ) {
+            const auto h = g_permutation_table[(ci & 255) + pj];
+
+            const auto dx = (ci + float_t(g_feature_points.x[h])) - x;
+            const auto dy = (cj + float_t(g_feature_points.y[h])) - y;
+            const auto dz = (ck + float_t(g_feature_points.z[h])) - z;
+            const auto d  = Metric::measure( dx, dy, dz );
+
+            f2 = std::min( std::max( f1, d ), f2 );
+            f1 = std::min( f1, d );
+          }
+        }
+      }
+
+      const auto gap = std::min( std::min( ring_gap( fx, r ), ring_gap( fy, r ) ),
+                                 ring_gap( fz, r ) );
+      if( Metric::measure( gap, float_t(0), float_t(0) ) >= f2 ) break;
+    }
+
+    return select_feature( type, Metric::finish( f1 ), Metric::finish( f2 ) );
+  }
+
+  //--------------------------------------------------------------------------
+  // Lane-parallel 2D noise
+  //--------------------------------------------------------------------------
+
+  // Evaluates cellular::raw_noise( x, y ) for every lane. The nearest two
+  // distances are kept with min/max rather than branches, and the rings are
+  // searched until no lane can find a nearer point
+  template<typename Metric>
+  simd::floats raw_noise_lanes( simd::floats x,
+                                simd::floats y,
+                                feature type )
+    noexcept
+  {
+    const auto mask = simd::broadcast( 255 );
+
+    const auto i = simd::floor_to_int( x );
+    const auto j = simd::floor_to_int( y );
+
+    const auto fx = x - simd::to_floats( i );
+    const auto fy = y - simd::to_floats( j );
+
+    auto f1 = simd::broadcast( std::numeric_limits<float>::max() );
+    auto f2 = simd::broadcast( std::numeric_limits<float>::max() );
+
+    for( auto r = 0; r <= g_max_ring; ++r ) {
+      for( auto dj = -r; dj <= r; ++dj ) {
+        const auto cj   = j + simd::broadcast( dj );
+        const auto pj   = simd::gather( g_permutation_table, cj & mask );
+        const auto step = ring_step( dj == -r || dj == r, r );
+
+        for( auto di = -r; di <= r; di += step ) {
+          const auto ci = i + simd::broadcast( di );
+          const auto h  = simd::gather( g_permutation_table, (ci & mask) + pj );
+
+          const auto dx = (simd::to_floats(ci) + simd::gather( g_feature_points.x, h )) - x;
+          const auto dy = (simd::to_floats(cj) + simd::gather( g_feature_points.y, h )) - y;
+          const auto d  = Metric::measure( dx, dy );
+
+          f2 = simd::min( simd::max( f1, d ), f2 );
+          f1 = simd::min( f1, d );
+        }
+      }
+
+      const auto gap   = simd::min( ring_gap( fx, r ), ring_gap( fy, r ) );
+      const auto bound = Metric::measure( gap, simd::broadcast( 0.0f ) );
+      if( !simd::any( simd::less( bound, f2 ) ) ) break;
+    }
+
+    return select_feature( type, Metric::finish( f1 ), Metric::finish( f2 ) );
+  }
+
+  inline void raw_noise_2d_batch( const float* x,
+                                  const float* y,
+                                  float* out,
+                                  std::size_t n,
+                                  distance metric,
+                                  feature type )
+    noexcept
+  {
+    with_metric( metric, [&]( auto m ) {
+      using metric_type = decltype(m);
+
+      simd::for_each_lanes( x, y, out, n, [&]( simd::floats xs, simd::floats ys ) {
+        return raw_noise_lanes<metric_type>( xs, ys, type );
+      });
+    });
+  }
+
+  // Double-precision builds have no lane-parallel path
+  inline void raw_noise_2d_batch( const double* x,
+                                  const double* y,
+                                  double* out,
+                                  std::size_t n,
+                                  distance metric,
+                                  feature type )
+    noexcept
+  {
+    with_metric( metric, [&]( auto m ) {
+      using metric_type = decltype(m);
+
+      for( auto i = std::size_t{0}; i < n; ++i ) {
+        out[i] = raw_noise_2d<metric_type>( x[i], y[i], type );
+      }
+    });
+  }
+
+  //--------------------------------------------------------------------------
+  // Grid Fill
+  //--------------------------------------------------------------------------
+
+  inline void fill_grid_2d_batch( const vec2& origin,
+                                  const vec2& step,
+                                  std::size_t width,
+                                  std::size_t height,
+                                  distance metric,
+                                  feature type,
+                                  float* out )
+    noexcept
+  {
+    with_metric( metric, [&]( auto m ) {
+      using metric_type = decltype(m);
+
+      simd::for_each_grid_lanes(
+        origin.x(), origin.y(), step.x(), step.y(), width, height, out,
+        [&]( simd::floats xs, simd::floats ys ) {
+          return raw_noise_lanes<metric_type>( xs, ys, type );
+        }
+      );
+    });
+  }
+
+  inline void fill_grid_2d_batch( const vec2& origin,
+                                  const vec2& step,
+                                  std::size_t width,
+                                  std::size_t height,
+                                  distance metric,
+                                  feature type,
+                                  double* out )
+    noexcept
+  {
+    with_metric( metric, [&]( auto m ) {
+      using metric_type = decltype(m);
+
+      for( auto r = std::size_t{0}; r < height; ++r ) {
+        const auto y = origin.y() + step.y() * float_t(r);
+
+        for( auto c = std::size_t{0}; c < width; ++c ) {
+          const auto x = origin.x() + step.x() * float_t(c);
+
+          out[r * width + c] = raw_noise_2d<metric_type>( x, y, type );
+        }
+      }
+    });
+  }
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Raw Noise
+//----------------------------------------------------------------------------
+
+bit::math::float_t bit::math::cellular::raw_noise( float_t x, float_t y,
+                                                   distance metric,
+                                                   feature type )
+  noexcept
+{
+  return with_metric( metric, [&]( auto m ) {
+    return raw_noise_2d<decltype(m)>( x, y, type );
+  });
+}
+
+bit::math::float_t bit::math::cellular::raw_noise( float_t x, float_t y,
+                                                   float_t z,
+                                                   distance metric,
+                                                   feature type )
+  noexcept
+{
+  return with_metric( metric, [&]( auto m ) {
+    return raw_noise_3d<decltype(m)>( x, y, z, type );
+  });
+}
+
+//----------------------------------------------------------------------------
+
+void bit::math::cellular::batch_raw_noise( const float_t* x,
+                                           const float_t* y,
+                                           float_t* out,
+                                           std::size_t n,
+                                           distance metric,
+                                           feature type )
+  noexcept
+{
+  assert( (x != nullptr && y != nullptr && out != nullptr) || n == 0 );
+
+  raw_noise_2d_batch( x, y, out, n, metric, type );
+}
+
+//----------------------------------------------------------------------------
+// Grid Fill
+//----------------------------------------------------------------------------
+
+void bit::math::cellular::fill_grid_2d( const vec2& origin,
+                                        const vec2& step,
+                                        std::size_t width,
+                                        std::size_t height,
+                                        distance metric,
+                                        feature type,
+                                        float_t* out )
+  noexcept
+{
+  assert( out != nullptr || width * height == 0 );
+
+  fill_grid_2d_batch( origin, step, width, height, metric, type, out );
+}
+
+//----------------------------------------------------------------------------
+
+void bit::math::cellular::fill_grid_3d( const vec3& origin,
+                                        const vec3& step,
+                                        std::size_t width,
+                                        std::size_t height,
+                                        std::size_t depth,
+                                        distance metric,
+                                        feature type,
+                                        float_t* out )
+  noexcept
+{
+  assert( out != nullptr || width * height * depth == 0 );
+
+  with_metric( metric, [&]( auto m ) {
+    using metric_type = decltype(m);
+
+    for( auto s = std::size_t{0}; s < depth; ++s ) {
+      const auto z = origin.z() + step.z() * float_t(s);
+
+      for( auto r = std::size_t{0}; r < height; ++r ) {
+        const auto y   = origin.y() + step.y() * float_t(r);
+        const auto row = out + (s * height + r) * width;
+
+        for( auto c = std::size_t{0}; c < width; ++c ) {
+          const auto x = origin.x() + step.x() * float_t(c);
+
+          row[c] = raw_noise_3d<metric_type>( x, y, z, type );
+        }
+      }
+    }
+  });
+}
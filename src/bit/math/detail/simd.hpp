@@ -0,0 +1,449 @@
+/*****************************************************************************
+ * \file
+ * \brief This private header contains a thin lane-parallel abstraction over
+ *        SSE2/AVX2 used by the batch implementations
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  Bit Math Library.
+  https://github.com/bitwizeshift/bit-math
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_MATH_SRC_DETAIL_SIMD_HPP
+#define BIT_MATH_SRC_DETAIL_SIMD_HPP
+
+#include <algorithm> // std::copy_n, std::fill_n, std::min
+#include <cmath>     // std::sqrt
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint8_t
+
+#if defined(__AVX2__)
+# include <immintrin.h>
+# define BIT_MATH_SIMD_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || \
+      (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# include <emmintrin.h>
+# define BIT_MATH_SIMD_SSE2 1
+#endif
+
+namespace bit {
+  namespace math {
+    namespace detail {
+      namespace simd {
+
+        // All lane types are only ever used for single-precision floats;
+        // integer lanes are 32-bit and comparisons produce all-ones masks
+        // in integer lanes.
+        //
+        // 'min' and 'max' follow the SSE convention of returning their second
+        // operand when either is NaN, except in the scalar fallback; callers
+        // that care about NaN lanes should test for them with 'is_nan'.
+
+#if defined(BIT_MATH_SIMD_AVX2)
+
+        constexpr std::size_t width = 8;
+
+        struct floats { __m256 v; };
+        struct ints   { __m256i v; };
+
+        inline floats load( const float* p ) noexcept { return { _mm256_loadu_ps(p) }; }
+        inline void store( float* p, floats a ) noexcept { _mm256_storeu_ps(p, a.v); }
+        inline void store( int* p, ints a ) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), a.v); }
+        inline ints load( const int* p ) noexcept { return { _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)) }; }
+        inline floats broadcast( float a ) noexcept { return { _mm256_set1_ps(a) }; }
+        inline ints broadcast( int a ) noexcept { return { _mm256_set1_epi32(a) }; }
+
+        inline floats operator+( floats a, floats b ) noexcept { return { _mm256_add_ps(a.v, b.v) }; }
+        inline floats operator-( floats a, floats b ) noexcept { return { _mm256_sub_ps(a.v, b.v) }; }
+        inline floats operator*( floats a, floats b ) noexcept { return { _mm256_mul_ps(a.v, b.v) }; }
+        inline floats operator/( floats a, floats b ) noexcept { return { _mm256_div_ps(a.v, b.v) }; }
+        inline floats min( floats a, floats b ) noexcept { return { _mm256_min_ps(a.v, b.v) }; }
+        inline floats max( floats a, floats b ) noexcept { return { _mm256_max_ps(a.v, b.v) }; }
+        inline floats sqrt( floats a ) noexcept { return { _mm256_sqrt_ps(a.v) }; }
+
+        inline ints operator+( ints a, ints b ) noexcept { return { _mm256_add_epi32(a.v, b.v) }; }
+        inline ints operator-( ints a, ints b ) noexcept { return { _mm256_sub_epi32(a.v, b.v) }; }
+        inline ints operator&( ints a, ints b ) noexcept { return { _mm256_and_si256(a.v, b.v) }; }
+        inline ints operator|( ints a, ints b ) noexcept { return { _mm256_or_si256(a.v, b.v) }; }
+
+        inline ints less( floats a, floats b ) noexcept
+        {
+          return { _mm256_castps_si256(_mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ)) };
+        }
+        inline ints greater( floats a, floats b ) noexcept
+        {
+          return { _mm256_castps_si256(_mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ)) };
+        }
+        inline ints is_nan( floats a ) noexcept
+        {
+          return { _mm256_castps_si256(_mm256_cmp_ps(a.v, a.v, _CMP_UNORD_Q)) };
+        }
+        inline floats select( ints mask, floats a, floats b ) noexcept
+        {
+          return { _mm256_blendv_ps(b.v, a.v, _mm256_castsi256_ps(mask.v)) };
+        }
+
+        inline bool any( ints mask ) noexcept
+        {
+          return _mm256_movemask_ps(_mm256_castsi256_ps(mask.v)) != 0;
+        }
+
+        inline ints truncate( floats a ) noexcept { return { _mm256_cvttps_epi32(a.v) }; }
+        inline floats to_floats( ints a ) noexcept { return { _mm256_cvtepi32_ps(a.v) }; }
+
+        inline ints gather( const int* table, ints index ) noexcept
+        {
+          return { _mm256_i32gather_epi32(table, index.v, 4) };
+        }
+        inline floats gather( const float* table, ints index ) noexcept
+        {
+          return { _mm256_i32gather_ps(table, index.v, 4) };
+        }
+        // There is no byte gather, so the lanes are spilled and fetched
+        // individually
+        inline ints gather( const std::uint8_t* table, ints index ) noexcept
+        {
+          alignas(32) int i[8];
+          _mm256_store_si256(reinterpret_cast<__m256i*>(i), index.v);
+          return { _mm256_setr_epi32(table[i[0]], table[i[1]], table[i[2]], table[i[3]],
+                                     table[i[4]], table[i[5]], table[i[6]], table[i[7]]) };
+        }
+
+#elif defined(BIT_MATH_SIMD_SSE2)
+
+        constexpr std::size_t width = 4;
+
+        struct floats { __m128 v; };
+        struct ints   { __m128i v; };
+
+        inline floats load( const float* p ) noexcept { return { _mm_loadu_ps(p) }; }
+        inline void store( float* p, floats a ) noexcept { _mm_storeu_ps(p, a.v); }
+        inline void store( int* p, ints a ) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), a.v); }
+        inline ints load( const int* p ) noexcept { return { _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)) }; }
+        inline floats broadcast( float a ) noexcept { return { _mm_set1_ps(a) }; }
+        inline ints broadcast( int a ) noexcept { return { _mm_set1_epi32(a) }; }
+
+        inline floats operator+( floats a, floats b ) noexcept { return { _mm_add_ps(a.v, b.v) }; }
+        inline floats operator-( floats a, floats b ) noexcept { return { _mm_sub_ps(a.v, b.v) }; }
+        inline floats operator*( floats a, floats b ) noexcept { return { _mm_mul_ps(a.v, b.v) }; }
+        inline floats operator/( floats a, floats b ) noexcept { return { _mm_div_ps(a.v, b.v) }; }
+        inline floats min( floats a, floats b ) noexcept { return { _mm_min_ps(a.v, b.v) }; }
+        inline floats max( floats a, floats b ) noexcept { return { _mm_max_ps(a.v, b.v) }; }
+        inline floats sqrt( floats a ) noexcept { return { _mm_sqrt_ps(a.v) }; }
+
+        inline ints operator+( ints a, ints b ) noexcept { return { _mm_add_epi32(a.v, b.v) }; }
+        inline ints operator-( ints a, ints b ) noexcept { return { _mm_sub_epi32(a.v, b.v) }; }
+        inline ints operator&( ints a, ints b ) noexcept { return { _mm_and_si128(a.v, b.v) }; }
+        inline ints operator|( ints a, ints b ) noexcept { return { _mm_or_si128(a.v, b.v) }; }
+
+        inline ints less( floats a, floats b ) noexcept
+        {
+          return { _mm_castps_si128(_mm_cmplt_ps(a.v, b.v)) };
+        }
+        inline ints greater( floats a, floats b ) noexcept
+        {
+          return { _mm_castps_si128(_mm_cmpgt_ps(a.v, b.v)) };
+        }
+        inline ints is_nan( floats a ) noexcept
+        {
+          return { _mm_castps_si128(_mm_cmpunord_ps(a.v, a.v)) };
+        }
+        inline floats select( ints mask, floats a, floats b ) noexcept
+        {
+          const auto m = _mm_castsi128_ps(mask.v);
+          return { _mm_or_ps(_mm_and_ps(m, a.v), _mm_andnot_ps(m, b.v)) };
+        }
+
+        inline bool any( ints mask ) noexcept
+        {
+          return _mm_movemask_ps(_mm_castsi128_ps(mask.v)) != 0;
+        }
+
+        inline ints truncate( floats a ) noexcept { return { _mm_cvttps_epi32(a.v) }; }
+        inline floats to_floats( ints a ) noexcept { return { _mm_cvtepi32_ps(a.v) }; }
+
+        // SSE2 has no gather instruction, so the lanes are spilled and
+        // fetched individually
+        inline ints gather( const int* table, ints index ) noexcept
+        {
+          alignas(16) int i[4];
+          _mm_store_si128(reinterpret_cast<__m128i*>(i), index.v);
+          return { _mm_setr_epi32(table[i[0]], table[i[1]],
+                                  table[i[2]], table[i[3]]) };
+        }
+        inline floats gather( const float* table, ints index ) noexcept
+        {
+          alignas(16) int i[4];
+          _mm_store_si128(reinterpret_cast<__m128i*>(i), index.v);
+          return { _mm_setr_ps(table[i[0]], table[i[1]],
+                               table[i[2]], table[i[3]]) };
+        }
+        inline ints gather( const std::uint8_t* table, ints index ) noexcept
+        {
+          alignas(16) int i[4];
+          _mm_store_si128(reinterpret_cast<__m128i*>(i), index.v);
+          return { _mm_setr_epi32(table[i[0]], table[i[1]],
+                                  table[i[2]], table[i[3]]) };
+        }
+
+#else
+
+        constexpr std::size_t width = 1;
+
+        struct floats { float v; };
+        struct ints   { int v; };
+
+        inline floats load( const float* p ) noexcept { return { *p }; }
+        inline void store( float* p, floats a ) noexcept { *p = a.v; }
+        inline void store( int* p, ints a ) noexcept { *p = a.v; }
+        inline ints load( const int* p ) noexcept { return { *p }; }
+        inline floats broadcast( float a ) noexcept { return { a }; }
+        inline ints broadcast( int a ) noexcept { return { a }; }
+
+        inline floats operator+( floats a, floats b ) noexcept { return { a.v + b.v }; }
+        inline floats operator-( floats a, floats b ) noexcept { return { a.v - b.v }; }
+        inline floats operator*( floats a, floats b ) noexcept { return { a.v * b.v }; }
+        inline floats operator/( floats a, floats b ) noexcept { return { a.v / b.v }; }
+        inline floats min( floats a, floats b ) noexcept { return { b.v < a.v ? b.v : a.v }; }
+        inline floats max( floats a, floats b ) noexcept { return { a.v < b.v ? b.v : a.v }; }
+        inline floats sqrt( floats a ) noexcept { return { std::sqrt(a.v) }; }
+
+        inline ints operator+( ints a, ints b ) noexcept { return { a.v + b.v }; }
+        inline ints operator-( ints a, ints b ) noexcept { return { a.v - b.v }; }
+        inline ints operator&( ints a, ints b ) noexcept { return { a.v & b.v }; }
+        inline ints operator|( ints a, ints b ) noexcept { return { a.v | b.v }; }
+
+        inline ints less( floats a, floats b ) noexcept { return { a.v < b.v ? -1 : 0 }; }
+        inline ints greater( floats a, floats b ) noexcept { return { a.v > b.v ? -1 : 0 }; }
+        inline ints is_nan( floats a ) noexcept { return { a.v != a.v ? -1 : 0 }; }
+        inline floats select( ints mask, floats a, floats b ) noexcept
+        {
+          return { mask.v ? a.v : b.v };
+        }
+
+        inline bool any( ints mask ) noexcept { return mask.v != 0; }
+
+        inline ints truncate( floats a ) noexcept { return { static_cast<int>(a.v) }; }
+        inline floats to_floats( ints a ) noexcept { return { static_cast<float>(a.v) }; }
+
+        inline ints gather( const int* table, ints index ) noexcept
+        {
+          return { table[index.v] };
+        }
+        inline floats gather( const float* table, ints index ) noexcept
+        {
+          return { table[index.v] };
+        }
+        inline ints gather( const std::uint8_t* table, ints index ) noexcept
+        {
+          return { table[index.v] };
+        }
+
+#endif
+
+        //--------------------------------------------------------------------
+        // Width-independent helpers
+        //--------------------------------------------------------------------
+
+        /// \brief Rounds each lane towards negative infinity
+        ///
+        /// \param a the lanes to floor
+        /// \return the floored lanes as integers
+        inline ints floor_to_int( floats a )
+          noexcept
+        {
+          const auto i = truncate(a);
+
+          // Truncation rounds towards zero; the comparison mask is -1 for
+          // every lane that needs to be corrected downwards
+          return i + less(a, to_floats(i));
+        }
+
+        /// \brief Computes the absolute value of each lane
+        ///
+        /// \param a the lanes
+        /// \return the absolute lanes
+        inline floats abs( floats a )
+          noexcept
+        {
+          return max( a, broadcast(0.0f) - a );
+        }
+
+        /// \brief Invokes \p fn on every set of lanes of the \p n values
+        ///
+        /// \param in pointer to the \p n inputs
+        /// \param out pointer to the \p n results
+        /// \param n the number of values
+        /// \param fn the function mapping the input lanes to the result lanes
+        template<typename Fn>
+        void for_each_lanes( const float* in,
+                             float* out,
+                             std::size_t n,
+                             Fn fn )
+          noexcept
+        {
+          const auto lanes = width;
+
+          auto i = std::size_t{0};
+          for( ; i + lanes <= n; i += lanes ) {
+            store( out + i, fn( load(in + i) ) );
+          }
+
+          if( i < n ) {
+            float in_tail[width] = {};
+            float out_tail[width];
+
+            std::copy_n( in + i, n - i, in_tail );
+            store( out_tail, fn( load(in_tail) ) );
+            std::copy_n( out_tail, n - i, out + i );
+          }
+        }
+
+        /// \brief Invokes \p fn on every set of lanes of the \p n samples
+        ///
+        /// The tail is padded out to a full set of lanes so that every sample
+        /// is computed by the same lane-parallel code path
+        ///
+        /// \param x pointer to the \p n x-coordinates
+        /// \param y pointer to the \p n y-coordinates
+        /// \param out pointer to the \p n results
+        /// \param n the number of samples
+        /// \param fn the function mapping the (x,y) lanes to the result lanes
+        template<typename Fn>
+        void for_each_lanes( const float* x,
+                             const float* y,
+                             float* out,
+                             std::size_t n,
+                             Fn fn )
+          noexcept
+        {
+          const auto lanes = width;
+
+          auto i = std::size_t{0};
+          for( ; i + lanes <= n; i += lanes ) {
+            store( out + i, fn( load(x + i), load(y + i) ) );
+          }
+
+          if( i < n ) {
+            float x_tail[width] = {};
+            float y_tail[width] = {};
+            float out_tail[width];
+
+            std::copy_n( x + i, n - i, x_tail );
+            std::copy_n( y + i, n - i, y_tail );
+            store( out_tail, fn( load(x_tail), load(y_tail) ) );
+            std::copy_n( out_tail, n - i, out + i );
+          }
+        }
+
+        /// \brief Invokes \p fn on every set of lanes of the \p n samples of
+        ///        three inputs
+        ///
+        /// \param a pointer to the \p n first inputs
+        /// \param b pointer to the \p n second inputs
+        /// \param c pointer to the \p n third inputs
+        /// \param out pointer to the \p n results
+        /// \param n the number of samples
+        /// \param fn the function mapping the (a,b,c) lanes to the result lanes
+        template<typename Fn>
+        void for_each_lanes( const float* a,
+                             const float* b,
+                             const float* c,
+                             float* out,
+                             std::size_t n,
+                             Fn fn )
+          noexcept
+        {
+          const auto lanes = width;
+
+          auto i = std::size_t{0};
+          for( ; i + lanes <= n; i += lanes ) {
+            store( out + i, fn( load(a + i), load(b + i), load(c + i) ) );
+          }
+
+          if( i < n ) {
+            float a_tail[width] = {};
+            float b_tail[width] = {};
+            float c_tail[width] = {};
+            float out_tail[width];
+
+            std::copy_n( a + i, n - i, a_tail );
+            std::copy_n( b + i, n - i, b_tail );
+            std::copy_n( c + i, n - i, c_tail );
+            store( out_tail, fn( load(a_tail), load(b_tail), load(c_tail) ) );
+            std::copy_n( out_tail, n - i, out + i );
+          }
+        }
+
+        /// \brief Invokes \p fn on every set of lanes of a 2-dimensional grid
+        ///        of samples
+        ///
+        /// The sample at column \c c and row \c r lies at
+        /// \c (origin_x + step_x * c, origin_y + step_y * r) and is written to
+        /// \c out[r * width + c]. Coordinates are generated a bounded chunk of
+        /// columns at a time, so no allocation is needed for wide grids.
+        ///
+        /// \param origin_x the x-coordinate of the first sample
+        /// \param origin_y the y-coordinate of the first sample
+        /// \param step_x the distance between adjacent columns
+        /// \param step_y the distance between adjacent rows
+        /// \param width the number of samples along the x-axis
+        /// \param height the number of samples along the y-axis
+        /// \param out the buffer to write to; must hold width * height samples
+        /// \param fn the function mapping the (x,y) lanes to the result lanes
+        template<typename Fn>
+        void for_each_grid_lanes( float origin_x, float origin_y,
+                                  float step_x, float step_y,
+                                  std::size_t width,
+                                  std::size_t height,
+                                  float* out,
+                                  Fn fn )
+          noexcept
+        {
+          constexpr std::size_t chunk = 256;
+
+          float xs[chunk];
+          float ys[chunk];
+
+          for( auto r = std::size_t{0}; r < height; ++r ) {
+            const auto y = origin_y + step_y * float(r);
+            std::fill_n( ys, chunk, y );
+
+            for( auto c = std::size_t{0}; c < width; c += chunk ) {
+              const auto count = std::min( chunk, width - c );
+
+              for( auto i = std::size_t{0}; i < count; ++i ) {
+                xs[i] = origin_x + step_x * float(c + i);
+              }
+              for_each_lanes( xs, ys, out + r * width + c, count, fn );
+            }
+          }
+        }
+
+      } // namespace simd
+    } // namespace detail
+  } // namespace math
+} // namespace bit
+
+#endif /* BIT_MATH_SRC_DETAIL_SIMD_HPP */
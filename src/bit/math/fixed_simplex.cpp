@@ -0,0 +1,256 @@
+#include <bit/math/fixed_simplex.hpp>
+
+#include "detail/noise_tables.hpp"
+
+#include <cassert> // assert
+#include <cstdint> // std::int64_t
+
+namespace {
+
+  using bit::math::fixed_simplex::fixed_t;
+
+  using bit::math::detail::g_grad;
+  using bit::math::detail::g_permutation_table;
+  using bit::math::detail::g_permutation_mod12;
+
+  //--------------------------------------------------------------------------
+  // Fixed-Point Arithmetic
+  //--------------------------------------------------------------------------
+
+  // All intermediate values are Q34.30 in a 64-bit integer. Inputs are
+  // Q16.16, so the skewed coordinates, the squared distances and the
+  // products below all stay well within 63 bits over the whole input range
+  using wide_t = std::int64_t;
+
+  constexpr int    g_fraction_bits = 30;
+  constexpr wide_t g_one = wide_t(1) << g_fraction_bits;
+
+  // The skew and unskew factors of 'simplex.cpp', rounded to Q30
+  constexpr wide_t g_skew_2d   = 393016785; // 0.5 * (sqrt(3) - 1)
+  constexpr wide_t g_unskew_2d = 226908346; // (3 - sqrt(3)) / 6
+  constexpr wide_t g_skew_3d   = 357913941; // 1 / 3
+  constexpr wide_t g_unskew_3d = 178956971; // 1 / 6
+
+  // The squared radius of each corner's contribution
+  constexpr wide_t g_falloff_2d = g_one / 2; // 0.5
+  constexpr wide_t g_falloff_3d = 644245094; // 0.6
+
+  // Right-shifting a negative value is implementation-defined before C++20,
+  // so the flooring shift is spelled out in terms of non-negative values
+  constexpr wide_t shift_floor( wide_t value, int bits ) noexcept
+  {
+    return value >= 0 ? (value >> bits) : ~((~value) >> bits);
+  }
+
+  // Rounds a Q30 value down to its integer part
+  constexpr int floor_to_int( wide_t value ) noexcept
+  {
+    return static_cast<int>( shift_floor( value, g_fraction_bits ) );
+  }
+
+  // Converts a Q16.16 value to Q30
+  constexpr wide_t widen( fixed_t value ) noexcept
+  {
+    return static_cast<wide_t>( value ) * (wide_t(1) << (g_fraction_bits - 16));
+  }
+
+  constexpr wide_t multiply( wide_t lhs, wide_t rhs ) noexcept
+  {
+    return shift_floor( lhs * rhs, g_fraction_bits );
+  }
+
+  // Converts the Q30 sum of the corner contributions to a Q16.16 result,
+  // rounding to nearest
+  constexpr fixed_t narrow( wide_t value ) noexcept
+  {
+    return static_cast<fixed_t>(
+      shift_floor( value + (wide_t(1) << (g_fraction_bits - 17)),
+                   g_fraction_bits - 16 )
+    );
+  }
+
+  // The contribution of a single corner, given its radial falloff term 't'
+  // and the dot product of its gradient and offset
+  constexpr wide_t contribution( wide_t t, wide_t dot ) noexcept
+  {
+    return t <= 0 ? 0 : multiply( multiply( multiply( t, t ),
+                                            multiply( t, t ) ), dot );
+  }
+
+  //--------------------------------------------------------------------------
+  // Noise Kernels
+  //--------------------------------------------------------------------------
+
+  // These mirror raw_noise_2d and raw_noise_3d in 'simplex.cpp' step for
+  // step, so that the results agree to within the fixed-point precision
+
+  fixed_t raw_noise_2d( fixed_t x, fixed_t y )
+    noexcept
+  {
+    // Skew the input space to determine which simplex cell we're in
+    const auto s = shift_floor( (wide_t(x) + y) * g_skew_2d, 16 );
+    const auto i = floor_to_int( widen( x ) + s );
+    const auto j = floor_to_int( widen( y ) + s );
+
+    const auto t = (wide_t(i) + j) * g_unskew_2d;
+
+    // The x,y distances from the unskewed cell origin
+    const auto x0 = widen( x ) - (i * g_one - t);
+    const auto y0 = widen( y ) - (j * g_one - t);
+
+    // Determine which simplex we are in
+    const auto i1 = x0 > y0 ? 1 : 0;
+    const auto j1 = 1 - i1;
+
+    const auto x1 = x0 - i1 * g_one + g_unskew_2d;
+    const auto y1 = y0 - j1 * g_one + g_unskew_2d;
+    const auto x2 = x0 - g_one + 2 * g_unskew_2d;
+    const auto y2 = y0 - g_one + 2 * g_unskew_2d;
+
+    // Work out the hashed gradient indices of the three simplex corners
+    const auto ii = i & 255;
+    const auto jj = j & 255;
+    const auto& g0 = g_grad[g_permutation_mod12.values[ii + g_permutation_table[jj]]];
+    const auto& g1 = g_grad[g_permutation_mod12.values[ii + i1 + g_permutation_table[jj + j1]]];
+    const auto& g2 = g_grad[g_permutation_mod12.values[ii + 1 + g_permutation_table[jj + 1]]];
+
+    // Calculate the contribution from the three corners
+    auto n = wide_t(0);
+    n += contribution( g_falloff_2d - multiply( x0, x0 ) - multiply( y0, y0 ),
+                       g0[0] * x0 + g0[1] * y0 );
+    n += contribution( g_falloff_2d - multiply( x1, x1 ) - multiply( y1, y1 ),
+                       g1[0] * x1 + g1[1] * y1 );
+    n += contribution( g_falloff_2d - multiply( x2, x2 ) - multiply( y2, y2 ),
+                       g2[0] * x2 + g2[1] * y2 );
+
+    // Scale the result to return values in the interval [-1,1]
+    return narrow( 70 * n );
+  }
+
+  fixed_t raw_noise_3d( fixed_t x, fixed_t y, fixed_t z )
+    noexcept
+  {
+    // Skew the input space to determine which simplex cell we're in
+    const auto s = shift_floor( (wide_t(x) + y + z) * g_skew_3d, 16 );
+    const auto i = floor_to_int( widen( x ) + s );
+    const auto j = floor_to_int( widen( y ) + s );
+    const auto k = floor_to_int( widen( z ) + s );
+
+    const auto t = (wide_t(i) + j + k) * g_unskew_3d;
+
+    // The x,y,z distances from the unskewed cell origin
+    const auto x0 = widen( x ) - (i * g_one - t);
+    const auto y0 = widen( y ) - (j * g_one - t);
+    const auto z0 = widen( z ) - (k * g_one - t);
+
+    // Determine which simplex we are in
+    int i1, j1, k1; // Offsets for second corner of simplex in (i,j,k) coords
+    int i2, j2, k2; // Offsets for third corner of simplex in (i,j,k) coords
+
+    if(x0>=y0){
+      if(y0>=z0){        // X Y Z order
+        i1 = 1; j1 = 0; k1 = 0;
+        i2 = 1; j2 = 1; k2 = 0;
+      }else if(x0>=z0){  // X Z Y order
+        i1 = 1; j1 = 0; k1 = 0;
+        i2 = 1; j2 = 0; k2 = 1;
+      }else{             // Z X Y order
+        i1 = 0; j1 = 0; k1 = 1;
+        i2 = 1; j2 = 0; k2 = 1;
+      }
+    }else{
+      if(y0<z0){         // Z Y X order
+        i1 = 0; j1 = 0; k1 = 1;
+        i2 = 0; j2 = 1; k2 = 1;
+      }else if(x0<z0){   // Y Z X order
+        i1 = 0; j1 = 1; k1 = 0;
+        i2 = 0; j2 = 1; k2 = 1;
+      }else{             // Y X Z order
+        i1 = 0; j1 = 1; k1 = 0;
+        i2 = 1; j2 = 1; k2 = 0;
+      }
+    }
+
+    const auto x1 = x0 - i1 * g_one + g_unskew_3d; // Offsets for second corner
+    const auto y1 = y0 - j1 * g_one + g_unskew_3d;
+    const auto z1 = z0 - k1 * g_one + g_unskew_3d;
+    const auto x2 = x0 - i2 * g_one + 2 * g_unskew_3d; // Offsets for third corner
+    const auto y2 = y0 - j2 * g_one + 2 * g_unskew_3d;
+    const auto z2 = z0 - k2 * g_one + 2 * g_unskew_3d;
+    const auto x3 = x0 - g_one + 3 * g_unskew_3d; // Offsets for last corner
+    const auto y3 = y0 - g_one + 3 * g_unskew_3d;
+    const auto z3 = z0 - g_one + 3 * g_unskew_3d;
+
+    // Work out the hashed gradient indices of the four simplex corners
+    const auto ii = i & 255;
+    const auto jj = j & 255;
+    const auto kk = k & 255;
+    const auto& g0 = g_grad[g_permutation_mod12.values[ii + g_permutation_table[jj + g_permutation_table[kk]]]];
+    const auto& g1 = g_grad[g_permutation_mod12.values[ii + i1 + g_permutation_table[jj + j1 + g_permutation_table[kk + k1]]]];
+    const auto& g2 = g_grad[g_permutation_mod12.values[ii + i2 + g_permutation_table[jj + j2 + g_permutation_table[kk + k2]]]];
+    const auto& g3 = g_grad[g_permutation_mod12.values[ii + 1 + g_permutation_table[jj + 1 + g_permutation_table[kk + 1]]]];
+
+    // Calculate the contribution from the four corners
+    auto n = wide_t(0);
+    n += contribution( g_falloff_3d - multiply( x0, x0 ) - multiply( y0, y0 ) - multiply( z0, z0 ),
+                       g0[0] * x0 + g0[1] * y0 + g0[2] * z0 );
+    n += contribution( g_falloff_3d - multiply( x1, x1 ) - multiply( y1, y1 ) - multiply( z1, z1 ),
+                       g1[0] * x1 + g1[1] * y1 + g1[2] * z1 );
+    n += contribution( g_falloff_3d - multiply( x2, x2 ) - multiply( y2, y2 ) - multiply( z2, z2 ),
+                       g2[0] * x2 + g2[1] * y2 + g2[2] * z2 );
+    n += contribution( g_falloff_3d - multiply( x3, x3 ) - multiply( y3, y3 ) - multiply( z3, z3 ),
+                       g3[0] * x3 + g3[1] * y3 + g3[2] * z3 );
+
+    // Scale the result to return values in the interval [-1,1]
+    return narrow( 32 * n );
+  }
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Raw Noise
+//----------------------------------------------------------------------------
+
+bit::math::fixed_simplex::fixed_t
+  bit::math::fixed_simplex::raw_noise( fixed_t x, fixed_t y )
+  noexcept
+{
+  return raw_noise_2d( x, y );
+}
+
+bit::math::fixed_simplex::fixed_t
+  bit::math::fixed_simplex::raw_noise( fixed_t x, fixed_t y, fixed_t z )
+  noexcept
+{
+  return raw_noise_3d( x, y, z );
+}
+
+//----------------------------------------------------------------------------
+
+void bit::math::fixed_simplex::batch_raw_noise( const fixed_t* x,
+                                                const fixed_t* y,
+                                                fixed_t* out,
+                                                std::size_t n )
+  noexcept
+{
+  assert( (x != nullptr && y != nullptr && out != nullptr) || n == 0 );
+
+  for( auto i = std::size_t{0}; i < n; ++i ) {
+    out[i] = raw_noise_2d( x[i], y[i] );
+  }
+}
+
+void bit::math::fixed_simplex::batch_raw_noise( const fixed_t* x,
+                                                const fixed_t* y,
+                                                const fixed_t* z,
+                                                fixed_t* out,
+                                                std::size_t n )
+  noexcept
+{
+  assert( (x != nullptr && y != nullptr && z != nullptr && out != nullptr)
+          || n == 0 );
+
+  for( auto i = std::size_t{0}; i < n; ++i ) {
+    out[i] = raw_noise_3d( x[i], y[i], z[i] );
+  }
+}
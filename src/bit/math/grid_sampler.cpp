@@ -0,0 +1,226 @@
+#include <bit/math/grid_sampler.hpp>
+
+#include "detail/simd.hpp"
+
+#include <algorithm> // std::copy_n
+#include <cassert>   // assert
+#include <climits>   // INT_MAX
+#include <cmath>     // std::floor, std::fmod, std::abs
+
+namespace {
+
+  using bit::math::float_t;
+  using bit::math::grid_address;
+
+  namespace simd = bit::math::detail::simd;
+
+  //--------------------------------------------------------------------------
+  // Addressing
+  //--------------------------------------------------------------------------
+
+  // Each address maps lanes of integral texel indices, held as floats, onto
+  // [0, size) identically to 'detail::address_texel'. The lane arithmetic
+  // (the integer conversion, and the products in 'wrap_lanes') is only
+  // exact for coordinates within 'g_lane_limit'. Every float beyond it is
+  // integral, so such coordinates are first 'reduce'd onto an equivalent
+  // coordinate within the limit that addresses the same texels
+
+  constexpr float g_lane_limit = 8388608.0f; // 2^23
+
+  // Computes 'i mod size' in [0, size)
+  inline simd::floats wrap_lanes( simd::floats i, simd::floats size )
+    noexcept
+  {
+    const auto zero = simd::broadcast( 0.0f );
+    const auto quotient = simd::to_floats( simd::floor_to_int( i / size ) );
+
+    // The rounded division may be off by one in either direction
+    auto m = i - quotient * size;
+    m = simd::select( simd::less(m, zero), m + size, m );
+    return simd::select( simd::less(m, size), m, m - size );
+  }
+
+  struct clamp_address
+  {
+    simd::floats last;
+    float size;
+
+    // Every coordinate beyond the grid addresses the edge texels
+    float reduce( float c ) const noexcept
+    {
+      return c < 0.0f ? -1.0f : size;
+    }
+
+    simd::floats operator()( simd::floats i ) const noexcept
+    {
+      return simd::min( simd::max( i, simd::broadcast(0.0f) ), last );
+    }
+  };
+
+  struct wrap_address
+  {
+    simd::floats size;
+    float period;
+
+    float reduce( float c ) const noexcept
+    {
+      return std::fmod( c, period );
+    }
+
+    simd::floats operator()( simd::floats i ) const noexcept
+    {
+      return wrap_lanes( i, size );
+    }
+  };
+
+  struct mirror_address
+  {
+    simd::floats size;
+    simd::floats period;
+    float scalar_period;
+
+    float reduce( float c ) const noexcept
+    {
+      return std::fmod( c, scalar_period );
+    }
+
+    simd::floats operator()( simd::floats i ) const noexcept
+    {
+      const auto m = wrap_lanes( i, period );
+      const auto reflected = period - simd::broadcast(1.0f) - m;
+
+      return simd::select( simd::less(m, size), m, reflected );
+    }
+  };
+
+  //--------------------------------------------------------------------------
+
+  template<typename Address>
+  void address_lanes( const float* coords,
+                      std::size_t n,
+                      Address address,
+                      int* lo,
+                      int* hi,
+                      float* fraction )
+    noexcept
+  {
+    const auto one   = simd::broadcast( 1.0f );
+    const auto limit = simd::broadcast( g_lane_limit );
+
+    const auto apply = [&]( const float* c, int* lo, int* hi, float* fraction )
+    {
+      auto coord = simd::load( c );
+
+      // Coordinates beyond the limit are rare, so they are reduced one at a
+      // time. std::fmod is exact, and the reduced coordinates are integral
+      if( simd::any( simd::greater( simd::abs(coord), limit ) ) ) {
+        float reduced[simd::width];
+        simd::store( reduced, coord );
+        for( auto& r : reduced ) {
+          if( std::abs(r) > g_lane_limit ) r = address.reduce( r );
+        }
+        coord = simd::load( reduced );
+      }
+
+      const auto i = simd::to_floats( simd::floor_to_int( coord ) );
+
+      simd::store( fraction, coord - i );
+      simd::store( lo, simd::truncate( address(i) ) );
+      simd::store( hi, simd::truncate( address(i + one) ) );
+    };
+
+    auto i = std::size_t{0};
+    for( ; i + simd::width <= n; i += simd::width ) {
+      apply( coords + i, lo + i, hi + i, fraction + i );
+    }
+
+    // The tail is padded out to a full set of lanes so that every
+    // coordinate is addressed by the same code path
+    if( i < n ) {
+      float coords_tail[simd::width] = {};
+      int lo_tail[simd::width];
+      int hi_tail[simd::width];
+      float fraction_tail[simd::width];
+
+      std::copy_n( coords + i, n - i, coords_tail );
+      apply( coords_tail, lo_tail, hi_tail, fraction_tail );
+      std::copy_n( lo_tail, n - i, lo + i );
+      std::copy_n( hi_tail, n - i, hi + i );
+      std::copy_n( fraction_tail, n - i, fraction + i );
+    }
+  }
+
+  inline void address_batch( const float* coords,
+                             std::size_t n,
+                             std::size_t size,
+                             grid_address address,
+                             int* lo,
+                             int* hi,
+                             float* fraction )
+    noexcept
+  {
+    const auto scalar_size = static_cast<float>(size);
+    const auto lanes_size  = simd::broadcast( scalar_size );
+
+    switch( address ) {
+    case grid_address::clamp:
+      {
+        const auto last = simd::broadcast( static_cast<float>(size - 1) );
+        address_lanes( coords, n, clamp_address{last, scalar_size}, lo, hi, fraction );
+        break;
+      }
+    case grid_address::wrap:
+      address_lanes( coords, n, wrap_address{lanes_size, scalar_size}, lo, hi, fraction );
+      break;
+    case grid_address::mirror:
+      {
+        const auto period = lanes_size + lanes_size;
+        address_lanes( coords, n, mirror_address{lanes_size, period, 2.0f * scalar_size},
+                       lo, hi, fraction );
+        break;
+      }
+    }
+  }
+
+  inline void address_batch( const double* coords,
+                             std::size_t n,
+                             std::size_t size,
+                             grid_address address,
+                             int* lo,
+                             int* hi,
+                             double* fraction )
+    noexcept
+  {
+    using bit::math::detail::address_texel;
+
+    for( auto i = std::size_t{0}; i < n; ++i ) {
+      const auto f = std::floor( coords[i] );
+      const auto index = static_cast<std::ptrdiff_t>( f );
+
+      lo[i] = static_cast<int>( address_texel( index, size, address ) );
+      hi[i] = static_cast<int>( address_texel( index + 1, size, address ) );
+      fraction[i] = coords[i] - f;
+    }
+  }
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Addressing
+//----------------------------------------------------------------------------
+
+void bit::math::detail::address_texels( const float_t* coords,
+                                        std::size_t n,
+                                        std::size_t size,
+                                        grid_address address,
+                                        int* lo,
+                                        int* hi,
+                                        float_t* fraction )
+  noexcept
+{
+  assert( size > 0 && size <= INT_MAX );
+  assert( (coords != nullptr && lo != nullptr && hi != nullptr && fraction != nullptr)
+          || n == 0 );
+
+  address_batch( coords, n, size, address, lo, hi, fraction );
+}
@@ -34,8 +34,11 @@
 //
 
 #include <bit/math/half.hpp>
+#include <bit/math/interpolation.hpp> // bit::math::detail::interpolate_batch
 
-#include <cstring> // std::memcpy
+#include <algorithm> // std::min
+#include <cassert>   // assert
+#include <cstring>   // std::memcpy
 
 #ifndef BIT_MATH_UNUSED
 #define BIT_MATH_UNUSED(x) (void)x;
@@ -897,3 +900,120 @@ namespace {
   }
 
 } // anonymous namespace
+
+//=============================================================================
+// Batch Interpolation
+//=============================================================================
+
+namespace {
+
+  // The number of halves widened at a time
+  constexpr std::size_t g_interpolation_chunk = 256;
+
+  // Advances to the positions of the next chunk; a shared position is left
+  // as it is
+  inline void advance( const bit::math::float_t*& t, std::size_t n )
+    noexcept
+  {
+    t += n;
+  }
+
+  inline void advance( bit::math::float_t, std::size_t )
+    noexcept
+  {
+  }
+
+  template<typename T>
+  void interpolate_halves( bit::math::detail::easing e,
+                           const bit::math::half* v0,
+                           const bit::math::half* v1,
+                           T t,
+                           bit::math::half* out,
+                           std::size_t n )
+    noexcept
+  {
+    using bit::math::float_t;
+
+    float_t wide_v0[g_interpolation_chunk];
+    float_t wide_v1[g_interpolation_chunk];
+    float_t wide_out[g_interpolation_chunk];
+
+    for( auto i = std::size_t{0}; i < n; i += g_interpolation_chunk ) {
+      const auto count = std::min( g_interpolation_chunk, n - i );
+
+      for( auto j = std::size_t{0}; j < count; ++j ) {
+        wide_v0[j] = static_cast<float>( v0[i + j] );
+        wide_v1[j] = static_cast<float>( v1[i + j] );
+      }
+
+      bit::math::detail::interpolate_batch( e, wide_v0, wide_v1, t, wide_out, count );
+
+      for( auto j = std::size_t{0}; j < count; ++j ) {
+        out[i + j] = bit::math::half( static_cast<float>( wide_out[j] ) );
+      }
+
+      advance( t, count );
+    }
+  }
+
+
+} // anonymous namespace
+
+void bit::math::detail::interpolate_batch( easing e,
+                                           const half* v0,
+                                           const half* v1,
+                                           const float_t* t,
+                                           half* out,
+                                           std::size_t n )
+  noexcept
+{
+  assert( (v0 != nullptr && v1 != nullptr && t != nullptr && out != nullptr)
+          || n == 0 );
+
+  interpolate_halves( e, v0, v1, t, out, n );
+}
+
+void bit::math::detail::interpolate_batch( easing e,
+                                           const half* v0,
+                                           const half* v1,
+                                           float_t t,
+                                           half* out,
+                                           std::size_t n )
+  noexcept
+{
+  assert( (v0 != nullptr && v1 != nullptr && out != nullptr) || n == 0 );
+
+  interpolate_halves( e, v0, v1, t, out, n );
+}
+
+//=============================================================================
+// Batch Clamping
+//=============================================================================
+
+void bit::math::saturate( const half* in,
+                          half* out,
+                          std::size_t n,
+                          nan_policy policy )
+  noexcept
+{
+  assert( (in != nullptr && out != nullptr) || n == 0 );
+
+  // The number of halves widened at a time
+  constexpr std::size_t chunk = 256;
+
+  float wide[chunk];
+
+  for( auto i = std::size_t{0}; i < n; i += chunk ) {
+    const auto count = std::min( chunk, n - i );
+
+    for( auto j = std::size_t{0}; j < count; ++j ) {
+      wide[j] = static_cast<float>( in[i + j] );
+    }
+
+    saturate( wide, wide, count, policy );
+
+    for( auto j = std::size_t{0}; j < count; ++j ) {
+      out[i + j] = half( wide[j] );
+    }
+  }
+}
@@ -0,0 +1,445 @@
+#include <bit/math/interpolation.hpp>
+
+#include "detail/simd.hpp"
+
+#include <algorithm> // std::min, std::fill_n
+#include <cassert>   // assert
+#include <cmath>     // std::sqrt, std::cos, std::sin
+
+namespace {
+
+  using bit::math::float_t;
+  using bit::math::vec2;
+  using bit::math::vec3;
+  using bit::math::vec4;
+
+  using bit::math::detail::easing;
+
+  namespace simd = bit::math::detail::simd;
+
+  // The number of values interpolated between refilling the weight buffers
+  constexpr std::size_t g_chunk = 256;
+
+  //--------------------------------------------------------------------------
+  // Easing Curves
+  //--------------------------------------------------------------------------
+
+  // Each curve maps the position 't' to the weight of 'v1', identically to
+  // the scalar functions in 'interpolation.hpp'. Curves that have no
+  // lane-parallel form compute their lanes one at a time
+
+  template<typename Curve>
+  simd::floats ease_each_lane( simd::floats t, Curve curve )
+    noexcept
+  {
+    float lanes[simd::width];
+    simd::store( lanes, t );
+    for( auto& lane : lanes ) {
+      lane = static_cast<float>( curve( lane ) );
+    }
+    return simd::load( lanes );
+  }
+
+  struct linear_curve
+  {
+    template<typename T>
+    T operator()( T t ) const noexcept { return t; }
+  };
+
+  struct quadratic_curve
+  {
+    template<typename T>
+    T operator()( T t ) const noexcept { return t*t; }
+  };
+
+  struct cubic_curve
+  {
+    template<typename T>
+    T operator()( T t ) const noexcept { return t*t*t; }
+  };
+
+  struct quartic_curve
+  {
+    template<typename T>
+    T operator()( T t ) const noexcept { return t*t*t*t; }
+  };
+
+  struct quintic_curve
+  {
+    template<typename T>
+    T operator()( T t ) const noexcept { return t*t*t*t*t; }
+  };
+
+  struct circular_curve
+  {
+    float_t operator()( float_t t ) const noexcept
+    {
+      return float_t(1) - std::sqrt( float_t(1) - t*t );
+    }
+
+    simd::floats operator()( simd::floats t ) const noexcept
+    {
+      const auto one = simd::broadcast( 1.0f );
+      return one - simd::sqrt( one - t*t );
+    }
+  };
+
+  struct half_cosine_curve
+  {
+    float_t operator()( float_t t ) const noexcept
+    {
+      return float_t(0.5) - std::cos( t * bit::math::half_pi<float_t>() ) * float_t(0.5);
+    }
+
+    simd::floats operator()( simd::floats t ) const noexcept
+    {
+      return ease_each_lane( t, *this );
+    }
+  };
+
+  struct cosine_curve
+  {
+    float_t operator()( float_t t ) const noexcept
+    {
+      return float_t(1) - std::cos( t * bit::math::pi<float_t>() );
+    }
+
+    simd::floats operator()( simd::floats t ) const noexcept
+    {
+      return ease_each_lane( t, *this );
+    }
+  };
+
+  struct half_sine_curve
+  {
+    float_t operator()( float_t t ) const noexcept
+    {
+      return float_t(0.5) - std::sin( t * bit::math::half_pi<float_t>() ) * float_t(0.5);
+    }
+
+    simd::floats operator()( simd::floats t ) const noexcept
+    {
+      return ease_each_lane( t, *this );
+    }
+  };
+
+  struct sine_curve
+  {
+    float_t operator()( float_t t ) const noexcept
+    {
+      return float_t(1) - std::sin( t * bit::math::pi<float_t>() );
+    }
+
+    simd::floats operator()( simd::floats t ) const noexcept
+    {
+      return ease_each_lane( t, *this );
+    }
+  };
+
+  // Invokes 'fn' with the curve for 'e', so that the kernels are
+  // instantiated once per curve rather than switching per value
+  template<typename Fn>
+  void with_curve( easing e, Fn fn )
+    noexcept
+  {
+    switch( e ) {
+    case easing::linear:      fn( linear_curve{} );      break;
+    case easing::quadratic:   fn( quadratic_curve{} );   break;
+    case easing::cubic:       fn( cubic_curve{} );       break;
+    case easing::quartic:     fn( quartic_curve{} );     break;
+    case easing::quintic:     fn( quintic_curve{} );     break;
+    case easing::circular:    fn( circular_curve{} );    break;
+    case easing::half_cosine: fn( half_cosine_curve{} ); break;
+    case easing::cosine:      fn( cosine_curve{} );      break;
+    case easing::half_sine:   fn( half_sine_curve{} );   break;
+    case easing::sine:        fn( sine_curve{} );        break;
+    }
+  }
+
+  //--------------------------------------------------------------------------
+  // Kernels
+  //--------------------------------------------------------------------------
+
+  template<typename Curve>
+  void ease_batch( const float* t, float* out, std::size_t n, Curve curve )
+    noexcept
+  {
+    simd::for_each_lanes( t, out, n, [curve]( simd::floats t )
+    {
+      return curve( t );
+    });
+  }
+
+  template<typename Curve>
+  void ease_batch( const double* t, double* out, std::size_t n, Curve curve )
+    noexcept
+  {
+    for( auto i = std::size_t{0}; i < n; ++i ) {
+      out[i] = curve( t[i] );
+    }
+  }
+
+  // Blends with 'v0 * (1 - w) + v1 * w' like the scalar 'linear', so that
+  // a weight of exactly 1 yields exactly 'v1'
+
+  inline void blend_batch( const float* v0,
+                           const float* v1,
+                           const float* w,
+                           float* out,
+                           std::size_t n )
+    noexcept
+  {
+    const auto one = simd::broadcast( 1.0f );
+
+    simd::for_each_lanes( v0, v1, w, out, n,
+                          [one]( simd::floats v0, simd::floats v1, simd::floats w )
+    {
+      return v0 * (one - w) + v1 * w;
+    });
+  }
+
+  inline void blend_batch( const double* v0,
+                           const double* v1,
+                           const double* w,
+                           double* out,
+                           std::size_t n )
+    noexcept
+  {
+    for( auto i = std::size_t{0}; i < n; ++i ) {
+      out[i] = v0[i] * (1 - w[i]) + v1[i] * w[i];
+    }
+  }
+
+  inline void blend_batch( const float* v0,
+                           const float* v1,
+                           float w,
+                           float* out,
+                           std::size_t n )
+    noexcept
+  {
+    const auto weight = simd::broadcast( w );
+    const auto inverse_weight = simd::broadcast( 1.0f - w );
+
+    simd::for_each_lanes( v0, v1, out, n,
+                          [=]( simd::floats v0, simd::floats v1 )
+    {
+      return v0 * inverse_weight + v1 * weight;
+    });
+  }
+
+  inline void blend_batch( const double* v0,
+                           const double* v1,
+                           double w,
+                           double* out,
+                           std::size_t n )
+    noexcept
+  {
+    for( auto i = std::size_t{0}; i < n; ++i ) {
+      out[i] = v0[i] * (1 - w) + v1[i] * w;
+    }
+  }
+
+  //--------------------------------------------------------------------------
+
+  // Interpolates 'n' values of 'Components' contiguous float_ts each, with
+  // one position per value. The eased weights are computed a chunk at a time
+  // and repeated for every component, so that the blend itself runs over
+  // flat arrays
+  template<std::size_t Components>
+  void interpolate_components( easing e,
+                               const float_t* v0,
+                               const float_t* v1,
+                               const float_t* t,
+                               float_t* out,
+                               std::size_t n )
+    noexcept
+  {
+    float_t weights[g_chunk];
+    float_t component_weights[g_chunk * Components];
+
+    with_curve( e, [&]( auto curve )
+    {
+      for( auto i = std::size_t{0}; i < n; i += g_chunk ) {
+        const auto count = std::min( g_chunk, n - i );
+
+        ease_batch( t + i, weights, count, curve );
+
+        const float_t* w = weights;
+        if( Components != 1 ) {
+          for( auto j = std::size_t{0}; j < count; ++j ) {
+            std::fill_n( component_weights + j * Components, Components, weights[j] );
+          }
+          w = component_weights;
+        }
+
+        const auto offset = i * Components;
+        blend_batch( v0 + offset, v1 + offset, w, out + offset, count * Components );
+      }
+    });
+  }
+
+  // Interpolates 'n' values of 'Components' contiguous float_ts each, all
+  // at the same position; the curve is only evaluated once
+  template<std::size_t Components>
+  void interpolate_components( easing e,
+                               const float_t* v0,
+                               const float_t* v1,
+                               float_t t,
+                               float_t* out,
+                               std::size_t n )
+    noexcept
+  {
+    with_curve( e, [&]( auto curve )
+    {
+      blend_batch( v0, v1, curve( t ), out, n * Components );
+    });
+  }
+
+  //--------------------------------------------------------------------------
+
+  // The vector types store their components contiguously with no padding,
+  // so arrays of them are interpolated as flat arrays of float_t
+
+  static_assert( sizeof(vec2) == 2 * sizeof(float_t), "vec2 must not be padded" );
+  static_assert( sizeof(vec3) == 3 * sizeof(float_t), "vec3 must not be padded" );
+  static_assert( sizeof(vec4) == 4 * sizeof(float_t), "vec4 must not be padded" );
+
+  template<typename Vector>
+  const float_t* components( const Vector* v )
+    noexcept
+  {
+    return reinterpret_cast<const float_t*>( v );
+  }
+
+  template<typename Vector>
+  float_t* components( Vector* v )
+    noexcept
+  {
+    return reinterpret_cast<float_t*>( v );
+  }
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Batch Interpolation
+//----------------------------------------------------------------------------
+
+void bit::math::detail::interpolate_batch( easing e,
+                                           const float_t* v0,
+                                           const float_t* v1,
+                                           const float_t* t,
+                                           float_t* out,
+                                           std::size_t n )
+  noexcept
+{
+  assert( (v0 != nullptr && v1 != nullptr && t != nullptr && out != nullptr)
+          || n == 0 );
+
+  interpolate_components<1>( e, v0, v1, t, out, n );
+}
+
+void bit::math::detail::interpolate_batch( easing e,
+                                           const float_t* v0,
+                                           const float_t* v1,
+                                           float_t t,
+                                           float_t* out,
+                                           std::size_t n )
+  noexcept
+{
+  assert( (v0 != nullptr && v1 != nullptr && out != nullptr) || n == 0 );
+
+  interpolate_components<1>( e, v0, v1, t, out, n );
+}
+
+//----------------------------------------------------------------------------
+
+void bit::math::detail::interpolate_batch( easing e,
+                                           const vec2* v0,
+                                           const vec2* v1,
+                                           const float_t* t,
+                                           vec2* out,
+                                           std::size_t n )
+  noexcept
+{
+  assert( (v0 != nullptr && v1 != nullptr && t != nullptr && out != nullptr)
+          || n == 0 );
+
+  interpolate_components<2>( e, components(v0), components(v1), t,
+                             components(out), n );
+}
+
+void bit::math::detail::interpolate_batch( easing e,
+                                           const vec2* v0,
+                                           const vec2* v1,
+                                           float_t t,
+                                           vec2* out,
+                                           std::size_t n )
+  noexcept
+{
+  assert( (v0 != nullptr && v1 != nullptr && out != nullptr) || n == 0 );
+
+  interpolate_components<2>( e, components(v0), components(v1), t,
+                             components(out), n );
+}
+
+//----------------------------------------------------------------------------
+
+void bit::math::detail::interpolate_batch( easing e,
+                                           const vec3* v0,
+                                           const vec3* v1,
+                                           const float_t* t,
+                                           vec3* out,
+                                           std::size_t n )
+  noexcept
+{
+  assert( (v0 != nullptr && v1 != nullptr && t != nullptr && out != nullptr)
+          || n == 0 );
+
+  interpolate_components<3>( e, components(v0), components(v1), t,
+                             components(out), n );
+}
+
+void bit::math::detail::interpolate_batch( easing e,
+                                           const vec3* v0,
+                                           const vec3* v1,
+                                           float_t t,
+                                           vec3* out,
+                                           std::size_t n )
+  noexcept
+{
+  assert( (v0 != nullptr && v1 != nullptr && out != nullptr) || n == 0 );
+
+  interpolate_components<3>( e, components(v0), components(v1), t,
+                             components(out), n );
+}
+
+//----------------------------------------------------------------------------
+
+void bit::math::detail::interpolate_batch( easing e,
+                                           const vec4* v0,
+                                           const vec4* v1,
+                                           const float_t* t,
+                                           vec4* out,
+                                           std::size_t n )
+  noexcept
+{
+  assert( (v0 != nullptr && v1 != nullptr && t != nullptr && out != nullptr)
+          || n == 0 );
+
+  interpolate_components<4>( e, components(v0), components(v1), t,
+                             components(out), n );
+}
+
+void bit::math::detail::interpolate_batch( easing e,
+                                           const vec4* v0,
+                                           const vec4* v1,
+                                           float_t t,
+                                           vec4* out,
+                                           std::size_t n )
+  noexcept
+{
+  assert( (v0 != nullptr && v1 != nullptr && out != nullptr) || n == 0 );
+
+  interpolate_components<4>( e, components(v0), components(v1), t,
+                             components(out), n );
+}
@@ -0,0 +1,208 @@
+#include <bit/math/math.hpp>
+
+#include "detail/simd.hpp"
+
+#include <cassert> // assert
+
+namespace {
+
+  using bit::math::nan_policy;
+
+  namespace simd = bit::math::detail::simd;
+
+  //--------------------------------------------------------------------------
+  // Kernels
+  //--------------------------------------------------------------------------
+
+  // Each kernel clamps with min/max and then overwrites the NaN lanes, since
+  // min/max return different operands for NaN depending on the instruction
+  // set. Under 'nan_policy::propagate', the NaN input itself is kept.
+
+  // Clamps lanes to [lo, hi]
+  struct clamp_lanes
+  {
+    simd::floats lo;
+    simd::floats hi;
+    simd::floats fill;
+    bool propagate;
+
+    simd::floats operator()( simd::floats x ) const noexcept
+    {
+      const auto result = simd::min( simd::max( x, lo ), hi );
+
+      return simd::select( simd::is_nan(x), propagate ? x : fill, result );
+    }
+  };
+
+  // Maps lanes from [in_lo, in_hi] onto [out_lo, out_hi], clamping the
+  // interpolant so that values outside of the input range saturate
+  struct remap_lanes
+  {
+    simd::floats in_lo;
+    simd::floats scale;
+    simd::floats out_lo;
+    simd::floats out_range;
+    simd::floats fill;
+    bool propagate;
+
+    simd::floats operator()( simd::floats x ) const noexcept
+    {
+      const auto zero = simd::broadcast( 0.0f );
+      const auto one  = simd::broadcast( 1.0f );
+
+      const auto t = simd::min( simd::max( (x - in_lo) * scale, zero ), one );
+      const auto result = out_lo + t * out_range;
+
+      return simd::select( simd::is_nan(x), propagate ? x : fill, result );
+    }
+  };
+
+  //--------------------------------------------------------------------------
+
+  // The result for a NaN input under 'policy', when it is not propagated
+  template<typename Float>
+  inline Float nan_fill( nan_policy policy, Float lower )
+    noexcept
+  {
+    return policy == nan_policy::zero ? Float(0) : lower;
+  }
+
+  inline void clamp_batch( const float* in, float* out, std::size_t n,
+                           float lo, float hi, nan_policy policy )
+    noexcept
+  {
+    const auto kernel = clamp_lanes{
+      simd::broadcast( lo ),
+      simd::broadcast( hi ),
+      simd::broadcast( nan_fill( policy, lo ) ),
+      policy == nan_policy::propagate
+    };
+
+    simd::for_each_lanes( in, out, n, kernel );
+  }
+
+  inline void clamp_batch( const double* in, double* out, std::size_t n,
+                           double lo, double hi, nan_policy policy )
+    noexcept
+  {
+    const auto fill = nan_fill( policy, lo );
+
+    for( auto i = std::size_t{0}; i < n; ++i ) {
+      const auto x = in[i];
+
+      if( x != x ) {
+        out[i] = (policy == nan_policy::propagate) ? x : fill;
+      } else {
+        out[i] = (x < lo) ? lo : ((x > hi) ? hi : x);
+      }
+    }
+  }
+
+  inline void remap_batch( const float* in, float* out, std::size_t n,
+                           float in_lo, float in_hi,
+                           float out_lo, float out_hi,
+                           nan_policy policy )
+    noexcept
+  {
+    const auto kernel = remap_lanes{
+      simd::broadcast( in_lo ),
+      simd::broadcast( 1.0f / (in_hi - in_lo) ),
+      simd::broadcast( out_lo ),
+      simd::broadcast( out_hi - out_lo ),
+      simd::broadcast( nan_fill( policy, out_lo ) ),
+      policy == nan_policy::propagate
+    };
+
+    simd::for_each_lanes( in, out, n, kernel );
+  }
+
+  inline void remap_batch( const double* in, double* out, std::size_t n,
+                           double in_lo, double in_hi,
+                           double out_lo, double out_hi,
+                           nan_policy policy )
+    noexcept
+  {
+    const auto scale     = 1.0 / (in_hi - in_lo);
+    const auto out_range = out_hi - out_lo;
+    const auto fill      = nan_fill( policy, out_lo );
+
+    for( auto i = std::size_t{0}; i < n; ++i ) {
+      const auto x = in[i];
+
+      if( x != x ) {
+        out[i] = (policy == nan_policy::propagate) ? x : fill;
+      } else {
+        const auto t = (x - in_lo) * scale;
+
+        out[i] = out_lo + ((t < 0.0) ? 0.0 : ((t > 1.0) ? 1.0 : t)) * out_range;
+      }
+    }
+  }
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Batch Clamping
+//----------------------------------------------------------------------------
+
+void bit::math::clamp( const float* in, float* out, std::size_t n,
+                       float lo, float hi,
+                       nan_policy policy )
+  noexcept
+{
+  assert( lo <= hi );
+  assert( (in != nullptr && out != nullptr) || n == 0 );
+
+  clamp_batch( in, out, n, lo, hi, policy );
+}
+
+void bit::math::clamp( const double* in, double* out, std::size_t n,
+                       double lo, double hi,
+                       nan_policy policy )
+  noexcept
+{
+  assert( lo <= hi );
+  assert( (in != nullptr && out != nullptr) || n == 0 );
+
+  clamp_batch( in, out, n, lo, hi, policy );
+}
+
+//----------------------------------------------------------------------------
+
+void bit::math::saturate( const float* in, float* out, std::size_t n,
+                          nan_policy policy )
+  noexcept
+{
+  clamp( in, out, n, 0.0f, 1.0f, policy );
+}
+
+void bit::math::saturate( const double* in, double* out, std::size_t n,
+                          nan_policy policy )
+  noexcept
+{
+  clamp( in, out, n, 0.0, 1.0, policy );
+}
+
+//----------------------------------------------------------------------------
+
+void bit::math::remap( const float* in, float* out, std::size_t n,
+                       float in_lo, float in_hi, float out_lo, float out_hi,
+                       nan_policy policy )
+  noexcept
+{
+  assert( in_lo != in_hi );
+  assert( (in != nullptr && out != nullptr) || n == 0 );
+
+  remap_batch( in, out, n, in_lo, in_hi, out_lo, out_hi, policy );
+}
+
+void bit::math::remap( const double* in, double* out, std::size_t n,
+                       double in_lo, double in_hi, double out_lo, double out_hi,
+                       nan_policy policy )
+  noexcept
+{
+  assert( in_lo != in_hi );
+  assert( (in != nullptr && out != nullptr) || n == 0 );
+
+  remap_batch( in, out, n, in_lo, in_hi, out_lo, out_hi, policy );
+}
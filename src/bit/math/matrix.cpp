@@ -6,6 +6,10 @@
  * \author Matthew Rodusek (matthew.rodusek@gmail.com)
  */
 
+// Suppress the extern template declarations so that GCC emits the
+// constexpr members used by the static constants
+#define BIT_MATH_MATRIX_INSTANTIATION 1
+
 #include <bit/math/matrix.hpp>
 
 template class bit::math::matrix2<bit::math::float_t>;
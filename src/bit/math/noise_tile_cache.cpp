@@ -0,0 +1,399 @@
+#include <bit/math/noise_tile_cache.hpp>
+
+#include <cerrno>       // errno
+#include <cstring>      // std::memcpy, std::memcmp
+#include <limits>       // std::numeric_limits
+#include <stdexcept>    // std::invalid_argument
+#include <system_error> // std::system_error, std::generic_category
+
+#include <fcntl.h>    // ::open
+#include <sys/file.h> // ::flock
+#include <sys/mman.h> // ::mmap, ::munmap, ::msync
+#include <sys/stat.h> // ::fstat
+#include <unistd.h>   // ::close, ::ftruncate, ::pread
+
+namespace {
+
+  using bit::math::float_t;
+
+  //--------------------------------------------------------------------------
+  // File Layout
+  //--------------------------------------------------------------------------
+
+  // The cache file is laid out as:
+  //
+  //   file_header
+  //   index_entry[capacity]
+  //   (padding to a multiple of 64 bytes)
+  //   float_t[capacity][tile_size * tile_size]
+  //
+  // A tile is only marked valid in the index after its samples have been
+  // written, so a process that dies mid-generation leaves an empty slot
+  // rather than a corrupt tile
+
+  constexpr char g_magic[8] = { 'B','I','T','N','T','I','L','E' };
+  constexpr std::uint32_t g_version = 1;
+  constexpr std::size_t g_data_alignment = 64;
+
+  struct file_header
+  {
+    char          magic[8];
+    std::uint32_t version;
+    std::uint32_t sample_size; ///< sizeof(float_t) of the writer
+    std::uint64_t tile_size;
+    std::uint64_t capacity;
+    std::uint64_t clock;       ///< the last access time handed out
+    std::uint8_t  reserved[24];
+  };
+
+  struct index_entry
+  {
+    std::uint64_t seed;
+    std::uint64_t schedule;
+    std::int32_t  x;
+    std::int32_t  y;
+    std::uint64_t last_used;
+    std::uint32_t is_valid;
+    std::uint32_t reserved;
+  };
+
+  static_assert( sizeof(file_header) == 64, "file_header must be packed" );
+  static_assert( sizeof(index_entry) == 40, "index_entry must be packed" );
+
+  constexpr std::size_t data_offset( std::size_t capacity ) noexcept
+  {
+    return (sizeof(file_header) + capacity * sizeof(index_entry)
+            + g_data_alignment - 1) / g_data_alignment * g_data_alignment;
+  }
+
+  file_header* header_of( void* mapping ) noexcept
+  {
+    return static_cast<file_header*>( mapping );
+  }
+
+  index_entry* index_of( void* mapping ) noexcept
+  {
+    return reinterpret_cast<index_entry*>( header_of( mapping ) + 1 );
+  }
+
+  float_t* tile_of( void* mapping,
+                    std::size_t capacity,
+                    std::size_t tile_size,
+                    std::size_t slot ) noexcept
+  {
+    auto* data = static_cast<char*>( mapping ) + data_offset( capacity );
+    return reinterpret_cast<float_t*>( data ) + slot * tile_size * tile_size;
+  }
+
+  bool has_magic( const file_header& header ) noexcept
+  {
+    return std::memcmp( header.magic, g_magic, sizeof(g_magic) ) == 0;
+  }
+
+  bool is_compatible( const file_header& header,
+                      std::size_t tile_size,
+                      std::size_t capacity ) noexcept
+  {
+    return has_magic( header ) &&
+           header.version == g_version &&
+           header.sample_size == sizeof(float_t) &&
+           header.tile_size == tile_size &&
+           header.capacity == capacity;
+  }
+
+  //--------------------------------------------------------------------------
+  // Hashing
+  //--------------------------------------------------------------------------
+
+  constexpr std::uint64_t g_fnv_offset = 0xcbf29ce484222325ull;
+  constexpr std::uint64_t g_fnv_prime  = 0x100000001b3ull;
+
+  template<typename T>
+  std::uint64_t fnv1a( std::uint64_t hash, const T& value ) noexcept
+  {
+    unsigned char bytes[sizeof(T)];
+    std::memcpy( bytes, &value, sizeof(T) );
+
+    for( auto byte : bytes ) {
+      hash = (hash ^ byte) * g_fnv_prime;
+    }
+    return hash;
+  }
+
+  //--------------------------------------------------------------------------
+
+  [[noreturn]] void throw_system_error( const char* what )
+  {
+    throw std::system_error{ errno, std::generic_category(), what };
+  }
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Constructors / Destructor
+//----------------------------------------------------------------------------
+
+bit::math::noise_tile_cache::noise_tile_cache( const char* path,
+                                               std::size_t tile_size,
+                                               std::size_t max_bytes )
+  : m_file{ -1 },
+    m_mapping{ nullptr },
+    m_mapping_size{ 0 },
+    m_tile_size{ tile_size },
+    m_capacity{ 0 },
+    m_slots{}
+{
+  const auto tile_bytes = tile_size * tile_size * sizeof(float_t);
+  const auto overhead   = data_offset( 0 ) + g_data_alignment;
+
+  if( tile_size != 0 && max_bytes > overhead ) {
+    m_capacity = (max_bytes - overhead) / (tile_bytes + sizeof(index_entry));
+  }
+  if( m_capacity == 0 ) {
+    throw std::invalid_argument{
+      "noise_tile_cache: size cap cannot hold a single tile"
+    };
+  }
+  m_mapping_size = data_offset( m_capacity ) + m_capacity * tile_bytes;
+
+  m_file = ::open( path, O_RDWR | O_CREAT | O_CLOEXEC, 0644 );
+  if( m_file < 0 ) {
+    throw_system_error( "noise_tile_cache: unable to open cache file" );
+  }
+
+  // The destructor does not run for a throwing constructor, so the file and
+  // mapping are released here on failure
+  try {
+    // Every instance keeps its own index of the shared mapping, so a second
+    // owner would evict and overwrite slots the first one still serves
+    if( ::flock( m_file, LOCK_EX | LOCK_NB ) != 0 ) {
+      throw_system_error( "noise_tile_cache: cache file is already in use" );
+    }
+    open_mapping();
+  } catch( ... ) {
+    if( m_mapping != nullptr ) {
+      ::munmap( m_mapping, m_mapping_size );
+    }
+    ::close( m_file );
+    throw;
+  }
+}
+
+//----------------------------------------------------------------------------
+
+bit::math::noise_tile_cache::~noise_tile_cache()
+{
+  ::munmap( m_mapping, m_mapping_size );
+  ::close( m_file );
+}
+
+//----------------------------------------------------------------------------
+// Tiles
+//----------------------------------------------------------------------------
+
+const bit::math::float_t*
+  bit::math::noise_tile_cache::tile( const simplex_generator& generator,
+                                     const octave_schedule& schedule,
+                                     std::int32_t tile_x,
+                                     std::int32_t tile_y )
+{
+  auto& header = *header_of( m_mapping );
+  auto* index  = index_of( m_mapping );
+
+  const auto key = make_key( generator, schedule, tile_x, tile_y );
+
+  const auto it = m_slots.find( key );
+  if( it != m_slots.end() ) {
+    index[it->second].last_used = ++header.clock;
+    return tile_of( m_mapping, m_capacity, m_tile_size, it->second );
+  }
+
+  const auto slot    = acquire_slot();
+  auto* const result = tile_of( m_mapping, m_capacity, m_tile_size, slot );
+
+  // Sample in 64-bit so that tiles far from the origin don't overflow
+  const auto origin_x = static_cast<std::int64_t>( tile_x ) * static_cast<std::int64_t>( m_tile_size );
+  const auto origin_y = static_cast<std::int64_t>( tile_y ) * static_cast<std::int64_t>( m_tile_size );
+
+  auto* out = result;
+  for( auto row = std::size_t{0}; row < m_tile_size; ++row ) {
+    const auto y = static_cast<float_t>( origin_y + static_cast<std::int64_t>(row) );
+
+    for( auto column = std::size_t{0}; column < m_tile_size; ++column ) {
+      const auto x = static_cast<float_t>( origin_x + static_cast<std::int64_t>(column) );
+
+      *out++ = generator.octave_noise( schedule, x, y );
+    }
+  }
+
+  m_slots.emplace( key, slot );
+
+  auto& entry     = index[slot];
+  entry.seed      = key.seed;
+  entry.schedule  = key.schedule;
+  entry.x         = key.x;
+  entry.y         = key.y;
+  entry.last_used = ++header.clock;
+  entry.is_valid  = 1;
+
+  return result;
+}
+
+bool bit::math::noise_tile_cache::contains( const simplex_generator& generator,
+                                            const octave_schedule& schedule,
+                                            std::int32_t tile_x,
+                                            std::int32_t tile_y )
+  const noexcept
+{
+  return m_slots.count( make_key( generator, schedule, tile_x, tile_y ) ) != 0;
+}
+
+void bit::math::noise_tile_cache::flush()
+{
+  if( ::msync( m_mapping, m_mapping_size, MS_SYNC ) != 0 ) {
+    throw_system_error( "noise_tile_cache: unable to flush cache file" );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Private Member Types
+//----------------------------------------------------------------------------
+
+std::size_t bit::math::noise_tile_cache::tile_key_hash
+  ::operator()( const tile_key& key )
+  const noexcept
+{
+  auto hash = g_fnv_offset;
+  hash = fnv1a( hash, key.seed );
+  hash = fnv1a( hash, key.schedule );
+  hash = fnv1a( hash, key.x );
+  hash = fnv1a( hash, key.y );
+  return static_cast<std::size_t>( hash );
+}
+
+bool bit::math::noise_tile_cache::tile_key_equal
+  ::operator()( const tile_key& lhs, const tile_key& rhs )
+  const noexcept
+{
+  return lhs.seed == rhs.seed && lhs.schedule == rhs.schedule &&
+         lhs.x == rhs.x && lhs.y == rhs.y;
+}
+
+//----------------------------------------------------------------------------
+// Private Member Functions
+//----------------------------------------------------------------------------
+
+bit::math::noise_tile_cache::tile_key
+  bit::math::noise_tile_cache::make_key( const simplex_generator& generator,
+                                         const octave_schedule& schedule,
+                                         std::int32_t tile_x,
+                                         std::int32_t tile_y )
+  noexcept
+{
+  // Two schedules produce the same samples exactly when their octaves and
+  // quantum match, so those are what identify the schedule
+  auto hash = g_fnv_offset;
+  hash = fnv1a( hash, static_cast<std::uint64_t>( schedule.octaves() ) );
+  for( auto i = std::size_t{0}; i < schedule.octaves(); ++i ) {
+    hash = fnv1a( hash, schedule.frequency( i ) );
+    hash = fnv1a( hash, schedule.amplitude( i ) );
+  }
+  hash = fnv1a( hash, schedule.quantum() );
+
+  return tile_key{ generator.seed(), hash, tile_x, tile_y };
+}
+
+void bit::math::noise_tile_cache::open_mapping()
+{
+  struct ::stat status;
+  if( ::fstat( m_file, &status ) != 0 ) {
+    throw_system_error( "noise_tile_cache: unable to inspect cache file" );
+  }
+  const auto file_size = static_cast<std::size_t>( status.st_size );
+
+  // Only an empty file, such as one that was just created, is initialized
+  // outright. Any other file must already be a cache file, so that a wrong
+  // path is rejected rather than overwritten
+  auto header = file_header{};
+  auto is_reset = (file_size == 0);
+  if( !is_reset ) {
+    if( file_size < sizeof(file_header) ||
+        ::pread( m_file, &header, sizeof(header), 0 ) != static_cast<::ssize_t>(sizeof(header)) ||
+        !has_magic( header ) ) {
+      throw std::invalid_argument{
+        "noise_tile_cache: file exists and is not a noise tile cache"
+      };
+    }
+
+    // A cache file with a different layout cannot be reused, so its tiles
+    // are discarded
+    is_reset = !is_compatible( header, m_tile_size, m_capacity ) ||
+               file_size != m_mapping_size;
+  }
+
+  // The extended file reads as zeros, leaving every slot empty
+  if( is_reset &&
+      (::ftruncate( m_file, 0 ) != 0 ||
+       ::ftruncate( m_file, static_cast<::off_t>(m_mapping_size) ) != 0) ) {
+    throw_system_error( "noise_tile_cache: unable to size cache file" );
+  }
+
+  auto* const mapping = ::mmap( nullptr, m_mapping_size, PROT_READ | PROT_WRITE,
+                                MAP_SHARED, m_file, 0 );
+  if( mapping == MAP_FAILED ) {
+    throw_system_error( "noise_tile_cache: unable to map cache file" );
+  }
+  m_mapping = mapping;
+
+  auto& mapped_header = *header_of( m_mapping );
+  auto* index         = index_of( m_mapping );
+
+  if( is_reset ) {
+    std::memcpy( mapped_header.magic, g_magic, sizeof(g_magic) );
+    mapped_header.version     = g_version;
+    mapped_header.sample_size = sizeof(float_t);
+    mapped_header.tile_size   = m_tile_size;
+    mapped_header.capacity    = m_capacity;
+    return;
+  }
+
+  m_slots.reserve( m_capacity );
+  for( auto slot = std::size_t{0}; slot < m_capacity; ++slot ) {
+    const auto& entry = index[slot];
+    if( entry.is_valid ) {
+      m_slots.emplace( tile_key{ entry.seed, entry.schedule, entry.x, entry.y },
+                       slot );
+    }
+  }
+}
+
+std::size_t bit::math::noise_tile_cache::acquire_slot()
+  noexcept
+{
+  auto* index = index_of( m_mapping );
+
+  // While there is room, take the first empty slot
+  if( m_slots.size() < m_capacity ) {
+    auto slot = std::size_t{0};
+    while( index[slot].is_valid ) {
+      ++slot;
+    }
+    return slot;
+  }
+
+  // Otherwise evict the least recently used tile
+  auto slot      = std::size_t{0};
+  auto last_used = std::numeric_limits<std::uint64_t>::max();
+  for( auto i = std::size_t{0}; i < m_capacity; ++i ) {
+    if( index[i].last_used < last_used ) {
+      slot      = i;
+      last_used = index[i].last_used;
+    }
+  }
+
+  auto& entry = index[slot];
+  m_slots.erase( tile_key{ entry.seed, entry.schedule, entry.x, entry.y } );
+  entry.is_valid = 0;
+
+  return slot;
+}
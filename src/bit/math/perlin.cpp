@@ -0,0 +1,409 @@
+#include <bit/math/perlin.hpp>
+
+#include "detail/noise_tables.hpp"
+#include "detail/simd.hpp"
+
+#include <cassert> // assert
+
+namespace {
+
+  using bit::math::float_t;
+  using bit::math::vec2;
+  using bit::math::vec3;
+
+  using bit::math::detail::dot2;
+  using bit::math::detail::dot3;
+  using bit::math::detail::floor_f_to_i;
+  using bit::math::detail::g_grad;
+  using bit::math::detail::g_grad_x;
+  using bit::math::detail::g_grad_y;
+  using bit::math::detail::g_permutation_table;
+  using bit::math::detail::g_permutation_mod12;
+
+  namespace simd = bit::math::detail::simd;
+
+  //--------------------------------------------------------------------------
+  // Noise Kernels
+  //--------------------------------------------------------------------------
+
+  // Perlin's quintic fade curve, 6t^5 - 15t^4 + 10t^3, whose first and
+  // second derivatives are zero at the lattice points
+  constexpr float_t fade( float_t t ) noexcept
+  {
+    return t * t * t * (t * (t * 6 - 15) + 10);
+  }
+
+  constexpr float_t mix( float_t a, float_t b, float_t t ) noexcept
+  {
+    return a + (b - a) * t;
+  }
+
+  float_t raw_noise_2d( float_t x, float_t y )
+    noexcept
+  {
+    // The lattice cell, and the position within it
+    const auto i = floor_f_to_i( x );
+    const auto j = floor_f_to_i( y );
+
+    const auto x0 = x - i;
+    const auto y0 = y - j;
+
+    // Work out the hashed gradient indices of the four cell corners
+    const auto ii = i & 255;
+    const auto jj = j & 255;
+    const auto gi00 = g_permutation_mod12.values[ii +     g_permutation_table[jj]];
+    const auto gi10 = g_permutation_mod12.values[ii + 1 + g_permutation_table[jj]];
+    const auto gi01 = g_permutation_mod12.values[ii +     g_permutation_table[jj + 1]];
+    const auto gi11 = g_permutation_mod12.values[ii + 1 + g_permutation_table[jj + 1]];
+
+    const auto n00 = dot2( g_grad[gi00], x0,     y0 );
+    const auto n10 = dot2( g_grad[gi10], x0 - 1, y0 );
+    const auto n01 = dot2( g_grad[gi01], x0,     y0 - 1 );
+    const auto n11 = dot2( g_grad[gi11], x0 - 1, y0 - 1 );
+
+    const auto u = fade( x0 );
+    const auto v = fade( y0 );
+
+    return mix( mix( n00, n10, u ), mix( n01, n11, u ), v );
+  }
+
+  float_t raw_noise_3d( float_t x, float_t y, float_t z )
+    noexcept
+  {
+    // The lattice cell, and the position within it
+    const auto i = floor_f_to_i( x );
+    const auto j = floor_f_to_i( y );
+    const auto k = floor_f_to_i( z );
+
+    const auto x0 = x - i;
+    const auto y0 = y - j;
+    const auto z0 = z - k;
+
+    const auto ii = i & 255;
+    const auto jj = j & 255;
+    const auto kk = k & 255;
+
+    // Computes the contribution of the corner (ii+di, jj+dj, kk+dk)
+    const auto corner = [&]( int di, int dj, int dk ) {
+      const auto gi = g_permutation_mod12.values[
+        ii + di + g_permutation_table[jj + dj + g_permutation_table[kk + dk]]
+      ];
+      return dot3( g_grad[gi], x0 - di, y0 - dj, z0 - dk );
+    };
+
+    const auto u = fade( x0 );
+    const auto v = fade( y0 );
+    const auto w = fade( z0 );
+
+    const auto nx00 = mix( corner(0,0,0), corner(1,0,0), u );
+    const auto nx10 = mix( corner(0,1,0), corner(1,1,0), u );
+    const auto nx01 = mix( corner(0,0,1), corner(1,0,1), u );
+    const auto nx11 = mix( corner(0,1,1), corner(1,1,1), u );
+
+    return mix( mix( nx00, nx10, v ), mix( nx01, nx11, v ), w );
+  }
+
+  float_t octave_noise_2d( float_t octaves,
+                           float_t persistence,
+                           float_t scale,
+                           float_t x,
+                           float_t y )
+    noexcept
+  {
+    auto frequency = scale;
+    auto total     = float_t(0.0);
+    auto amplitude = float_t(1.0);
+
+    auto max_amplitude = float_t(0);
+
+    for( auto i = 0; i < int(octaves); ++i ) {
+      total += raw_noise_2d( x*frequency, y*frequency ) * amplitude;
+
+      max_amplitude += amplitude;
+      frequency *= 2;
+      amplitude *= persistence;
+    }
+
+    return total / max_amplitude;
+  }
+
+  float_t octave_noise_3d( float_t octaves,
+                           float_t persistence,
+                           float_t scale,
+                           float_t x,
+                           float_t y,
+                           float_t z )
+    noexcept
+  {
+    auto frequency = scale;
+    auto total     = float_t(0.0);
+    auto amplitude = float_t(1.0);
+
+    auto max_amplitude = float_t(0);
+
+    for( auto i = 0; i < int(octaves); ++i ) {
+      total += raw_noise_3d( x*frequency, y*frequency, z*frequency ) * amplitude;
+
+      max_amplitude += amplitude;
+      frequency *= 2;
+      amplitude *= persistence;
+    }
+
+    return total / max_amplitude;
+  }
+
+  //--------------------------------------------------------------------------
+  // Lane-parallel 2D noise
+  //--------------------------------------------------------------------------
+
+  inline simd::floats fade( simd::floats t )
+    noexcept
+  {
+    return t * t * t * (t * (t * simd::broadcast(6.0f) -
+                             simd::broadcast(15.0f)) +
+                        simd::broadcast(10.0f));
+  }
+
+  inline simd::floats mix( simd::floats a, simd::floats b, simd::floats t )
+    noexcept
+  {
+    return a + (b - a) * t;
+  }
+
+  inline simd::floats corner_2d( simd::ints gi, simd::floats x, simd::floats y )
+    noexcept
+  {
+    return simd::gather( g_grad_x, gi ) * x + simd::gather( g_grad_y, gi ) * y;
+  }
+
+  // Evaluates perlin::raw_noise( x, y ) for every lane
+  inline simd::floats raw_noise_lanes( simd::floats x, simd::floats y )
+    noexcept
+  {
+    const auto one  = simd::broadcast( 1 );
+    const auto mask = simd::broadcast( 255 );
+
+    const auto i = simd::floor_to_int( x );
+    const auto j = simd::floor_to_int( y );
+
+    const auto x0 = x - simd::to_floats(i);
+    const auto y0 = y - simd::to_floats(j);
+    const auto x1 = x0 - simd::broadcast(1.0f);
+    const auto y1 = y0 - simd::broadcast(1.0f);
+
+    const auto ii = i & mask;
+    const auto jj = j & mask;
+
+    const auto p0 = simd::gather( g_permutation_table, jj );
+    const auto p1 = simd::gather( g_permutation_table, jj + one );
+
+    const auto gi00 = simd::gather( g_permutation_mod12.values, ii + p0 );
+    const auto gi10 = simd::gather( g_permutation_mod12.values, ii + one + p0 );
+    const auto gi01 = simd::gather( g_permutation_mod12.values, ii + p1 );
+    const auto gi11 = simd::gather( g_permutation_mod12.values, ii + one + p1 );
+
+    const auto u = fade( x0 );
+    const auto v = fade( y0 );
+
+    return mix( mix( corner_2d( gi00, x0, y0 ), corner_2d( gi10, x1, y0 ), u ),
+                mix( corner_2d( gi01, x0, y1 ), corner_2d( gi11, x1, y1 ), u ),
+                v );
+  }
+
+  inline simd::floats octave_noise_lanes( float_t octaves,
+                                          float_t persistence,
+                                          float_t scale,
+                                          simd::floats x,
+                                          simd::floats y )
+    noexcept
+  {
+    auto frequency = scale;
+    auto total     = simd::broadcast(0.0f);
+    auto amplitude = float_t(1.0);
+
+    auto max_amplitude = float_t(0);
+
+    for( auto i = 0; i < int(octaves); ++i ) {
+      const auto f = simd::broadcast( static_cast<float>(frequency) );
+
+      total = total + raw_noise_lanes( x * f, y * f ) *
+                      simd::broadcast( static_cast<float>(amplitude) );
+
+      max_amplitude += amplitude;
+      frequency *= 2;
+      amplitude *= persistence;
+    }
+
+    return total / simd::broadcast( static_cast<float>(max_amplitude) );
+  }
+
+  inline void raw_noise_2d_batch( const float* x,
+                                  const float* y,
+                                  float* out,
+                                  std::size_t n )
+    noexcept
+  {
+    simd::for_each_lanes( x, y, out, n, &raw_noise_lanes );
+  }
+
+  // Double-precision builds have no lane-parallel path
+  inline void raw_noise_2d_batch( const double* x,
+                                  const double* y,
+                                  double* out,
+                                  std::size_t n )
+    noexcept
+  {
+    for( auto i = std::size_t{0}; i < n; ++i ) {
+      out[i] = raw_noise_2d( x[i], y[i] );
+    }
+  }
+
+  //--------------------------------------------------------------------------
+  // Grid Fill
+  //--------------------------------------------------------------------------
+
+  inline void fill_grid_2d_batch( const vec2& origin,
+                                  const vec2& step,
+                                  std::size_t width,
+                                  std::size_t height,
+                                  float_t octaves,
+                                  float_t persistence,
+                                  float_t scale,
+                                  float* out )
+    noexcept
+  {
+    simd::for_each_grid_lanes(
+      origin.x(), origin.y(), step.x(), step.y(), width, height, out,
+      [&]( simd::floats x, simd::floats y ) {
+        return octave_noise_lanes( octaves, persistence, scale, x, y );
+      }
+    );
+  }
+
+  inline void fill_grid_2d_batch( const vec2& origin,
+                                  const vec2& step,
+                                  std::size_t width,
+                                  std::size_t height,
+                                  float_t octaves,
+                                  float_t persistence,
+                                  float_t scale,
+                                  double* out )
+    noexcept
+  {
+    for( auto r = std::size_t{0}; r < height; ++r ) {
+      const auto y = origin.y() + step.y() * float_t(r);
+
+      for( auto c = std::size_t{0}; c < width; ++c ) {
+        const auto x = origin.x() + step.x() * float_t(c);
+
+        out[r * width + c] = octave_noise_2d( octaves, persistence, scale, x, y );
+      }
+    }
+  }
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Raw Noise
+//----------------------------------------------------------------------------
+
+bit::math::float_t bit::math::perlin::raw_noise( float_t x, float_t y )
+  noexcept
+{
+  return raw_noise_2d( x, y );
+}
+
+bit::math::float_t bit::math::perlin::raw_noise( float_t x, float_t y, float_t z )
+  noexcept
+{
+  return raw_noise_3d( x, y, z );
+}
+
+//----------------------------------------------------------------------------
+
+void bit::math::perlin::batch_raw_noise( const float_t* x,
+                                         const float_t* y,
+                                         float_t* out,
+                                         std::size_t n )
+  noexcept
+{
+  assert( (x != nullptr && y != nullptr && out != nullptr) || n == 0 );
+
+  raw_noise_2d_batch( x, y, out, n );
+}
+
+//----------------------------------------------------------------------------
+// Octave Noise
+//----------------------------------------------------------------------------
+
+bit::math::float_t bit::math::perlin::octave_noise( float_t octaves,
+                                                    float_t persistence,
+                                                    float_t scale,
+                                                    float_t x,
+                                                    float_t y )
+  noexcept
+{
+  return octave_noise_2d( octaves, persistence, scale, x, y );
+}
+
+bit::math::float_t bit::math::perlin::octave_noise( float_t octaves,
+                                                    float_t persistence,
+                                                    float_t scale,
+                                                    float_t x,
+                                                    float_t y,
+                                                    float_t z )
+  noexcept
+{
+  return octave_noise_3d( octaves, persistence, scale, x, y, z );
+}
+
+//----------------------------------------------------------------------------
+// Grid Fill
+//----------------------------------------------------------------------------
+
+void bit::math::perlin::fill_grid_2d( const vec2& origin,
+                                      const vec2& step,
+                                      std::size_t width,
+                                      std::size_t height,
+                                      float_t octaves,
+                                      float_t persistence,
+                                      float_t scale,
+                                      float_t* out )
+  noexcept
+{
+  assert( out != nullptr || width * height == 0 );
+
+  fill_grid_2d_batch( origin, step, width, height,
+                      octaves, persistence, scale, out );
+}
+
+//----------------------------------------------------------------------------
+
+void bit::math::perlin::fill_grid_3d( const vec3& origin,
+                                      const vec3& step,
+                                      std::size_t width,
+                                      std::size_t height,
+                                      std::size_t depth,
+                                      float_t octaves,
+                                      float_t persistence,
+                                      float_t scale,
+                                      float_t* out )
+  noexcept
+{
+  assert( out != nullptr || width * height * depth == 0 );
+
+  for( auto s = std::size_t{0}; s < depth; ++s ) {
+    const auto z = origin.z() + step.z() * float_t(s);
+
+    for( auto r = std::size_t{0}; r < height; ++r ) {
+      const auto y   = origin.y() + step.y() * float_t(r);
+      const auto row = out + (s * height + r) * width;
+
+      for( auto c = std::size_t{0}; c < width; ++c ) {
+        const auto x = origin.x() + step.x() * float_t(c);
+
+        row[c] = octave_noise_3d( octaves, persistence, scale, x, y, z );
+      }
+    }
+  }
+}
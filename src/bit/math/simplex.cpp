@@ -1,167 +1,449 @@
 #include <bit/math/simplex.hpp>
 
 #include <bit/math/angles.hpp>
+#include <bit/math/detail/aligned_allocator.hpp>
+
+#include "detail/noise_tables.hpp"
+#include "detail/simd.hpp"
+
+#include <algorithm>          // std::copy_n, std::min, std::max
+#include <atomic>             // std::atomic
+#include <cmath>              // std::floor
+#include <condition_variable> // std::condition_variable
+#include <cstdint>            // std::uint8_t, std::uint64_t
+#include <functional>         // std::function
+#include <limits>             // std::numeric_limits
+#include <mutex>              // std::mutex, std::unique_lock, std::lock_guard
+#include <system_error>       // std::system_error
+#include <thread>             // std::thread
+#include <vector>             // std::vector
 
 namespace {
 
-  // The gradients are the midpoints of the vertices of a cube.
-  static const int g_grad[12][3] = {
-    {1,1,0}, {-1,1,0}, {1,-1,0}, {-1,-1,0},
-    {1,0,1}, {-1,0,1}, {1,0,-1}, {-1,0,-1},
-    {0,1,1}, {0,-1,1}, {0,1,-1}, {0,-1,-1}
-  };
+  using bit::math::float_t;
 
-  // Permutation table. The same list is repeated twice.
-  static constexpr int g_permutation_table[512] = {
-    151,160,137,91,90,15,131,13,201,95,96,53,194,233,7,225,140,36,103,30,69,142,
-    8,99,37,240,21,10,23,190,6,148,247,120,234,75,0,26,197,62,94,252,219,203,117,
-    35,11,32,57,177,33,88,237,149,56,87,174,20,125,136,171,168,68,175,74,165,71,
-    134,139,48,27,166,77,146,158,231,83,111,229,122,60,211,133,230,220,105,92,41,
-    55,46,245,40,244,102,143,54,65,25,63,161,1,216,80,73,209,76,132,187,208, 89,
-    18,169,200,196,135,130,116,188,159,86,164,100,109,198,173,186,3,64,52,217,226,
-    250,124,123,5,202,38,147,118,126,255,82,85,212,207,206,59,227,47,16,58,17,182,
-    189,28,42,223,183,170,213,119,248,152,2,44,154,163,70,221,153,101,155,167,43,
-    172,9,129,22,39,253,19,98,108,110,79,113,224,232,178,185,112,104,218,246,97,
-    228,251,34,242,193,238,210,144,12,191,179,162,241,81,51,145,235,249,14,239,
-    107,49,192,214,31,181,199,106,157,184,84,204,176,115,121,50,45,127,4,150,254,
-    138,236,205,93,222,114,67,29,24,72,243,141,128,195,78,66,215,61,156,180,
-
-    151,160,137,91,90,15,131,13,201,95,96,53,194,233,7,225,140,36,103,30,69,142,
-    8,99,37,240,21,10,23,190,6,148,247,120,234,75,0,26,197,62,94,252,219,203,117,
-    35,11,32,57,177,33,88,237,149,56,87,174,20,125,136,171,168,68,175,74,165,71,
-    134,139,48,27,166,77,146,158,231,83,111,229,122,60,211,133,230,220,105,92,41,
-    55,46,245,40,244,102,143,54,65,25,63,161,1,216,80,73,209,76,132,187,208, 89,
-    18,169,200,196,135,130,116,188,159,86,164,100,109,198,173,186,3,64,52,217,226,
-    250,124,123,5,202,38,147,118,126,255,82,85,212,207,206,59,227,47,16,58,17,182,
-    189,28,42,223,183,170,213,119,248,152,2,44,154,163,70,221,153,101,155,167,43,
-    172,9,129,22,39,253,19,98,108,110,79,113,224,232,178,185,112,104,218,246,97,
-    228,251,34,242,193,238,210,144,12,191,179,162,241,81,51,145,235,249,14,239,
-    107,49,192,214,31,181,199,106,157,184,84,204,176,115,121,50,45,127,4,150,254,
-    138,236,205,93,222,114,67,29,24,72,243,141,128,195,78,66,215,61,156,180
-  };
+  using bit::math::detail::dot2;
+  using bit::math::detail::dot3;
+  using bit::math::detail::floor_f_to_i;
+  using bit::math::detail::g_grad;
+  using bit::math::detail::g_grad_x;
+  using bit::math::detail::g_grad_y;
+  using bit::math::detail::g_grad_z;
+  using bit::math::detail::g_permutation_table;
+  using bit::math::detail::g_permutation_mod12;
 
+  // The 4D gradients are the midpoints of the edges of a 4D hypercube.
+  static const int g_grad4[32][4] = {
+    {0,1,1,1},  {0,1,1,-1},  {0,1,-1,1},  {0,1,-1,-1},
+    {0,-1,1,1}, {0,-1,1,-1}, {0,-1,-1,1}, {0,-1,-1,-1},
+    {1,0,1,1},  {1,0,1,-1},  {1,0,-1,1},  {1,0,-1,-1},
+    {-1,0,1,1}, {-1,0,1,-1}, {-1,0,-1,1}, {-1,0,-1,-1},
+    {1,1,0,1},  {1,1,0,-1},  {1,-1,0,1},  {1,-1,0,-1},
+    {-1,1,0,1}, {-1,1,0,-1}, {-1,-1,0,1}, {-1,-1,0,-1},
+    {1,1,1,0},  {1,1,-1,0},  {1,-1,1,0},  {1,-1,-1,0},
+    {-1,1,1,0}, {-1,1,-1,0}, {-1,-1,1,0}, {-1,-1,-1,0}
+  };
 
   const float_t g_sqrt3 = bit::math::sqrt( 3.0 );
   const float_t g_sqrt5 = bit::math::sqrt( 5.0 );
 
   const float_t g_skew   = (0.5 * (g_sqrt3 - 1.0));
-  const float_t g_unskew = ((3.0 - g_sqrt5) / 6.0);
+  const float_t g_unskew = ((3.0 - g_sqrt3) / 6.0);
 
-  constexpr float_t dot2( const int* a, float_t x, float_t y ) {
-    return a[0]*x + a[1]*y;
-  }
+  const float_t g_skew_3d   = (1.0 / 3.0);
+  const float_t g_unskew_3d = (1.0 / 6.0);
 
-  constexpr int floor_f_to_i( float_t x ) {
-    return x > 0 ? ((int) x) : ((int) x) - 1;
+  const float_t g_skew_4d   = ((g_sqrt5 - 1.0) / 4.0);
+  const float_t g_unskew_4d = ((5.0 - g_sqrt5) / 20.0);
+
+  constexpr float_t dot4( const int* a,
+                          float_t x, float_t y, float_t z, float_t w ) {
+    return a[0]*x + a[1]*y + a[2]*z + a[3]*w;
   }
-} // anonymous namespace
 
-//----------------------------------------------------------------------------
-// Raw Noise
-//----------------------------------------------------------------------------
+  //--------------------------------------------------------------------------
+  // Permutation Tables
+  //--------------------------------------------------------------------------
 
-bit::math::float_t
-  bit::math::simplex::raw_noise( float_t x, float_t y )
-  noexcept
-{
-  // Noise contributions from the three corners
-  float_t n0, n1, n2;
+  // Hashes lattice coordinates with the classic, fixed permutation table
+  struct classic_table
+  {
+    int permute( int i ) const noexcept { return g_permutation_table[i]; }
+    int gradient( int i ) const noexcept { return g_permutation_mod12.values[i]; }
+    int gradient4( int i ) const noexcept { return g_permutation_table[i] % 32; }
+  };
 
-  // Hairy factor for 2D
-  auto s = (x + y) * g_skew;
-  auto i = floor_f_to_i( x + s );
-  auto j = floor_f_to_i( y + s );
+  // Hashes lattice coordinates with a seeded 256-entry table. Indices wrap
+  // with a mask rather than reading from a duplicated 512-entry table
+  struct seeded_table
+  {
+    const std::uint8_t* permutation;
+    const std::uint8_t* gradients;
 
-  auto t = (i + j) * g_unskew;
+    int permute( int i ) const noexcept { return permutation[i & 255]; }
+    int gradient( int i ) const noexcept { return gradients[i & 255]; }
+    int gradient4( int i ) const noexcept { return permutation[i & 255] & 31; }
+  };
 
-  // Unskew the cell origin back to (x,y) space
-  const auto x_unskew = i - t;
-  const auto y_unskew = j - t;
+  //--------------------------------------------------------------------------
+  // Noise Kernels
+  //--------------------------------------------------------------------------
 
-  // The x,y distances from the cell origin
-  auto x0 = x - x_unskew;
-  auto y0 = y - y_unskew;
+  template<typename Table>
+  float_t raw_noise_2d( const Table& table, float_t x, float_t y )
+    noexcept
+  {
+    // Noise contributions from the three corners
+    float_t n0, n1, n2;
 
-  // For the 2D case, the simplex shape is an equilateral triangle.
-  // Determine which simplex we are in.
+    // Hairy factor for 2D
+    auto s = (x + y) * g_skew;
+    auto i = floor_f_to_i( x + s );
+    auto j = floor_f_to_i( y + s );
 
-  int i1, j1; // Offsets for second (middle) corner of simplex in (i,j) coords
+    auto t = (i + j) * g_unskew;
 
-  if(x0>y0){
-    i1 = 1;
-    j1 = 0;
-  }else{ // lower triangle, XY order: (0,0)->(1,0)->(1,1)
-    i1 = 0;
-    j1 = 1;
-  }      // upper triangle, YX order: (0,0)->(0,1)->(1,1)
+    // Unskew the cell origin back to (x,y) space
+    const auto x_unskew = i - t;
+    const auto y_unskew = j - t;
 
-  // A step of (1,0) in (i,j) means a step of (1-c,-c) in (x,y), and
-  // a step of (0,1) in (i,j) means a step of (-c,1-c) in (x,y), where
-  // c = (3-sqrt(3))/6
-  auto x1 = x0 - i1 + g_unskew; // Offsets for middle corner in (x,y) unskewed coords
-  auto y1 = y0 - j1 + g_unskew;
-  auto x2 = x0 - 1.0 + 2.0 * g_unskew; // Offsets for last corner in (x,y) unskewed coords
-  auto y2 = y0 - 1.0 + 2.0 * g_unskew;
+    // The x,y distances from the cell origin
+    auto x0 = x - x_unskew;
+    auto y0 = y - y_unskew;
 
-  // Work out the hashed gradient indices of the three simplex corners
-  auto ii = i & 255;
-  auto jj = j & 255;
-  auto gi0 = g_permutation_table[ ii + g_permutation_table[jj] ] % 12;
-  auto gi1 = g_permutation_table[ ii + i1 + g_permutation_table[jj + j1] ] % 12;
-  auto gi2 = g_permutation_table[ ii + 1  + g_permutation_table[jj + 1] ] % 12;
+    // For the 2D case, the simplex shape is an equilateral triangle.
+    // Determine which simplex we are in.
 
-  // Calculate the contribution from the three corners
-  auto t0 = 0.5 - (x0*x0) - (y0*y0);
+    int i1, j1; // Offsets for second (middle) corner of simplex in (i,j) coords
 
-  if(t0<0){
-    n0 = 0.0;
-  }else{
-    t0 *= t0;
-    n0 = t0 * t0 * dot2( g_grad[gi0], x0, y0 );
-  }
+    if(x0>y0){
+      i1 = 1;
+      j1 = 0;
+    }else{ // lower triangle, XY order: (0,0)->(1,0)->(1,1)
+      i1 = 0;
+      j1 = 1;
+    }      // upper triangle, YX order: (0,0)->(0,1)->(1,1)
+
+    // A step of (1,0) in (i,j) means a step of (1-c,-c) in (x,y), and
+    // a step of (0,1) in (i,j) means a step of (-c,1-c) in (x,y), where
+    // c = (3-sqrt(3))/6
+    auto x1 = x0 - i1 + g_unskew; // Offsets for middle corner in (x,y) unskewed coords
+    auto y1 = y0 - j1 + g_unskew;
+    auto x2 = x0 - 1.0 + 2.0 * g_unskew; // Offsets for last corner in (x,y) unskewed coords
+    auto y2 = y0 - 1.0 + 2.0 * g_unskew;
+
+    // Work out the hashed gradient indices of the three simplex corners
+    auto ii = i & 255;
+    auto jj = j & 255;
+    auto gi0 = table.gradient( ii + table.permute( jj ) );
+    auto gi1 = table.gradient( ii + i1 + table.permute( jj + j1 ) );
+    auto gi2 = table.gradient( ii + 1  + table.permute( jj + 1 ) );
+
+    // Calculate the contribution from the three corners
+    auto t0 = 0.5 - (x0*x0) - (y0*y0);
+
+    if(t0<0){
+      n0 = 0.0;
+    }else{
+      t0 *= t0;
+      n0 = t0 * t0 * dot2( g_grad[gi0], x0, y0 );
+    }
+
+    auto t1 = 0.5 - x1*x1-y1*y1;
+    if(t1<0){
+      n1 = 0.0;
+    } else {
+      t1 *= t1;
+      n1 = t1 * t1 * dot2( g_grad[gi1], x1, y1 );
+    }
+
+    auto t2 = 0.5 - x2*x2-y2*y2;
+    if(t2<0){
+      n2 = 0.0;
+    } else {
+      t2 *= t2;
+      n2 = t2 * t2 * dot2( g_grad[gi2], x2, y2 );
+    }
 
-  auto t1 = 0.5 - x1*x1-y1*y1;
-  if(t1<0){
-    n1 = 0.0;
-  } else {
-    t1 *= t1;
-    n1 = t1 * t1 * dot2( g_grad[gi1], x1, y1 );
+    // Add contributions from each corner to get the final noise value.
+    // The result is scaled to return values in the interval [-1,1].
+    return 70.0 * (n0 + n1 + n2);
   }
 
-  auto t2 = 0.5 - x2*x2-y2*y2;
-  if(t2<0){
-    n2 = 0.0;
-  } else {
-    t2 *= t2;
-    n2 = t2 * t2 * dot2( g_grad[gi2], x2, y2 );
+  template<typename Table>
+  float_t raw_noise_3d( const Table& table, float_t x, float_t y, float_t z )
+    noexcept
+  {
+    // Noise contributions from the four corners
+    float_t n0, n1, n2, n3;
+
+    // Skew the input space to determine which simplex cell we're in
+    auto s = (x + y + z) * g_skew_3d;
+    auto i = floor_f_to_i( x + s );
+    auto j = floor_f_to_i( y + s );
+    auto k = floor_f_to_i( z + s );
+
+    auto t = (i + j + k) * g_unskew_3d;
+
+    // Unskew the cell origin back to (x,y,z) space
+    const auto x_unskew = i - t;
+    const auto y_unskew = j - t;
+    const auto z_unskew = k - t;
+
+    // The x,y,z distances from the cell origin
+    auto x0 = x - x_unskew;
+    auto y0 = y - y_unskew;
+    auto z0 = z - z_unskew;
+
+    // For the 3D case, the simplex shape is a slightly irregular tetrahedron.
+    // Determine which simplex we are in.
+
+    int i1, j1, k1; // Offsets for second corner of simplex in (i,j,k) coords
+    int i2, j2, k2; // Offsets for third corner of simplex in (i,j,k) coords
+
+    if(x0>=y0){
+      if(y0>=z0){        // X Y Z order
+        i1 = 1; j1 = 0; k1 = 0;
+        i2 = 1; j2 = 1; k2 = 0;
+      }else if(x0>=z0){  // X Z Y order
+        i1 = 1; j1 = 0; k1 = 0;
+        i2 = 1; j2 = 0; k2 = 1;
+      }else{             // Z X Y order
+        i1 = 0; j1 = 0; k1 = 1;
+        i2 = 1; j2 = 0; k2 = 1;
+      }
+    }else{
+      if(y0<z0){         // Z Y X order
+        i1 = 0; j1 = 0; k1 = 1;
+        i2 = 0; j2 = 1; k2 = 1;
+      }else if(x0<z0){   // Y Z X order
+        i1 = 0; j1 = 1; k1 = 0;
+        i2 = 0; j2 = 1; k2 = 1;
+      }else{             // Y X Z order
+        i1 = 0; j1 = 1; k1 = 0;
+        i2 = 1; j2 = 1; k2 = 0;
+      }
+    }
+
+    // A step of (1,0,0) in (i,j,k) means a step of (1-c,-c,-c) in (x,y,z),
+    // a step of (0,1,0) in (i,j,k) means a step of (-c,1-c,-c) in (x,y,z), and
+    // a step of (0,0,1) in (i,j,k) means a step of (-c,-c,1-c) in (x,y,z),
+    // where c = 1/6.
+    auto x1 = x0 - i1 + g_unskew_3d; // Offsets for second corner
+    auto y1 = y0 - j1 + g_unskew_3d;
+    auto z1 = z0 - k1 + g_unskew_3d;
+    auto x2 = x0 - i2 + 2.0 * g_unskew_3d; // Offsets for third corner
+    auto y2 = y0 - j2 + 2.0 * g_unskew_3d;
+    auto z2 = z0 - k2 + 2.0 * g_unskew_3d;
+    auto x3 = x0 - 1.0 + 3.0 * g_unskew_3d; // Offsets for last corner
+    auto y3 = y0 - 1.0 + 3.0 * g_unskew_3d;
+    auto z3 = z0 - 1.0 + 3.0 * g_unskew_3d;
+
+    // Work out the hashed gradient indices of the four simplex corners
+    auto ii = i & 255;
+    auto jj = j & 255;
+    auto kk = k & 255;
+    auto gi0 = table.gradient( ii + table.permute( jj + table.permute( kk ) ) );
+    auto gi1 = table.gradient( ii + i1 + table.permute( jj + j1 + table.permute( kk + k1 ) ) );
+    auto gi2 = table.gradient( ii + i2 + table.permute( jj + j2 + table.permute( kk + k2 ) ) );
+    auto gi3 = table.gradient( ii + 1  + table.permute( jj + 1  + table.permute( kk + 1 ) ) );
+
+    // Calculate the contribution from the four corners
+    auto t0 = 0.6 - x0*x0 - y0*y0 - z0*z0;
+    if(t0<0){
+      n0 = 0.0;
+    }else{
+      t0 *= t0;
+      n0 = t0 * t0 * dot3( g_grad[gi0], x0, y0, z0 );
+    }
+
+    auto t1 = 0.6 - x1*x1 - y1*y1 - z1*z1;
+    if(t1<0){
+      n1 = 0.0;
+    }else{
+      t1 *= t1;
+      n1 = t1 * t1 * dot3( g_grad[gi1], x1, y1, z1 );
+    }
+
+    auto t2 = 0.6 - x2*x2 - y2*y2 - z2*z2;
+    if(t2<0){
+      n2 = 0.0;
+    }else{
+      t2 *= t2;
+      n2 = t2 * t2 * dot3( g_grad[gi2], x2, y2, z2 );
+    }
+
+    auto t3 = 0.6 - x3*x3 - y3*y3 - z3*z3;
+    if(t3<0){
+      n3 = 0.0;
+    }else{
+      t3 *= t3;
+      n3 = t3 * t3 * dot3( g_grad[gi3], x3, y3, z3 );
+    }
+
+    // Add contributions from each corner to get the final noise value.
+    // The result is scaled to stay just inside [-1,1]
+    return 32.0 * (n0 + n1 + n2 + n3);
   }
 
-  // Add contributions from each corner to get the final noise value.
-  // The result is scaled to return values in the interval [-1,1].
-  return 70.0 * (n0 + n1 + n2);
-}
+  template<typename Table>
+  float_t raw_noise_4d( const Table& table,
+                        float_t x, float_t y, float_t z, float_t w )
+    noexcept
+  {
+    // Noise contributions from the five corners
+    float_t n0, n1, n2, n3, n4;
 
-bit::math::float_t
-  bit::math::simplex::raw_noise( float_t x, float_t y, float_t z )
-  noexcept
-{
-  // TODO(matthew rodusek) 2017-04-22: Implement
-  return x+y+z;
-}
+    // Skew the (x,y,z,w) space to determine which cell of 24 simplices we're in
+    auto s = (x + y + z + w) * g_skew_4d;
+    auto i = floor_f_to_i( x + s );
+    auto j = floor_f_to_i( y + s );
+    auto k = floor_f_to_i( z + s );
+    auto l = floor_f_to_i( w + s );
 
-//----------------------------------------------------------------------------
-// Octave Noises
-//----------------------------------------------------------------------------
+    auto t = (i + j + k + l) * g_unskew_4d;
 
-bit::math::float_t
-  bit::math::simplex::octave_noise( float_t octaves,
-                                    float_t persistence,
-                                    float_t scale,
-                                    float_t x,
-                                    float_t y )
-  noexcept
-{
+    // Unskew the cell origin back to (x,y,z,w) space
+    const auto x_unskew = i - t;
+    const auto y_unskew = j - t;
+    const auto z_unskew = k - t;
+    const auto w_unskew = l - t;
+
+    // The x,y,z,w distances from the cell origin
+    auto x0 = x - x_unskew;
+    auto y0 = y - y_unskew;
+    auto z0 = z - z_unskew;
+    auto w0 = w - w_unskew;
 
+    // For the 4D case, the simplex is a 4D shape. To find out which of the 24
+    // possible simplices we're in, we rank the magnitudes of x0, y0, z0 and w0
+    // by doing six pair-wise comparisons.
+    auto rank_x = 0;
+    auto rank_y = 0;
+    auto rank_z = 0;
+    auto rank_w = 0;
+    if(x0 > y0) ++rank_x; else ++rank_y;
+    if(x0 > z0) ++rank_x; else ++rank_z;
+    if(x0 > w0) ++rank_x; else ++rank_w;
+    if(y0 > z0) ++rank_y; else ++rank_z;
+    if(y0 > w0) ++rank_y; else ++rank_w;
+    if(z0 > w0) ++rank_z; else ++rank_w;
+
+    // The rank of each coordinate determines at which corner it is stepped
+    // along; the largest coordinate is stepped first.
+    const auto i1 = rank_x >= 3 ? 1 : 0;
+    const auto j1 = rank_y >= 3 ? 1 : 0;
+    const auto k1 = rank_z >= 3 ? 1 : 0;
+    const auto l1 = rank_w >= 3 ? 1 : 0;
+
+    const auto i2 = rank_x >= 2 ? 1 : 0;
+    const auto j2 = rank_y >= 2 ? 1 : 0;
+    const auto k2 = rank_z >= 2 ? 1 : 0;
+    const auto l2 = rank_w >= 2 ? 1 : 0;
+
+    const auto i3 = rank_x >= 1 ? 1 : 0;
+    const auto j3 = rank_y >= 1 ? 1 : 0;
+    const auto k3 = rank_z >= 1 ? 1 : 0;
+    const auto l3 = rank_w >= 1 ? 1 : 0;
+
+    // The fifth corner has all coordinate offsets = 1, so no need to compute it
+    auto x1 = x0 - i1 + g_unskew_4d; // Offsets for second corner
+    auto y1 = y0 - j1 + g_unskew_4d;
+    auto z1 = z0 - k1 + g_unskew_4d;
+    auto w1 = w0 - l1 + g_unskew_4d;
+    auto x2 = x0 - i2 + 2.0 * g_unskew_4d; // Offsets for third corner
+    auto y2 = y0 - j2 + 2.0 * g_unskew_4d;
+    auto z2 = z0 - k2 + 2.0 * g_unskew_4d;
+    auto w2 = w0 - l2 + 2.0 * g_unskew_4d;
+    auto x3 = x0 - i3 + 3.0 * g_unskew_4d; // Offsets for fourth corner
+    auto y3 = y0 - j3 + 3.0 * g_unskew_4d;
+    auto z3 = z0 - k3 + 3.0 * g_unskew_4d;
+    auto w3 = w0 - l3 + 3.0 * g_unskew_4d;
+    auto x4 = x0 - 1.0 + 4.0 * g_unskew_4d; // Offsets for last corner
+    auto y4 = y0 - 1.0 + 4.0 * g_unskew_4d;
+    auto z4 = z0 - 1.0 + 4.0 * g_unskew_4d;
+    auto w4 = w0 - 1.0 + 4.0 * g_unskew_4d;
+
+    // Work out the hashed gradient indices of the five simplex corners
+    auto ii = i & 255;
+    auto jj = j & 255;
+    auto kk = k & 255;
+    auto ll = l & 255;
+    auto gi0 = table.gradient4( ii +
+                 table.permute( jj +
+                   table.permute( kk +
+                     table.permute( ll ) ) ) );
+    auto gi1 = table.gradient4( ii + i1 +
+                 table.permute( jj + j1 +
+                   table.permute( kk + k1 +
+                     table.permute( ll + l1 ) ) ) );
+    auto gi2 = table.gradient4( ii + i2 +
+                 table.permute( jj + j2 +
+                   table.permute( kk + k2 +
+                     table.permute( ll + l2 ) ) ) );
+    auto gi3 = table.gradient4( ii + i3 +
+                 table.permute( jj + j3 +
+                   table.permute( kk + k3 +
+                     table.permute( ll + l3 ) ) ) );
+    auto gi4 = table.gradient4( ii + 1  +
+                 table.permute( jj + 1  +
+                   table.permute( kk + 1  +
+                     table.permute( ll + 1 ) ) ) );
+
+    // Calculate the contribution from the five corners
+    auto t0 = 0.6 - x0*x0 - y0*y0 - z0*z0 - w0*w0;
+    if(t0<0){
+      n0 = 0.0;
+    }else{
+      t0 *= t0;
+      n0 = t0 * t0 * dot4( g_grad4[gi0], x0, y0, z0, w0 );
+    }
+
+    auto t1 = 0.6 - x1*x1 - y1*y1 - z1*z1 - w1*w1;
+    if(t1<0){
+      n1 = 0.0;
+    }else{
+      t1 *= t1;
+      n1 = t1 * t1 * dot4( g_grad4[gi1], x1, y1, z1, w1 );
+    }
+
+    auto t2 = 0.6 - x2*x2 - y2*y2 - z2*z2 - w2*w2;
+    if(t2<0){
+      n2 = 0.0;
+    }else{
+      t2 *= t2;
+      n2 = t2 * t2 * dot4( g_grad4[gi2], x2, y2, z2, w2 );
+    }
+
+    auto t3 = 0.6 - x3*x3 - y3*y3 - z3*z3 - w3*w3;
+    if(t3<0){
+      n3 = 0.0;
+    }else{
+      t3 *= t3;
+      n3 = t3 * t3 * dot4( g_grad4[gi3], x3, y3, z3, w3 );
+    }
+
+    auto t4 = 0.6 - x4*x4 - y4*y4 - z4*z4 - w4*w4;
+    if(t4<0){
+      n4 = 0.0;
+    }else{
+      t4 *= t4;
+      n4 = t4 * t4 * dot4( g_grad4[gi4], x4, y4, z4, w4 );
+    }
+
+    // Sum up and scale the result to cover the range [-1,1]
+    return 27.0 * (n0 + n1 + n2 + n3 + n4);
+  }
+
+  template<typename Table>
+  float_t octave_noise_2d( const Table& table,
+                           float_t octaves,
+                           float_t persistence,
+                           float_t scale,
+                           float_t x,
+                           float_t y )
+    noexcept
+  {
     auto frequency = scale;
     auto total     = float_t(0.0);
     auto amplitude = float_t(1.0);
@@ -169,7 +451,7 @@ bit::math::float_t
     auto max_amplitude = float_t(0);
 
     for( auto i = 0; i < int(octaves); ++i ) {
-      total += raw_noise( x * frequency, y * frequency ) * amplitude;
+      total += raw_noise_2d( table, x * frequency, y * frequency ) * amplitude;
 
       max_amplitude += amplitude;
       frequency *= 2;
@@ -177,18 +459,47 @@ bit::math::float_t
     }
 
     return total / max_amplitude;
-}
+  }
 
-bit::math::float_t
-  bit::math::simplex::octave_noise( float_t octaves,
-                                    float_t persistence,
-                                    float_t scale,
-                                    float_t x,
-                                    float_t y,
-                                    float_t z )
-  noexcept
-{
+  template<typename Table>
+  float_t octave_noise_3d( const Table& table,
+                           float_t octaves,
+                           float_t persistence,
+                           float_t scale,
+                           float_t x,
+                           float_t y,
+                           float_t z )
+    noexcept
+  {
+    auto frequency = scale;
+    auto total     = float_t(0.0);
+    auto amplitude = float_t(1.0);
 
+    auto max_amplitude = float_t(0);
+
+    for( int i = 0; i < int(octaves); ++i ) {
+      total += raw_noise_3d( table, x*frequency, y*frequency,
+                             z*frequency ) * amplitude;
+
+      max_amplitude += amplitude;
+      frequency *= 2;
+      amplitude *= persistence;
+    }
+
+    return total / max_amplitude;
+  }
+
+  template<typename Table>
+  float_t octave_noise_4d( const Table& table,
+                           float_t octaves,
+                           float_t persistence,
+                           float_t scale,
+                           float_t x,
+                           float_t y,
+                           float_t z,
+                           float_t w )
+    noexcept
+  {
     auto frequency = scale;
     auto total     = float_t(0.0);
     auto amplitude = float_t(1.0);
@@ -196,12 +507,1955 @@ bit::math::float_t
     auto max_amplitude = float_t(0);
 
     for( int i = 0; i < int(octaves); ++i ) {
-      total += raw_noise( x*frequency, y*frequency, z*frequency ) * amplitude;
+      total += raw_noise_4d( table, x*frequency, y*frequency,
+                             z*frequency, w*frequency ) * amplitude;
+
+      max_amplitude += amplitude;
+      frequency *= 2;
+      amplitude *= persistence;
+    }
+
+    return total / max_amplitude;
+  }
+
+  //--------------------------------------------------------------------------
+  // Scheduled Octave Kernels
+  //--------------------------------------------------------------------------
+
+  // These accumulate octaves in the same order as octave_noise_Nd, so that a
+  // schedule without a quantum produces bit-identical results
+
+  template<typename Table>
+  float_t scheduled_noise_2d( const Table& table,
+                              const bit::math::octave_schedule& schedule,
+                              float_t x,
+                              float_t y )
+    noexcept
+  {
+    auto total = float_t(0.0);
+
+    for( auto i = std::size_t{0}; i < schedule.octaves(); ++i ) {
+      const auto frequency = schedule.frequency(i);
+
+      total += raw_noise_2d( table, x*frequency, y*frequency ) *
+               schedule.amplitude(i);
+
+      if( schedule.is_settled( i, total ) ) break;
+    }
+
+    return total / schedule.max_amplitude();
+  }
+
+  template<typename Table>
+  float_t scheduled_noise_3d( const Table& table,
+                              const bit::math::octave_schedule& schedule,
+                              float_t x,
+                              float_t y,
+                              float_t z )
+    noexcept
+  {
+    auto total = float_t(0.0);
+
+    for( auto i = std::size_t{0}; i < schedule.octaves(); ++i ) {
+      const auto frequency = schedule.frequency(i);
+
+      total += raw_noise_3d( table, x*frequency, y*frequency,
+                             z*frequency ) * schedule.amplitude(i);
+
+      if( schedule.is_settled( i, total ) ) break;
+    }
+
+    return total / schedule.max_amplitude();
+  }
+
+  template<typename Table>
+  float_t scheduled_noise_4d( const Table& table,
+                              const bit::math::octave_schedule& schedule,
+                              float_t x,
+                              float_t y,
+                              float_t z,
+                              float_t w )
+    noexcept
+  {
+    auto total = float_t(0.0);
+
+    for( auto i = std::size_t{0}; i < schedule.octaves(); ++i ) {
+      const auto frequency = schedule.frequency(i);
+
+      total += raw_noise_4d( table, x*frequency, y*frequency,
+                             z*frequency, w*frequency ) * schedule.amplitude(i);
+
+      if( schedule.is_settled( i, total ) ) break;
+    }
+
+    return total / schedule.max_amplitude();
+  }
+
+  //--------------------------------------------------------------------------
+  // Noise Gradient Kernels
+  //--------------------------------------------------------------------------
+
+  // Accumulates the contribution of a single simplex corner, and its
+  // derivative with respect to the sample position. The corner's kernel is
+  // (r2 - |d|^2)^4 (g.d), whose derivative is
+  // (r2 - |d|^2)^4 g - 8 (r2 - |d|^2)^3 (g.d) d
+  template<std::size_t N>
+  void accumulate_corner( const int* g,
+                          const float_t (&d)[N],
+                          float_t r2,
+                          float_t* value,
+                          float_t (&gradient)[N] )
+    noexcept
+  {
+    auto t = r2;
+    auto g_dot_d = float_t(0);
+    for( auto i = std::size_t{0}; i < N; ++i ) {
+      t -= d[i] * d[i];
+      g_dot_d += g[i] * d[i];
+    }
+    if( t < 0 ) return;
+
+    const auto t2 = t * t;
+    const auto t4 = t2 * t2;
+    const auto falloff = float_t(-8) * t2 * t * g_dot_d;
+
+    (*value) += t4 * g_dot_d;
+    for( auto i = std::size_t{0}; i < N; ++i ) {
+      gradient[i] += t4 * g[i] + falloff * d[i];
+    }
+  }
+
+  template<typename Table>
+  float_t raw_noise_2d_with_gradient( const Table& table,
+                                      float_t x, float_t y,
+                                      float_t (&gradient)[2] )
+    noexcept
+  {
+    const auto s = (x + y) * g_skew;
+    const auto i = floor_f_to_i( x + s );
+    const auto j = floor_f_to_i( y + s );
+    const auto t = (i + j) * g_unskew;
+
+    const auto x0 = x - (i - t);
+    const auto y0 = y - (j - t);
+
+    const auto i1 = (x0 > y0) ? 1 : 0;
+    const auto j1 = 1 - i1;
+
+    const float_t d0[2] = { x0, y0 };
+    const float_t d1[2] = { x0 - i1 + g_unskew, y0 - j1 + g_unskew };
+    const float_t d2[2] = { x0 - float_t(1) + float_t(2) * g_unskew,
+                            y0 - float_t(1) + float_t(2) * g_unskew };
+
+    const auto ii = i & 255;
+    const auto jj = j & 255;
+
+    auto value = float_t(0);
+    gradient[0] = gradient[1] = float_t(0);
+
+    accumulate_corner( g_grad[table.gradient( ii + table.permute( jj ) )],
+                       d0, float_t(0.5), &value, gradient );
+    accumulate_corner( g_grad[table.gradient( ii + i1 + table.permute( jj + j1 ) )],
+                       d1, float_t(0.5), &value, gradient );
+    accumulate_corner( g_grad[table.gradient( ii + 1 + table.permute( jj + 1 ) )],
+                       d2, float_t(0.5), &value, gradient );
+
+    gradient[0] *= float_t(70);
+    gradient[1] *= float_t(70);
+    return float_t(70) * value;
+  }
+
+  template<typename Table>
+  float_t raw_noise_3d_with_gradient( const Table& table,
+                                      float_t x, float_t y, float_t z,
+                                      float_t (&gradient)[3] )
+    noexcept
+  {
+    const auto s = (x + y + z) * g_skew_3d;
+    const auto i = floor_f_to_i( x + s );
+    const auto j = floor_f_to_i( y + s );
+    const auto k = floor_f_to_i( z + s );
+    const auto t = (i + j + k) * g_unskew_3d;
+
+    const auto x0 = x - (i - t);
+    const auto y0 = y - (j - t);
+    const auto z0 = z - (k - t);
+
+    // Rank the coordinates to find the simplex, as in raw_noise_3d
+    const auto x_ge_y = (x0 >= y0) ? 1 : 0;
+    const auto y_ge_z = (y0 >= z0) ? 1 : 0;
+    const auto x_ge_z = (x0 >= z0) ? 1 : 0;
+
+    const auto i1 = x_ge_y & x_ge_z;
+    const auto j1 = (1 - x_ge_y) & y_ge_z;
+    const auto k1 = (1 - x_ge_z) & (1 - y_ge_z);
+    const auto i2 = x_ge_y | x_ge_z;
+    const auto j2 = (1 - x_ge_y) | y_ge_z;
+    const auto k2 = (1 - x_ge_z) | (1 - y_ge_z);
+
+    const float_t d0[3] = { x0, y0, z0 };
+    const float_t d1[3] = { x0 - i1 + g_unskew_3d,
+                            y0 - j1 + g_unskew_3d,
+                            z0 - k1 + g_unskew_3d };
+    const float_t d2[3] = { x0 - i2 + float_t(2) * g_unskew_3d,
+                            y0 - j2 + float_t(2) * g_unskew_3d,
+                            z0 - k2 + float_t(2) * g_unskew_3d };
+    const float_t d3[3] = { x0 - float_t(1) + float_t(3) * g_unskew_3d,
+                            y0 - float_t(1) + float_t(3) * g_unskew_3d,
+                            z0 - float_t(1) + float_t(3) * g_unskew_3d };
+
+    const auto ii = i & 255;
+    const auto jj = j & 255;
+    const auto kk = k & 255;
+
+    auto value = float_t(0);
+    gradient[0] = gradient[1] = gradient[2] = float_t(0);
+
+    accumulate_corner( g_grad[table.gradient( ii + table.permute( jj + table.permute( kk ) ) )],
+                       d0, float_t(0.6), &value, gradient );
+    accumulate_corner( g_grad[table.gradient( ii + i1 + table.permute( jj + j1 + table.permute( kk + k1 ) ) )],
+                       d1, float_t(0.6), &value, gradient );
+    accumulate_corner( g_grad[table.gradient( ii + i2 + table.permute( jj + j2 + table.permute( kk + k2 ) ) )],
+                       d2, float_t(0.6), &value, gradient );
+    accumulate_corner( g_grad[table.gradient( ii + 1 + table.permute( jj + 1 + table.permute( kk + 1 ) ) )],
+                       d3, float_t(0.6), &value, gradient );
+
+    gradient[0] *= float_t(32);
+    gradient[1] *= float_t(32);
+    gradient[2] *= float_t(32);
+    return float_t(32) * value;
+  }
+
+  // The gradient of the octave sum is the sum of each octave's gradient,
+  // scaled by the chain rule by the octave's frequency
+  template<typename Table>
+  float_t octave_noise_2d_with_gradient( const Table& table,
+                                         float_t octaves,
+                                         float_t persistence,
+                                         float_t scale,
+                                         float_t x,
+                                         float_t y,
+                                         float_t (&gradient)[2] )
+    noexcept
+  {
+    auto frequency = scale;
+    auto total     = float_t(0.0);
+    auto amplitude = float_t(1.0);
+
+    auto max_amplitude = float_t(0);
+
+    gradient[0] = gradient[1] = float_t(0);
+
+    for( auto i = 0; i < int(octaves); ++i ) {
+      float_t d[2];
+      total += raw_noise_2d_with_gradient( table, x * frequency, y * frequency,
+                                           d ) * amplitude;
+      gradient[0] += d[0] * amplitude * frequency;
+      gradient[1] += d[1] * amplitude * frequency;
+
+      max_amplitude += amplitude;
+      frequency *= 2;
+      amplitude *= persistence;
+    }
+
+    gradient[0] /= max_amplitude;
+    gradient[1] /= max_amplitude;
+    return total / max_amplitude;
+  }
+
+  template<typename Table>
+  float_t octave_noise_3d_with_gradient( const Table& table,
+                                         float_t octaves,
+                                         float_t persistence,
+                                         float_t scale,
+                                         float_t x,
+                                         float_t y,
+                                         float_t z,
+                                         float_t (&gradient)[3] )
+    noexcept
+  {
+    auto frequency = scale;
+    auto total     = float_t(0.0);
+    auto amplitude = float_t(1.0);
+
+    auto max_amplitude = float_t(0);
+
+    gradient[0] = gradient[1] = gradient[2] = float_t(0);
+
+    for( auto i = 0; i < int(octaves); ++i ) {
+      float_t d[3];
+      total += raw_noise_3d_with_gradient( table, x * frequency, y * frequency,
+                                           z * frequency, d ) * amplitude;
+      gradient[0] += d[0] * amplitude * frequency;
+      gradient[1] += d[1] * amplitude * frequency;
+      gradient[2] += d[2] * amplitude * frequency;
 
       max_amplitude += amplitude;
       frequency *= 2;
       amplitude *= persistence;
     }
 
+    gradient[0] /= max_amplitude;
+    gradient[1] /= max_amplitude;
+    gradient[2] /= max_amplitude;
     return total / max_amplitude;
+  }
+
+  //--------------------------------------------------------------------------
+  // Lane-parallel 2D noise
+  //--------------------------------------------------------------------------
+
+  namespace simd = bit::math::detail::simd;
+
+  // Computes the contribution of a single simplex corner in every lane.
+  // Corners outside of the kernel radius clamp to zero rather than branch
+  inline simd::floats corner_2d( simd::ints gi, simd::floats x, simd::floats y )
+    noexcept
+  {
+    auto t = simd::broadcast(0.5f) - x*x - y*y;
+    t = simd::max( t, simd::broadcast(0.0f) );
+    t = t * t;
+
+    const auto gx = simd::gather( g_grad_x, gi );
+    const auto gy = simd::gather( g_grad_y, gi );
+
+    return t * t * (gx*x + gy*y);
+  }
+
+  // The lookups of each permutation table for every lane. The seeded tables
+  // wrap their indices with a mask, as in 'seeded_table'
+  inline simd::ints permute_lanes( const classic_table&, simd::ints i )
+    noexcept
+  {
+    return simd::gather( g_permutation_table, i );
+  }
+
+  inline simd::ints gradient_lanes( const classic_table&, simd::ints i )
+    noexcept
+  {
+    return simd::gather( g_permutation_mod12.values, i );
+  }
+
+  inline simd::ints permute_lanes( const seeded_table& table, simd::ints i )
+    noexcept
+  {
+    return simd::gather( table.permutation, i & simd::broadcast(255) );
+  }
+
+  inline simd::ints gradient_lanes( const seeded_table& table, simd::ints i )
+    noexcept
+  {
+    return simd::gather( table.gradients, i & simd::broadcast(255) );
+  }
+
+  // Evaluates raw_noise_2d( table, x, y ) for every lane
+  template<typename Table>
+  simd::floats raw_noise_2d_lanes( const Table& table,
+                                   simd::floats x,
+                                   simd::floats y )
+    noexcept
+  {
+    const auto skew   = simd::broadcast( static_cast<float>(g_skew) );
+    const auto unskew = simd::broadcast( static_cast<float>(g_unskew) );
+    const auto one    = simd::broadcast( 1 );
+    const auto mask   = simd::broadcast( 255 );
+
+    const auto s = (x + y) * skew;
+    const auto i = simd::floor_to_int( x + s );
+    const auto j = simd::floor_to_int( y + s );
+
+    const auto t = simd::to_floats( i + j ) * unskew;
+
+    const auto x0 = x - (simd::to_floats(i) - t);
+    const auto y0 = y - (simd::to_floats(j) - t);
+
+    // The simplex choice is a per-lane mask instead of a branch
+    const auto i1 = simd::greater( x0, y0 ) & one;
+    const auto j1 = one - i1;
+
+    const auto x1 = x0 - simd::to_floats(i1) + unskew;
+    const auto y1 = y0 - simd::to_floats(j1) + unskew;
+    const auto x2 = x0 - simd::broadcast(1.0f) + unskew + unskew;
+    const auto y2 = y0 - simd::broadcast(1.0f) + unskew + unskew;
+
+    const auto ii = i & mask;
+    const auto jj = j & mask;
+
+    const auto p0 = permute_lanes( table, jj );
+    const auto p1 = permute_lanes( table, jj + j1 );
+    const auto p2 = permute_lanes( table, jj + one );
+
+    const auto gi0 = gradient_lanes( table, ii + p0 );
+    const auto gi1 = gradient_lanes( table, ii + i1 + p1 );
+    const auto gi2 = gradient_lanes( table, ii + one + p2 );
+
+    const auto n = corner_2d( gi0, x0, y0 ) +
+                   corner_2d( gi1, x1, y1 ) +
+                   corner_2d( gi2, x2, y2 );
+
+    return simd::broadcast(70.0f) * n;
+  }
+
+  // Evaluates simplex::raw_noise( x, y ) for every lane
+  inline simd::floats raw_noise_lanes( simd::floats x, simd::floats y )
+    noexcept
+  {
+    return raw_noise_2d_lanes( classic_table{}, x, y );
+  }
+
+  //--------------------------------------------------------------------------
+  // Lane-parallel 3D noise
+  //--------------------------------------------------------------------------
+
+  inline simd::floats corner_3d( simd::ints gi,
+                                 simd::floats x,
+                                 simd::floats y,
+                                 simd::floats z )
+    noexcept
+  {
+    auto t = simd::broadcast(0.6f) - x*x - y*y - z*z;
+    t = simd::max( t, simd::broadcast(0.0f) );
+    t = t * t;
+
+    const auto gx = simd::gather( g_grad_x, gi );
+    const auto gy = simd::gather( g_grad_y, gi );
+    const auto gz = simd::gather( g_grad_z, gi );
+
+    return t * t * (gx*x + gy*y + gz*z);
+  }
+
+  // Evaluates raw_noise_3d( table, x, y, z ) for every lane
+  template<typename Table>
+  simd::floats raw_noise_3d_lanes( const Table& table,
+                                   simd::floats x,
+                                   simd::floats y,
+                                   simd::floats z )
+    noexcept
+  {
+    const auto skew   = simd::broadcast( static_cast<float>(g_skew_3d) );
+    const auto unskew = simd::broadcast( static_cast<float>(g_unskew_3d) );
+    const auto one    = simd::broadcast( 1 );
+    const auto mask   = simd::broadcast( 255 );
+
+    const auto s = (x + y + z) * skew;
+    const auto i = simd::floor_to_int( x + s );
+    const auto j = simd::floor_to_int( y + s );
+    const auto k = simd::floor_to_int( z + s );
+
+    const auto t = simd::to_floats( i + j + k ) * unskew;
+
+    const auto x0 = x - (simd::to_floats(i) - t);
+    const auto y0 = y - (simd::to_floats(j) - t);
+    const auto z0 = z - (simd::to_floats(k) - t);
+
+    // The six orderings of the scalar kernel reduce to these 0/1 offsets of
+    // the (x0 >= y0), (y0 >= z0) and (x0 >= z0) comparisons
+    const auto x_ge_y = one - (simd::less( x0, y0 ) & one);
+    const auto y_ge_z = one - (simd::less( y0, z0 ) & one);
+    const auto x_ge_z = one - (simd::less( x0, z0 ) & one);
+
+    const auto i1 = x_ge_y & x_ge_z;
+    const auto j1 = (one - x_ge_y) & y_ge_z;
+    const auto k1 = (one - y_ge_z) & (one - x_ge_z);
+    const auto i2 = x_ge_y | x_ge_z;
+    const auto j2 = (one - x_ge_y) | y_ge_z;
+    const auto k2 = one - (y_ge_z & x_ge_z);
+
+    const auto x1 = x0 - simd::to_floats(i1) + unskew;
+    const auto y1 = y0 - simd::to_floats(j1) + unskew;
+    const auto z1 = z0 - simd::to_floats(k1) + unskew;
+    const auto x2 = x0 - simd::to_floats(i2) + unskew + unskew;
+    const auto y2 = y0 - simd::to_floats(j2) + unskew + unskew;
+    const auto z2 = z0 - simd::to_floats(k2) + unskew + unskew;
+    const auto x3 = x0 - simd::broadcast(1.0f) + unskew + unskew + unskew;
+    const auto y3 = y0 - simd::broadcast(1.0f) + unskew + unskew + unskew;
+    const auto z3 = z0 - simd::broadcast(1.0f) + unskew + unskew + unskew;
+
+    const auto ii = i & mask;
+    const auto jj = j & mask;
+    const auto kk = k & mask;
+
+    const auto hash = [&]( simd::ints di, simd::ints dj, simd::ints dk ) {
+      const auto pk = permute_lanes( table, kk + dk );
+      const auto pj = permute_lanes( table, jj + dj + pk );
+      return gradient_lanes( table, ii + di + pj );
+    };
+    const auto zero = simd::broadcast( 0 );
+
+    const auto n = corner_3d( hash( zero, zero, zero ), x0, y0, z0 ) +
+                   corner_3d( hash( i1, j1, k1 ), x1, y1, z1 ) +
+                   corner_3d( hash( i2, j2, k2 ), x2, y2, z2 ) +
+                   corner_3d( hash( one, one, one ), x3, y3, z3 );
+
+    return simd::broadcast(32.0f) * n;
+  }
+
+  inline void raw_noise_2d_batch( const float* x,
+                                  const float* y,
+                                  float* out,
+                                  std::size_t n )
+    noexcept
+  {
+    simd::for_each_lanes( x, y, out, n, &raw_noise_lanes );
+  }
+
+  inline void octave_noise_2d_batch( const bit::math::octave_schedule& schedule,
+                                     const float* x,
+                                     const float* y,
+                                     float* out,
+                                     std::size_t n )
+    noexcept
+  {
+    const auto normalize = simd::broadcast(
+      static_cast<float>(1.0 / schedule.max_amplitude())
+    );
+
+    simd::for_each_lanes( x, y, out, n, [&]( simd::floats xs, simd::floats ys ) {
+      auto total = simd::broadcast(0.0f);
+
+      for( auto i = std::size_t{0}; i < schedule.octaves(); ++i ) {
+        const auto frequency = simd::broadcast(
+          static_cast<float>(schedule.frequency(i))
+        );
+        const auto amplitude = simd::broadcast(
+          static_cast<float>(schedule.amplitude(i))
+        );
+
+        total = total + raw_noise_lanes( xs * frequency, ys * frequency ) *
+                        amplitude;
+
+        if( schedule.quantum() == 0 ) continue;
+
+        // Lanes can only stop together, so every lane must be settled
+        float totals[simd::width];
+        simd::store( totals, total );
+        if( std::all_of( totals, totals + simd::width, [&]( float t ) {
+          return schedule.is_settled( i, t );
+        }) ) break;
+      }
+
+      return total * normalize;
+    });
+  }
+
+  // Double-precision builds have no lane-parallel path
+  inline void raw_noise_2d_batch( const double* x,
+                                  const double* y,
+                                  double* out,
+                                  std::size_t n )
+    noexcept
+  {
+    for( auto i = std::size_t{0}; i < n; ++i ) {
+      out[i] = bit::math::simplex::raw_noise( x[i], y[i] );
+    }
+  }
+
+  inline void octave_noise_2d_batch( const bit::math::octave_schedule& schedule,
+                                     const double* x,
+                                     const double* y,
+                                     double* out,
+                                     std::size_t n )
+    noexcept
+  {
+    for( auto i = std::size_t{0}; i < n; ++i ) {
+      out[i] = bit::math::simplex::octave_noise( schedule, x[i], y[i] );
+    }
+  }
+
+  //--------------------------------------------------------------------------
+  // Pipeline Kernels
+  //--------------------------------------------------------------------------
+
+  // The pipeline is written once over an 'Ops' policy, which provides the
+  // value type and the operations that differ between a single sample and a
+  // set of SIMD lanes
+
+  struct scalar_ops
+  {
+    using value_type = float_t;
+
+    static value_type broadcast( float_t v ) noexcept { return v; }
+    static value_type noise( value_type x, value_type y ) noexcept
+    {
+      return raw_noise_2d( classic_table{}, x, y );
+    }
+    static value_type abs( value_type v ) noexcept { return v < 0 ? -v : v; }
+    static value_type clamp01( value_type v ) noexcept
+    {
+      return std::min( std::max( v, float_t(0) ), float_t(1) );
+    }
+  };
+
+  struct lane_ops
+  {
+    using value_type = simd::floats;
+
+    static value_type broadcast( float_t v ) noexcept
+    {
+      return simd::broadcast( static_cast<float>(v) );
+    }
+    static value_type noise( value_type x, value_type y ) noexcept
+    {
+      return raw_noise_lanes( x, y );
+    }
+    static value_type abs( value_type v ) noexcept
+    {
+      return simd::abs( v );
+    }
+    static value_type clamp01( value_type v ) noexcept
+    {
+      return simd::min( simd::max( v, simd::broadcast(0.0f) ),
+                        simd::broadcast(1.0f) );
+    }
+  };
+
+  // The offset between the x and y warp samples, so that the two offsets
+  // are uncorrelated
+  constexpr float_t g_warp_offset_x = 5.2;
+  constexpr float_t g_warp_offset_y = 1.3;
+
+  // The ridged multifractal weighting, as described by Musgrave
+  constexpr float_t g_ridge_gain = 2.0;
+
+  template<typename Ops>
+  typename Ops::value_type fbm( const bit::math::octave_schedule& schedule,
+                                typename Ops::value_type x,
+                                typename Ops::value_type y )
+    noexcept
+  {
+    auto total = Ops::broadcast(0);
+
+    for( auto i = std::size_t{0}; i < schedule.octaves(); ++i ) {
+      const auto frequency = Ops::broadcast( schedule.frequency(i) );
+
+      total = total + Ops::noise( x * frequency, y * frequency ) *
+                      Ops::broadcast( schedule.amplitude(i) );
+    }
+
+    return total / Ops::broadcast( schedule.max_amplitude() );
+  }
+
+  template<typename Ops>
+  typename Ops::value_type ridged( const bit::math::octave_schedule& schedule,
+                                   typename Ops::value_type x,
+                                   typename Ops::value_type y )
+    noexcept
+  {
+    const auto one = Ops::broadcast(1);
+
+    auto total  = Ops::broadcast(0);
+    auto weight = one;
+
+    for( auto i = std::size_t{0}; i < schedule.octaves(); ++i ) {
+      const auto frequency = Ops::broadcast( schedule.frequency(i) );
+
+      // Each octave is sharpened into ridges, and weighted by the octave
+      // before it so that detail accumulates along the ridges
+      auto signal = one - Ops::abs( Ops::noise( x * frequency, y * frequency ) );
+      signal = signal * signal * weight;
+      weight = Ops::clamp01( signal * Ops::broadcast(g_ridge_gain) );
+
+      total = total + signal * Ops::broadcast( schedule.amplitude(i) );
+    }
+
+    // The sum lies within [0,1]; remap it to [-1,1] like the other fractals
+    return total / Ops::broadcast( schedule.max_amplitude() ) *
+           Ops::broadcast(2) - one;
+  }
+
+  template<typename Ops>
+  typename Ops::value_type billow( const bit::math::octave_schedule& schedule,
+                                   typename Ops::value_type x,
+                                   typename Ops::value_type y )
+    noexcept
+  {
+    const auto one = Ops::broadcast(1);
+    const auto two = Ops::broadcast(2);
+
+    auto total = Ops::broadcast(0);
+
+    for( auto i = std::size_t{0}; i < schedule.octaves(); ++i ) {
+      const auto frequency = Ops::broadcast( schedule.frequency(i) );
+      const auto n = Ops::abs( Ops::noise( x * frequency, y * frequency ) );
+
+      total = total + (n * two - one) * Ops::broadcast( schedule.amplitude(i) );
+    }
+
+    return total / Ops::broadcast( schedule.max_amplitude() );
+  }
+
+  template<typename Ops>
+  typename Ops::value_type evaluate_pipeline( const bit::math::noise_pipeline& pipeline,
+                                              typename Ops::value_type x,
+                                              typename Ops::value_type y )
+    noexcept
+  {
+    using fractal = bit::math::noise_pipeline::fractal;
+
+    const auto offset_x = Ops::broadcast( g_warp_offset_x );
+    const auto offset_y = Ops::broadcast( g_warp_offset_y );
+
+    for( auto i = std::size_t{0}; i < pipeline.warps(); ++i ) {
+      const auto& schedule = pipeline.warp_schedule(i);
+      const auto strength  = Ops::broadcast( pipeline.warp_strength(i) );
+
+      const auto dx = fbm<Ops>( schedule, x, y );
+      const auto dy = fbm<Ops>( schedule, x + offset_x, y + offset_y );
+
+      x = x + dx * strength;
+      y = y + dy * strength;
+    }
+
+    switch( pipeline.type() ) {
+    case fractal::ridged:
+      return ridged<Ops>( pipeline.schedule(), x, y );
+    case fractal::billow:
+      return billow<Ops>( pipeline.schedule(), x, y );
+    case fractal::fbm:
+      break;
+    }
+    return fbm<Ops>( pipeline.schedule(), x, y );
+  }
+
+  inline void evaluate_pipeline_batch( const bit::math::noise_pipeline& pipeline,
+                                       const float* x,
+                                       const float* y,
+                                       float* out,
+                                       std::size_t n )
+    noexcept
+  {
+    simd::for_each_lanes( x, y, out, n, [&]( simd::floats xs, simd::floats ys ) {
+      return evaluate_pipeline<lane_ops>( pipeline, xs, ys );
+    });
+  }
+
+  // Double-precision builds have no lane-parallel path
+  inline void evaluate_pipeline_batch( const bit::math::noise_pipeline& pipeline,
+                                       const double* x,
+                                       const double* y,
+                                       double* out,
+                                       std::size_t n )
+    noexcept
+  {
+    for( auto i = std::size_t{0}; i < n; ++i ) {
+      out[i] = evaluate_pipeline<scalar_ops>( pipeline, x[i], y[i] );
+    }
+  }
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Raw Noise
+//----------------------------------------------------------------------------
+
+bit::math::float_t
+  bit::math::simplex::raw_noise( float_t x, float_t y )
+  noexcept
+{
+  return raw_noise_2d( classic_table{}, x, y );
+}
+
+bit::math::float_t
+  bit::math::simplex::raw_noise( float_t x, float_t y, float_t z )
+  noexcept
+{
+  return raw_noise_3d( classic_table{}, x, y, z );
+}
+
+bit::math::float_t
+  bit::math::simplex::raw_noise( float_t x, float_t y, float_t z, float_t w )
+  noexcept
+{
+  return raw_noise_4d( classic_table{}, x, y, z, w );
+}
+
+//----------------------------------------------------------------------------
+
+void bit::math::simplex::batch_raw_noise( const float_t* x,
+                                          const float_t* y,
+                                          float_t* out,
+                                          std::size_t n )
+  noexcept
+{
+  assert( (x != nullptr && y != nullptr && out != nullptr) || n == 0 );
+
+  raw_noise_2d_batch( x, y, out, n );
+}
+
+//----------------------------------------------------------------------------
+// Octave Noises
+//----------------------------------------------------------------------------
+
+bit::math::float_t
+  bit::math::simplex::octave_noise( float_t octaves,
+                                    float_t persistence,
+                                    float_t scale,
+                                    float_t x,
+                                    float_t y )
+  noexcept
+{
+  return octave_noise_2d( classic_table{}, octaves, persistence, scale,
+                          x, y );
+}
+
+bit::math::float_t
+  bit::math::simplex::octave_noise( float_t octaves,
+                                    float_t persistence,
+                                    float_t scale,
+                                    float_t x,
+                                    float_t y,
+                                    float_t z )
+  noexcept
+{
+  return octave_noise_3d( classic_table{}, octaves, persistence, scale,
+                          x, y, z );
+}
+
+bit::math::float_t
+  bit::math::simplex::octave_noise( float_t octaves,
+                                    float_t persistence,
+                                    float_t scale,
+                                    float_t x,
+                                    float_t y,
+                                    float_t z,
+                                    float_t w )
+  noexcept
+{
+  return octave_noise_4d( classic_table{}, octaves, persistence, scale,
+                          x, y, z, w );
+}
+
+//----------------------------------------------------------------------------
+
+bit::math::float_t
+  bit::math::simplex::octave_noise( const octave_schedule& schedule,
+                                    float_t x,
+                                    float_t y )
+  noexcept
+{
+  return scheduled_noise_2d( classic_table{}, schedule, x, y );
+}
+
+bit::math::float_t
+  bit::math::simplex::octave_noise( const octave_schedule& schedule,
+                                    float_t x,
+                                    float_t y,
+                                    float_t z )
+  noexcept
+{
+  return scheduled_noise_3d( classic_table{}, schedule, x, y, z );
+}
+
+bit::math::float_t
+  bit::math::simplex::octave_noise( const octave_schedule& schedule,
+                                    float_t x,
+                                    float_t y,
+                                    float_t z,
+                                    float_t w )
+  noexcept
+{
+  return scheduled_noise_4d( classic_table{}, schedule, x, y, z, w );
+}
+
+//----------------------------------------------------------------------------
+
+void bit::math::simplex::batch_octave_noise( const octave_schedule& schedule,
+                                             const float_t* x,
+                                             const float_t* y,
+                                             float_t* out,
+                                             std::size_t n )
+  noexcept
+{
+  assert( (x != nullptr && y != nullptr && out != nullptr) || n == 0 );
+
+  octave_noise_2d_batch( schedule, x, y, out, n );
+}
+
+//----------------------------------------------------------------------------
+// Noise Gradients
+//----------------------------------------------------------------------------
+
+bit::math::float_t
+  bit::math::simplex::raw_noise_with_gradient( float_t x, float_t y,
+                                               vec2* gradient )
+  noexcept
+{
+  assert( gradient != nullptr && "gradient cannot be null" );
+
+  float_t d[2];
+  const auto result = raw_noise_2d_with_gradient( classic_table{}, x, y, d );
+  (*gradient) = vec2{ d[0], d[1] };
+  return result;
+}
+
+bit::math::float_t
+  bit::math::simplex::raw_noise_with_gradient( float_t x, float_t y, float_t z,
+                                               vec3* gradient )
+  noexcept
+{
+  assert( gradient != nullptr && "gradient cannot be null" );
+
+  float_t d[3];
+  const auto result = raw_noise_3d_with_gradient( classic_table{}, x, y, z, d );
+  (*gradient) = vec3{ d[0], d[1], d[2] };
+  return result;
+}
+
+//----------------------------------------------------------------------------
+
+bit::math::float_t
+  bit::math::simplex::octave_noise_with_gradient( float_t octaves,
+                                                  float_t persistence,
+                                                  float_t scale,
+                                                  float_t x,
+                                                  float_t y,
+                                                  vec2* gradient )
+  noexcept
+{
+  assert( gradient != nullptr && "gradient cannot be null" );
+
+  float_t d[2];
+  const auto result = octave_noise_2d_with_gradient( classic_table{},
+                                                     octaves, persistence,
+                                                     scale, x, y, d );
+  (*gradient) = vec2{ d[0], d[1] };
+  return result;
+}
+
+bit::math::float_t
+  bit::math::simplex::octave_noise_with_gradient( float_t octaves,
+                                                  float_t persistence,
+                                                  float_t scale,
+                                                  float_t x,
+                                                  float_t y,
+                                                  float_t z,
+                                                  vec3* gradient )
+  noexcept
+{
+  assert( gradient != nullptr && "gradient cannot be null" );
+
+  float_t d[3];
+  const auto result = octave_noise_3d_with_gradient( classic_table{},
+                                                     octaves, persistence,
+                                                     scale, x, y, z, d );
+  (*gradient) = vec3{ d[0], d[1], d[2] };
+  return result;
+}
+
+//----------------------------------------------------------------------------
+// Grid Fill
+//----------------------------------------------------------------------------
+
+namespace {
+
+  // The per-grid octave constants. The normalization is accumulated in the
+  // same order as octave_noise
+  struct octave_setup
+  {
+    int     count;
+    float_t persistence;
+    float_t scale;
+    float_t max_amplitude;
+  };
+
+  octave_setup make_octave_setup( float_t octaves,
+                                  float_t persistence,
+                                  float_t scale )
+    noexcept
+  {
+    auto max_amplitude = float_t(0);
+    auto amplitude     = float_t(1.0);
+    for( auto i = 0; i < int(octaves); ++i ) {
+      max_amplitude += amplitude;
+      amplitude *= persistence;
+    }
+    return { int(octaves), persistence, scale, max_amplitude };
+  }
+
+  using bit::math::vec2;
+  using bit::math::vec3;
+
+  //--------------------------------------------------------------------------
+
+  // Adds one octave of noise to the columns [begin,end) of a row, where the
+  // sample at column 'c' lies at x = origin_x + step_x * c. Each set of
+  // lanes takes consecutive columns; the tail is padded to a full set of
+  // lanes and only the columns within the row are written
+  template<typename Noise>
+  void accumulate_row_lanes( float origin_x, float step_x,
+                             std::size_t begin, std::size_t end,
+                             float frequency, float amplitude,
+                             float* row,
+                             Noise noise )
+    noexcept
+  {
+    int offsets[simd::width];
+    for( auto lane = std::size_t{0}; lane < simd::width; ++lane ) {
+      offsets[lane] = static_cast<int>( lane );
+    }
+    const auto lane_offsets = simd::load( offsets );
+
+    const auto lanes_origin    = simd::broadcast( origin_x );
+    const auto lanes_step      = simd::broadcast( step_x );
+    const auto lanes_frequency = simd::broadcast( frequency );
+    const auto lanes_amplitude = simd::broadcast( amplitude );
+
+    const auto octave_lanes = [&]( std::size_t c ) {
+      const auto columns = simd::broadcast( static_cast<int>(c) ) + lane_offsets;
+      const auto x = lanes_origin + lanes_step * simd::to_floats( columns );
+
+      return noise( x * lanes_frequency ) * lanes_amplitude;
+    };
+
+    auto c = begin;
+    for( ; c + simd::width <= end; c += simd::width ) {
+      simd::store( row + c, simd::load( row + c ) + octave_lanes( c ) );
+    }
+
+    if( c < end ) {
+      float tail[simd::width];
+      simd::store( tail, octave_lanes( c ) );
+      for( auto lane = std::size_t{0}; c + lane < end; ++lane ) {
+        row[c + lane] += tail[lane];
+      }
+    }
+  }
+
+  template<typename Table>
+  void accumulate_row_2d( const Table& table,
+                          float origin_x, float step_x,
+                          std::size_t begin, std::size_t end,
+                          float y, float frequency, float amplitude,
+                          float* row )
+    noexcept
+  {
+    const auto lanes_y = simd::broadcast( y * frequency );
+
+    accumulate_row_lanes( origin_x, step_x, begin, end, frequency, amplitude, row,
+                          [&]( simd::floats x ) {
+      return raw_noise_2d_lanes( table, x, lanes_y );
+    });
+  }
+
+  template<typename Table>
+  void accumulate_row_3d( const Table& table,
+                          float origin_x, float step_x,
+                          std::size_t begin, std::size_t end,
+                          float y, float z, float frequency, float amplitude,
+                          float* row )
+    noexcept
+  {
+    const auto lanes_y = simd::broadcast( y * frequency );
+    const auto lanes_z = simd::broadcast( z * frequency );
+
+    accumulate_row_lanes( origin_x, step_x, begin, end, frequency, amplitude, row,
+                          [&]( simd::floats x ) {
+      return raw_noise_3d_lanes( table, x, lanes_y, lanes_z );
+    });
+  }
+
+  // Double-precision builds have no lane-parallel path
+  template<typename Table>
+  void accumulate_row_2d( const Table& table,
+                          double origin_x, double step_x,
+                          std::size_t begin, std::size_t end,
+                          double y, double frequency, double amplitude,
+                          double* row )
+    noexcept
+  {
+    const auto y_frequency = y * frequency;
+
+    for( auto c = begin; c < end; ++c ) {
+      const auto x = origin_x + step_x * double(c);
+
+      row[c] += raw_noise_2d( table, x * frequency, y_frequency ) * amplitude;
+    }
+  }
+
+  template<typename Table>
+  void accumulate_row_3d( const Table& table,
+                          double origin_x, double step_x,
+                          std::size_t begin, std::size_t end,
+                          double y, double z, double frequency, double amplitude,
+                          double* row )
+    noexcept
+  {
+    const auto y_frequency = y * frequency;
+    const auto z_frequency = z * frequency;
+
+    for( auto c = begin; c < end; ++c ) {
+      const auto x = origin_x + step_x * double(c);
+
+      row[c] += raw_noise_3d( table, x * frequency, y_frequency, z_frequency ) *
+                amplitude;
+    }
+  }
+
+  //--------------------------------------------------------------------------
+
+  // Fills the columns [col_begin,col_end) of the rows [row_begin,row_end) of
+  // a grid whose rows are 'width' samples apart. Each row is accumulated one
+  // octave at a time across SIMD lanes
+  template<typename Table>
+  void fill_region_2d( const Table& table,
+                       const vec2& origin,
+                       const vec2& step,
+                       std::size_t width,
+                       std::size_t col_begin, std::size_t col_end,
+                       std::size_t row_begin, std::size_t row_end,
+                       const octave_setup& octave,
+                       float_t* out )
+    noexcept
+  {
+    for( auto r = row_begin; r < row_end; ++r ) {
+      const auto y   = origin.y() + step.y() * float_t(r);
+      const auto row = out + r * width;
+
+      for( auto c = col_begin; c < col_end; ++c ) {
+        row[c] = float_t(0.0);
+      }
+
+      auto frequency = octave.scale;
+      auto amplitude = float_t(1.0);
+
+      for( auto i = 0; i < octave.count; ++i ) {
+        accumulate_row_2d( table, origin.x(), step.x(), col_begin, col_end,
+                           y, frequency, amplitude, row );
+
+        frequency *= 2;
+        amplitude *= octave.persistence;
+      }
+
+      for( auto c = col_begin; c < col_end; ++c ) {
+        row[c] /= octave.max_amplitude;
+      }
+    }
+  }
+
+  // Fills the sub-volume [col_begin,col_end) x [row_begin,row_end) x
+  // [slice_begin,slice_end) of a width x height x depth grid
+  template<typename Table>
+  void fill_region_3d( const Table& table,
+                       const vec3& origin,
+                       const vec3& step,
+                       std::size_t width,
+                       std::size_t height,
+                       std::size_t col_begin, std::size_t col_end,
+                       std::size_t row_begin, std::size_t row_end,
+                       std::size_t slice_begin, std::size_t slice_end,
+                       const octave_setup& octave,
+                       float_t* out )
+    noexcept
+  {
+    for( auto s = slice_begin; s < slice_end; ++s ) {
+      const auto z = origin.z() + step.z() * float_t(s);
+
+      for( auto r = row_begin; r < row_end; ++r ) {
+        const auto y   = origin.y() + step.y() * float_t(r);
+        const auto row = out + (s * height + r) * width;
+
+        for( auto c = col_begin; c < col_end; ++c ) {
+          row[c] = float_t(0.0);
+        }
+
+        auto frequency = octave.scale;
+        auto amplitude = float_t(1.0);
+
+        for( auto i = 0; i < octave.count; ++i ) {
+          accumulate_row_3d( table, origin.x(), step.x(), col_begin, col_end,
+                             y, z, frequency, amplitude, row );
+
+          frequency *= 2;
+          amplitude *= octave.persistence;
+        }
+
+        for( auto c = col_begin; c < col_end; ++c ) {
+          row[c] /= octave.max_amplitude;
+        }
+      }
+    }
+  }
+
+  //--------------------------------------------------------------------------
+  // Tile Scheduling
+  //--------------------------------------------------------------------------
+
+  // Tiles are sized so that a tile of float samples (16 KiB) stays resident
+  // in L1 while all of its octaves are accumulated
+  constexpr std::size_t tile_size_2d = 64;
+  constexpr std::size_t tile_size_3d = 16;
+
+  constexpr std::size_t cache_line_size = 64;
+
+  // A contiguous range of tiles owned by one worker. Other workers steal
+  // from the same cursor once their own range is exhausted. Each cursor is
+  // aligned to its own cache line to avoid false sharing
+  struct alignas(cache_line_size) tile_range
+  {
+    std::atomic<std::size_t> next;
+    std::size_t              end;
+  };
+
+  static_assert( alignof(tile_range) == cache_line_size,
+                 "tile ranges must be cache line aligned" );
+  static_assert( sizeof(tile_range) == cache_line_size,
+                 "tile ranges must fill exactly one cache line" );
+
+  using tile_range_vector = std::vector<
+    tile_range,
+    bit::math::detail::aligned_allocator<tile_range,cache_line_size>
+  >;
+
+  // The worker threads shared by every parallel fill. Threads are started
+  // lazily, on the first fill that needs them, and persist until exit so
+  // that repeated fills do not pay for thread creation. The pool grows to
+  // the largest number of workers requested by any fill
+  class worker_pool
+  {
+  public:
+
+    using job_type = std::function<void(std::size_t)>;
+
+    static worker_pool& instance()
+    {
+      static worker_pool pool;
+      return pool;
+    }
+
+    ~worker_pool()
+    {
+      {
+        std::lock_guard<std::mutex> lock{ m_mutex };
+        m_stop = true;
+      }
+      m_wake.notify_all();
+
+      for( auto& thread : m_threads ) {
+        thread.join();
+      }
+    }
+
+    // Invokes job(w) on the pool for each worker w in [1,workers], and
+    // job(0) on the calling thread, returning once all of them return.
+    // Workers that could not be started are skipped, so 'job' must not
+    // depend on every worker running. Returns false without invoking 'job'
+    // if the pool is already running another job
+    bool try_run( std::size_t workers, const job_type& job )
+    {
+      auto running = std::unique_lock<std::mutex>{ m_run_mutex, std::try_to_lock };
+      if( !running.owns_lock() ) return false;
+
+      {
+        std::lock_guard<std::mutex> lock{ m_mutex };
+
+        while( m_threads.size() < workers ) {
+          try {
+            m_threads.emplace_back( &worker_pool::work, this,
+                                    m_threads.size() + 1, m_generation );
+          } catch( const std::system_error& ) {
+            break;
+          }
+        }
+        m_job     = &job;
+        m_active  = std::min( workers, m_threads.size() );
+        m_pending = m_active;
+        ++m_generation;
+      }
+      m_wake.notify_all();
+
+      job(0);
+
+      auto lock = std::unique_lock<std::mutex>{ m_mutex };
+      m_done.wait( lock, [&]{ return m_pending == 0; } );
+      m_job = nullptr;
+      return true;
+    }
+
+  private:
+
+    worker_pool() = default;
+
+    void work( std::size_t worker, std::uint64_t generation )
+    {
+      auto lock = std::unique_lock<std::mutex>{ m_mutex };
+
+      for(;;) {
+        m_wake.wait( lock, [&]{ return m_stop || m_generation != generation; } );
+        if( m_stop ) return;
+
+        generation = m_generation;
+        if( worker > m_active ) continue;
+
+        const auto& job = *m_job;
+        lock.unlock();
+        job( worker );
+        lock.lock();
+
+        if( --m_pending == 0 ) m_done.notify_one();
+      }
+    }
+
+    std::mutex               m_run_mutex; // held for the duration of a job
+    std::mutex               m_mutex;     // guards the members below
+    std::condition_variable  m_wake;
+    std::condition_variable  m_done;
+    std::vector<std::thread> m_threads;
+    const job_type*          m_job = nullptr;
+    std::size_t              m_active = 0;
+    std::size_t              m_pending = 0;
+    std::uint64_t            m_generation = 0;
+    bool                     m_stop = false;
+  };
+
+  // Invokes fn(tile) for every tile in [0,count) across 'threads' workers.
+  // Each tile is processed exactly once, so the result is independent of
+  // which worker processes it
+  template<typename Fn>
+  void parallel_for_tiles( std::size_t count, std::size_t threads, Fn fn )
+  {
+    if( threads == 0 ) {
+      threads = std::max( std::size_t{std::thread::hardware_concurrency()},
+                          std::size_t{1} );
+    }
+    threads = std::min( threads, count );
+
+    const auto run_serially = [&]{
+      for( auto i = std::size_t{0}; i < count; ++i ) {
+        fn(i);
+      }
+    };
+
+    if( threads <= 1 ) {
+      run_serially();
+      return;
+    }
+
+    // operator new[] in C++14 does not honour the over-alignment
+    auto ranges = tile_range_vector( threads );
+    for( auto i = std::size_t{0}; i < threads; ++i ) {
+      ranges[i].next.store( (count * i) / threads, std::memory_order_relaxed );
+      ranges[i].end = (count * (i + 1)) / threads;
+    }
+
+    const auto work = [&]( std::size_t worker ) {
+      // Drain the worker's own range first, then steal from the others.
+      // Tiles of a worker that is not running are stolen by the rest
+      for( auto k = std::size_t{0}; k < threads; ++k ) {
+        auto& range = ranges[(worker + k) % threads];
+
+        for(;;) {
+          const auto tile = range.next.fetch_add( 1, std::memory_order_relaxed );
+          if( tile >= range.end ) break;
+          fn(tile);
+        }
+      }
+    };
+
+    // A fill that finds the pool busy with a concurrent fill runs on the
+    // calling thread instead of oversubscribing the cores
+    if( !worker_pool::instance().try_run( threads - 1, work ) ) {
+      run_serially();
+    }
+  }
+
+  //--------------------------------------------------------------------------
+
+  template<typename Table>
+  void parallel_fill_region_2d( const Table& table,
+                                const vec2& origin,
+                                const vec2& step,
+                                std::size_t width,
+                                std::size_t height,
+                                const octave_setup& octave,
+                                float_t* out,
+                                std::size_t threads )
+  {
+    const auto tiles_x = (width + tile_size_2d - 1) / tile_size_2d;
+    const auto tiles_y = (height + tile_size_2d - 1) / tile_size_2d;
+
+    parallel_for_tiles( tiles_x * tiles_y, threads, [&]( std::size_t tile ) {
+      const auto col = (tile % tiles_x) * tile_size_2d;
+      const auto row = (tile / tiles_x) * tile_size_2d;
+
+      fill_region_2d( table, origin, step, width,
+                      col, std::min( col + tile_size_2d, width ),
+                      row, std::min( row + tile_size_2d, height ),
+                      octave, out );
+    });
+  }
+
+  template<typename Table>
+  void parallel_fill_region_3d( const Table& table,
+                                const vec3& origin,
+                                const vec3& step,
+                                std::size_t width,
+                                std::size_t height,
+                                std::size_t depth,
+                                const octave_setup& octave,
+                                float_t* out,
+                                std::size_t threads )
+  {
+    const auto tiles_x = (width + tile_size_3d - 1) / tile_size_3d;
+    const auto tiles_y = (height + tile_size_3d - 1) / tile_size_3d;
+    const auto tiles_z = (depth + tile_size_3d - 1) / tile_size_3d;
+
+    parallel_for_tiles( tiles_x * tiles_y * tiles_z, threads,
+                        [&]( std::size_t tile ) {
+      const auto col   = (tile % tiles_x) * tile_size_3d;
+      const auto row   = ((tile / tiles_x) % tiles_y) * tile_size_3d;
+      const auto slice = (tile / (tiles_x * tiles_y)) * tile_size_3d;
+
+      fill_region_3d( table, origin, step, width, height,
+                      col, std::min( col + tile_size_3d, width ),
+                      row, std::min( row + tile_size_3d, height ),
+                      slice, std::min( slice + tile_size_3d, depth ),
+                      octave, out );
+    });
+  }
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+
+void bit::math::simplex::fill_grid_2d( const vec2& origin,
+                                       const vec2& step,
+                                       std::size_t width,
+                                       std::size_t height,
+                                       float_t octaves,
+                                       float_t persistence,
+                                       float_t scale,
+                                       float_t* out )
+  noexcept
+{
+  assert( out != nullptr || width * height == 0 );
+
+  const auto octave = make_octave_setup( octaves, persistence, scale );
+
+  fill_region_2d( classic_table{}, origin, step, width,
+                  0, width, 0, height, octave, out );
+}
+
+//----------------------------------------------------------------------------
+
+void bit::math::simplex::fill_grid_3d( const vec3& origin,
+                                       const vec3& step,
+                                       std::size_t width,
+                                       std::size_t height,
+                                       std::size_t depth,
+                                       float_t octaves,
+                                       float_t persistence,
+                                       float_t scale,
+                                       float_t* out )
+  noexcept
+{
+  assert( out != nullptr || width * height * depth == 0 );
+
+  const auto octave = make_octave_setup( octaves, persistence, scale );
+
+  fill_region_3d( classic_table{}, origin, step, width, height,
+                  0, width, 0, height, 0, depth, octave, out );
+}
+
+//----------------------------------------------------------------------------
+// Parallel Grid Fill
+//----------------------------------------------------------------------------
+
+void bit::math::simplex::parallel_fill_grid_2d( const vec2& origin,
+                                                const vec2& step,
+                                                std::size_t width,
+                                                std::size_t height,
+                                                float_t octaves,
+                                                float_t persistence,
+                                                float_t scale,
+                                                float_t* out,
+                                                std::size_t threads )
+{
+  assert( out != nullptr || width * height == 0 );
+
+  const auto octave = make_octave_setup( octaves, persistence, scale );
+
+  parallel_fill_region_2d( classic_table{}, origin, step, width, height,
+                           octave, out, threads );
+}
+
+//----------------------------------------------------------------------------
+
+void bit::math::simplex::parallel_fill_grid_3d( const vec3& origin,
+                                                const vec3& step,
+                                                std::size_t width,
+                                                std::size_t height,
+                                                std::size_t depth,
+                                                float_t octaves,
+                                                float_t persistence,
+                                                float_t scale,
+                                                float_t* out,
+                                                std::size_t threads )
+{
+  assert( out != nullptr || width * height * depth == 0 );
+
+  const auto octave = make_octave_setup( octaves, persistence, scale );
+
+  parallel_fill_region_3d( classic_table{}, origin, step, width, height, depth,
+                           octave, out, threads );
+}
+
+//============================================================================
+// octave_schedule
+//============================================================================
+
+namespace {
+
+  // Clamps a requested number of octaves to [0, max_octaves], which is all
+  // that a schedule has room for. Negative and NaN counts have no octaves
+  inline std::size_t clamp_octaves( bit::math::float_t octaves )
+    noexcept
+  {
+    using bit::math::octave_schedule;
+
+    if( !(octaves > 0) ) return 0;
+    if( octaves >= bit::math::float_t(octave_schedule::max_octaves) ) {
+      return octave_schedule::max_octaves;
+    }
+    return static_cast<std::size_t>( octaves );
+  }
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Constructors
+//----------------------------------------------------------------------------
+
+bit::math::octave_schedule::octave_schedule( float_t octaves,
+                                             float_t persistence,
+                                             float_t scale )
+  noexcept
+  : octave_schedule{ octaves, persistence, scale, float_t(0) }
+{
+
+}
+
+bit::math::octave_schedule::octave_schedule( float_t octaves,
+                                             float_t persistence,
+                                             float_t scale,
+                                             float_t quantum )
+  noexcept
+  : m_frequencies{},
+    m_amplitudes{},
+    m_remaining{},
+    m_octaves{ clamp_octaves( octaves ) },
+    m_max_amplitude{ 0 },
+    m_quantum{ quantum }
+{
+  assert( quantum >= 0 && "quantum cannot be negative" );
+
+  // Accumulated identically to octave_noise
+  auto frequency = scale;
+  auto amplitude = float_t(1.0);
+
+  for( auto i = std::size_t{0}; i < m_octaves; ++i ) {
+    m_frequencies[i] = frequency;
+    m_amplitudes[i]  = amplitude;
+
+    m_max_amplitude += amplitude;
+    frequency *= 2;
+    amplitude *= persistence;
+  }
+
+  auto remaining = float_t(0);
+  for( auto i = m_octaves; i-- > 0; ) {
+    m_remaining[i] = remaining;
+    remaining += m_amplitudes[i];
+  }
+}
+
+//----------------------------------------------------------------------------
+// Observers
+//----------------------------------------------------------------------------
+
+bool bit::math::octave_schedule::is_settled( std::size_t octave,
+                                             float_t total )
+  const noexcept
+{
+  assert( octave < m_octaves && "octave out of range" );
+
+  if( m_quantum == 0 ) return false;
+
+  // Raw noise lies within [-1,1], so the remaining octaves can move the
+  // total by at most their summed amplitude. The slack absorbs rounding
+  // differences between this bound and the fully accumulated total
+  const auto slack = m_max_amplitude * 16 * std::numeric_limits<float_t>::epsilon();
+  const auto remaining = m_remaining[octave] + slack;
+
+  const auto lower = ((total - remaining) / m_max_amplitude + 1) / m_quantum;
+  const auto upper = ((total + remaining) / m_max_amplitude + 1) / m_quantum;
+
+  return std::floor(lower) == std::floor(upper);
+}
+
+//============================================================================
+// simplex_generator
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Constructors
+//----------------------------------------------------------------------------
+
+bit::math::simplex_generator::simplex_generator( std::uint64_t seed )
+  noexcept
+  : m_seed{seed}
+{
+  static_assert( alignof(simplex_generator) == 64,
+                 "the tables must start on a cache line" );
+  static_assert( sizeof(m_permutation) + sizeof(m_gradients) == 8 * 64,
+                 "the tables must occupy exactly 8 cache lines" );
+
+  // splitmix64 is used to expand the seed since it is well distributed even
+  // for small or sequential seeds, and is identical on every platform
+  auto state = seed;
+  const auto next = [&state]() {
+    auto z = (state += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+  };
+
+  for( auto i = 0; i < 256; ++i ) {
+    m_permutation[i] = static_cast<std::uint8_t>(i);
+  }
+
+  // Fisher-Yates shuffle
+  for( auto i = 255; i > 0; --i ) {
+    const auto j = static_cast<int>(next() % static_cast<std::uint64_t>(i + 1));
+    const auto tmp   = m_permutation[i];
+    m_permutation[i] = m_permutation[j];
+    m_permutation[j] = tmp;
+  }
+
+  for( auto i = 0; i < 256; ++i ) {
+    m_gradients[i] = static_cast<std::uint8_t>(m_permutation[i] % 12);
+  }
+}
+
+//----------------------------------------------------------------------------
+// Raw Noise
+//----------------------------------------------------------------------------
+
+bit::math::float_t
+  bit::math::simplex_generator::raw_noise( float_t x, float_t y )
+  const noexcept
+{
+  return raw_noise_2d( seeded_table{m_permutation, m_gradients}, x, y );
+}
+
+bit::math::float_t
+  bit::math::simplex_generator::raw_noise( float_t x, float_t y, float_t z )
+  const noexcept
+{
+  return raw_noise_3d( seeded_table{m_permutation, m_gradients}, x, y, z );
+}
+
+bit::math::float_t
+  bit::math::simplex_generator::raw_noise( float_t x, float_t y,
+                                           float_t z, float_t w )
+  const noexcept
+{
+  return raw_noise_4d( seeded_table{m_permutation, m_gradients}, x, y, z, w );
+}
+
+//----------------------------------------------------------------------------
+// Octave Noise
+//----------------------------------------------------------------------------
+
+bit::math::float_t
+  bit::math::simplex_generator::octave_noise( float_t octaves,
+                                              float_t persistence,
+                                              float_t scale,
+                                              float_t x,
+                                              float_t y )
+  const noexcept
+{
+  return octave_noise_2d( seeded_table{m_permutation, m_gradients},
+                          octaves, persistence, scale, x, y );
+}
+
+bit::math::float_t
+  bit::math::simplex_generator::octave_noise( float_t octaves,
+                                              float_t persistence,
+                                              float_t scale,
+                                              float_t x,
+                                              float_t y,
+                                              float_t z )
+  const noexcept
+{
+  return octave_noise_3d( seeded_table{m_permutation, m_gradients},
+                          octaves, persistence, scale, x, y, z );
+}
+
+bit::math::float_t
+  bit::math::simplex_generator::octave_noise( float_t octaves,
+                                              float_t persistence,
+                                              float_t scale,
+                                              float_t x,
+                                              float_t y,
+                                              float_t z,
+                                              float_t w )
+  const noexcept
+{
+  return octave_noise_4d( seeded_table{m_permutation, m_gradients},
+                          octaves, persistence, scale, x, y, z, w );
+}
+
+//----------------------------------------------------------------------------
+
+bit::math::float_t
+  bit::math::simplex_generator::octave_noise( const octave_schedule& schedule,
+                                              float_t x,
+                                              float_t y )
+  const noexcept
+{
+  return scheduled_noise_2d( seeded_table{m_permutation, m_gradients},
+                             schedule, x, y );
+}
+
+bit::math::float_t
+  bit::math::simplex_generator::octave_noise( const octave_schedule& schedule,
+                                              float_t x,
+                                              float_t y,
+                                              float_t z )
+  const noexcept
+{
+  return scheduled_noise_3d( seeded_table{m_permutation, m_gradients},
+                             schedule, x, y, z );
+}
+
+bit::math::float_t
+  bit::math::simplex_generator::octave_noise( const octave_schedule& schedule,
+                                              float_t x,
+                                              float_t y,
+                                              float_t z,
+                                              float_t w )
+  const noexcept
+{
+  return scheduled_noise_4d( seeded_table{m_permutation, m_gradients},
+                             schedule, x, y, z, w );
+}
+
+//----------------------------------------------------------------------------
+// Noise Gradients
+//----------------------------------------------------------------------------
+
+bit::math::float_t
+  bit::math::simplex_generator::raw_noise_with_gradient( float_t x, float_t y,
+                                                         vec2* gradient )
+  const noexcept
+{
+  assert( gradient != nullptr && "gradient cannot be null" );
+
+  float_t d[2];
+  const auto result = raw_noise_2d_with_gradient(
+    seeded_table{m_permutation, m_gradients}, x, y, d
+  );
+  (*gradient) = vec2{ d[0], d[1] };
+  return result;
+}
+
+bit::math::float_t
+  bit::math::simplex_generator::raw_noise_with_gradient( float_t x,
+                                                         float_t y,
+                                                         float_t z,
+                                                         vec3* gradient )
+  const noexcept
+{
+  assert( gradient != nullptr && "gradient cannot be null" );
+
+  float_t d[3];
+  const auto result = raw_noise_3d_with_gradient(
+    seeded_table{m_permutation, m_gradients}, x, y, z, d
+  );
+  (*gradient) = vec3{ d[0], d[1], d[2] };
+  return result;
+}
+
+//----------------------------------------------------------------------------
+
+bit::math::float_t
+  bit::math::simplex_generator::octave_noise_with_gradient( float_t octaves,
+                                                            float_t persistence,
+                                                            float_t scale,
+                                                            float_t x,
+                                                            float_t y,
+                                                            vec2* gradient )
+  const noexcept
+{
+  assert( gradient != nullptr && "gradient cannot be null" );
+
+  float_t d[2];
+  const auto result = octave_noise_2d_with_gradient(
+    seeded_table{m_permutation, m_gradients},
+    octaves, persistence, scale, x, y, d
+  );
+  (*gradient) = vec2{ d[0], d[1] };
+  return result;
+}
+
+bit::math::float_t
+  bit::math::simplex_generator::octave_noise_with_gradient( float_t octaves,
+                                                            float_t persistence,
+                                                            float_t scale,
+                                                            float_t x,
+                                                            float_t y,
+                                                            float_t z,
+                                                            vec3* gradient )
+  const noexcept
+{
+  assert( gradient != nullptr && "gradient cannot be null" );
+
+  float_t d[3];
+  const auto result = octave_noise_3d_with_gradient(
+    seeded_table{m_permutation, m_gradients},
+    octaves, persistence, scale, x, y, z, d
+  );
+  (*gradient) = vec3{ d[0], d[1], d[2] };
+  return result;
+}
+
+//----------------------------------------------------------------------------
+// Grid Fill
+//----------------------------------------------------------------------------
+
+void bit::math::simplex_generator::fill_grid_2d( const vec2& origin,
+                                                 const vec2& step,
+                                                 std::size_t width,
+                                                 std::size_t height,
+                                                 float_t octaves,
+                                                 float_t persistence,
+                                                 float_t scale,
+                                                 float_t* out )
+  const noexcept
+{
+  assert( out != nullptr || width * height == 0 );
+
+  const auto octave = make_octave_setup( octaves, persistence, scale );
+
+  fill_region_2d( seeded_table{m_permutation, m_gradients},
+                  origin, step, width, 0, width, 0, height, octave, out );
+}
+
+//----------------------------------------------------------------------------
+
+void bit::math::simplex_generator::fill_grid_3d( const vec3& origin,
+                                                 const vec3& step,
+                                                 std::size_t width,
+                                                 std::size_t height,
+                                                 std::size_t depth,
+                                                 float_t octaves,
+                                                 float_t persistence,
+                                                 float_t scale,
+                                                 float_t* out )
+  const noexcept
+{
+  assert( out != nullptr || width * height * depth == 0 );
+
+  const auto octave = make_octave_setup( octaves, persistence, scale );
+
+  fill_region_3d( seeded_table{m_permutation, m_gradients},
+                  origin, step, width, height,
+                  0, width, 0, height, 0, depth, octave, out );
+}
+
+//----------------------------------------------------------------------------
+
+void bit::math::simplex_generator::parallel_fill_grid_2d( const vec2& origin,
+                                                          const vec2& step,
+                                                          std::size_t width,
+                                                          std::size_t height,
+                                                          float_t octaves,
+                                                          float_t persistence,
+                                                          float_t scale,
+                                                          float_t* out,
+                                                          std::size_t threads )
+  const
+{
+  assert( out != nullptr || width * height == 0 );
+
+  const auto octave = make_octave_setup( octaves, persistence, scale );
+
+  parallel_fill_region_2d( seeded_table{m_permutation, m_gradients},
+                           origin, step, width, height,
+                           octave, out, threads );
+}
+
+//----------------------------------------------------------------------------
+
+void bit::math::simplex_generator::parallel_fill_grid_3d( const vec3& origin,
+                                                          const vec3& step,
+                                                          std::size_t width,
+                                                          std::size_t height,
+                                                          std::size_t depth,
+                                                          float_t octaves,
+                                                          float_t persistence,
+                                                          float_t scale,
+                                                          float_t* out,
+                                                          std::size_t threads )
+  const
+{
+  assert( out != nullptr || width * height * depth == 0 );
+
+  const auto octave = make_octave_setup( octaves, persistence, scale );
+
+  parallel_fill_region_3d( seeded_table{m_permutation, m_gradients},
+                           origin, step, width, height, depth,
+                           octave, out, threads );
+}
+
+//============================================================================
+// noise_pipeline
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Constructors
+//----------------------------------------------------------------------------
+
+bit::math::noise_pipeline::noise_pipeline( const octave_schedule& schedule,
+                                           fractal type )
+  noexcept
+  : m_schedule{ schedule },
+    m_type{ type },
+    m_warps{}
+{
+
+}
+
+//----------------------------------------------------------------------------
+// Modifiers
+//----------------------------------------------------------------------------
+
+bit::math::noise_pipeline&
+  bit::math::noise_pipeline::add_warp( const octave_schedule& schedule,
+                                       float_t strength )
+{
+  if( m_warps.size() < max_warps ) {
+    m_warps.push_back( warp_stage{ schedule, strength } );
+  }
+  return (*this);
+}
+
+//----------------------------------------------------------------------------
+// Evaluation
+//----------------------------------------------------------------------------
+
+bit::math::float_t bit::math::noise_pipeline::evaluate( float_t x, float_t y )
+  const noexcept
+{
+  return evaluate_pipeline<scalar_ops>( (*this), x, y );
+}
+
+void bit::math::noise_pipeline::evaluate( const float_t* x,
+                                          const float_t* y,
+                                          float_t* out,
+                                          std::size_t n )
+  const noexcept
+{
+  assert( (x != nullptr && y != nullptr && out != nullptr) || n == 0 );
+
+  evaluate_pipeline_batch( (*this), x, y, out, n );
 }
@@ -0,0 +1,38 @@
+#include <bit/math/transform_hierarchy.hpp>
+
+#include <algorithm> // std::fill
+
+//----------------------------------------------------------------------------
+// Public Types
+//----------------------------------------------------------------------------
+
+constexpr bit::math::transform_hierarchy::index_type
+  bit::math::transform_hierarchy::no_parent;
+
+//----------------------------------------------------------------------------
+// Update
+//----------------------------------------------------------------------------
+
+void bit::math::transform_hierarchy::update()
+  noexcept
+{
+  const auto n = size();
+
+  // Every parent precedes its children, so a parent's flag is final, and
+  // its world matrix current, by the time its children are visited
+  for( auto i = m_first_dirty; i < n; ++i ) {
+    const auto parent = m_parents[i];
+
+    if( parent != no_parent && m_dirty[parent] ) m_dirty[i] = 1;
+    if( !m_dirty[i] ) continue;
+
+    const auto local = detail::compose_trs( m_translations[i], m_rotations[i], m_scales[i] );
+
+    m_world[i] = (parent == no_parent) ? local : detail::compose_affine( m_world[parent], local );
+  }
+
+  if( m_first_dirty < n ) {
+    std::fill( m_dirty.begin() + static_cast<std::ptrdiff_t>(m_first_dirty), m_dirty.end(), 0 );
+  }
+  m_first_dirty = n;
+}
@@ -0,0 +1,167 @@
+#include <bit/math/transform_pool.hpp>
+
+#include "detail/simd.hpp"
+
+#include <algorithm> // std::min, std::any_of, std::copy_n, std::fill
+
+namespace {
+
+  using bit::math::float_t;
+  using bit::math::mat4;
+
+  namespace simd = bit::math::detail::simd;
+
+  //--------------------------------------------------------------------------
+  // Kernels
+  //--------------------------------------------------------------------------
+
+  // The component arrays of a pool, in the order of
+  // 'transform_pool::component'
+  template<typename Float>
+  struct components
+  {
+    const Float* tx; const Float* ty; const Float* tz;
+    const Float* qx; const Float* qy; const Float* qz; const Float* qw;
+    const Float* sx; const Float* sy; const Float* sz;
+  };
+
+  // Rebuilds the dirty matrices of the 'count' <= 'simd::width'
+  // transforms starting at 'first', one lane per transform. The terms follow
+  // 'quaternion::extract_rotation_matrix' and 'detail::compose_trs', so the
+  // results match transform::matrix() within rounding; the compiler may
+  // contract or reorder the scalar arithmetic differently
+  inline void rebuild_lanes( const components<float>& c,
+                             std::size_t first,
+                             std::size_t count,
+                             const unsigned char* dirty,
+                             mat4* out )
+    noexcept
+  {
+    const auto load = [&]( const float* p )
+    {
+      if( count == simd::width ) return simd::load( p + first );
+
+      // Pads a partial set of lanes with zeros
+      float tail[simd::width] = {};
+      std::copy_n( p + first, count, tail );
+      return simd::load( tail );
+    };
+
+    const auto one = simd::broadcast( 1.0f );
+    const auto two = simd::broadcast( 2.0f );
+
+    const auto x = load( c.qx );
+    const auto y = load( c.qy );
+    const auto z = load( c.qz );
+    const auto w = load( c.qw );
+    const auto sx = load( c.sx );
+    const auto sy = load( c.sy );
+    const auto sz = load( c.sz );
+
+    const auto tx  = two * x;
+    const auto ty  = two * y;
+    const auto tz  = two * z;
+    const auto twx = tx * w;
+    const auto twy = ty * w;
+    const auto twz = tz * w;
+    const auto txx = tx * x;
+    const auto txy = ty * x;
+    const auto txz = tz * x;
+    const auto tyy = ty * y;
+    const auto tyz = tz * y;
+    const auto tzz = tz * z;
+
+    // The upper 3x3 of each matrix, scaled by column
+    float m[9][simd::width];
+    simd::store( m[0], (one - (tyy + tzz)) * sx );
+    simd::store( m[1], (txy - twz) * sy );
+    simd::store( m[2], (txz + twy) * sz );
+    simd::store( m[3], (txy + twz) * sx );
+    simd::store( m[4], (one - (txx + tzz)) * sy );
+    simd::store( m[5], (tyz - twx) * sz );
+    simd::store( m[6], (txz - twy) * sx );
+    simd::store( m[7], (tyz + twx) * sy );
+    simd::store( m[8], (one - (txx + tyy)) * sz );
+
+    for( auto lane = std::size_t{0}; lane < count; ++lane ) {
+      const auto n = first + lane;
+      if( !dirty[n] ) continue;
+
+      auto& matrix = out[n];
+      for( auto r = 0; r < 3; ++r ) {
+        matrix(r,0) = m[r * 3 + 0][lane];
+        matrix(r,1) = m[r * 3 + 1][lane];
+        matrix(r,2) = m[r * 3 + 2][lane];
+      }
+      matrix(0,3) = c.tx[n];
+      matrix(1,3) = c.ty[n];
+      matrix(2,3) = c.tz[n];
+      matrix(3,0) = 0;
+      matrix(3,1) = 0;
+      matrix(3,2) = 0;
+      matrix(3,3) = 1;
+    }
+  }
+
+  inline void rebuild_dirty( const components<float>& c,
+                             std::size_t n,
+                             const unsigned char* dirty,
+                             mat4* out )
+    noexcept
+  {
+    for( auto i = std::size_t{0}; i < n; i += simd::width ) {
+      const auto count = std::min( simd::width, n - i );
+
+      if( std::any_of( dirty + i, dirty + i + count, []( unsigned char d ){ return d != 0; } ) ) {
+        rebuild_lanes( c, i, count, dirty, out );
+      }
+    }
+  }
+
+  // Rebuilds each dirty matrix on its own; this is used for double
+  // precision, which is not vectorized
+  template<typename Float>
+  void rebuild_dirty( const components<Float>& c,
+                      std::size_t n,
+                      const unsigned char* dirty,
+                      mat4* out )
+    noexcept
+  {
+    using bit::math::vec3;
+    using bit::math::quaternion;
+
+    for( auto i = std::size_t{0}; i < n; ++i ) {
+      if( !dirty[i] ) continue;
+
+      out[i] = bit::math::detail::compose_trs( vec3{ c.tx[i], c.ty[i], c.tz[i] },
+                                               quaternion{ c.qw[i], c.qx[i], c.qy[i], c.qz[i] },
+                                               vec3{ c.sx[i], c.sy[i], c.sz[i] } );
+    }
+  }
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Update
+//----------------------------------------------------------------------------
+
+void bit::math::transform_pool::update_dirty()
+  noexcept
+{
+  const auto c = components<float_t>{
+    m_components[position_x].data(),
+    m_components[position_y].data(),
+    m_components[position_z].data(),
+    m_components[rotation_x].data(),
+    m_components[rotation_y].data(),
+    m_components[rotation_z].data(),
+    m_components[rotation_w].data(),
+    m_components[scale_x].data(),
+    m_components[scale_y].data(),
+    m_components[scale_z].data(),
+  };
+
+  rebuild_dirty( c, size(), m_dirty.data(), m_matrices.data() );
+
+  std::fill( m_dirty.begin(), m_dirty.end(), 0 );
+}
@@ -6,6 +6,10 @@
  * \author Matthew Rodusek (matthew.rodusek@gmail.com)
  */
 
+// Suppress the extern template declarations so that GCC emits the
+// constexpr members used by the static constants
+#define BIT_MATH_VECTOR_INSTANTIATION 1
+
 #include <bit/math/vector.hpp>
 
 template class bit::math::vector2<bit::math::float_t>;
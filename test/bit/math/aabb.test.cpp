@@ -0,0 +1,351 @@
+/**
+ * \file aabb.test.cpp
+ *
+ * \brief Unit tests for bit::math::aabb2 and bit::math::aabb3
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+
+#include <bit/math/aabb.hpp>
+#include <bit/math/transform.hpp>
+
+#include <catch.hpp>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace {
+
+  // Boxes of varying sizes scattered around the origin, with a length that is
+  // not a multiple of any lane width
+  std::vector<bit::math::aabb3> make_boxes( std::size_t n )
+  {
+    using bit::math::float_t;
+    using bit::math::point3;
+
+    auto engine   = std::mt19937{42};
+    auto position = std::uniform_real_distribution<float_t>{ -10, 10 };
+    auto size     = std::uniform_real_distribution<float_t>{ 0, 3 };
+
+    auto result = std::vector<bit::math::aabb3>{};
+    for( auto i = std::size_t{0}; i < n; ++i ) {
+      const auto min = point3{ position(engine), position(engine), position(engine) };
+      const auto max = point3{ min.x() + size(engine), min.y() + size(engine), min.z() + size(engine) };
+
+      result.emplace_back( min, max );
+    }
+    return result;
+  }
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Constructors
+//----------------------------------------------------------------------------
+
+TEST_CASE("aabb3::aabb3()", "[ctor]")
+{
+  const auto box = bit::math::aabb3{};
+
+  SECTION("Is empty")
+  {
+    REQUIRE( box.is_empty() );
+    REQUIRE( box.volume() == 0 );
+    REQUIRE( box.surface_area() == 0 );
+  }
+
+  SECTION("Contains nothing")
+  {
+    REQUIRE_FALSE( box.contains( bit::math::point3{ 0, 0, 0 } ) );
+    REQUIRE_FALSE( box.intersects( box ) );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Observers
+//----------------------------------------------------------------------------
+
+TEST_CASE("aabb3::surface_area()", "[observers]")
+{
+  using bit::math::point3;
+
+  const auto box = bit::math::aabb3{ point3{ -1, 0, 1 }, point3{ 1, 3, 5 } };
+
+  SECTION("Returns the sum of the face areas")
+  {
+    REQUIRE( box.surface_area() == Approx(2 * (2 * 3 + 3 * 4 + 4 * 2)) );
+  }
+
+  SECTION("Returns the center and half-extents")
+  {
+    REQUIRE( box.center() == point3{ 0, 1.5, 3 } );
+    REQUIRE( box.extents().x() == 1 );
+    REQUIRE( box.extents().y() == 1.5 );
+    REQUIRE( box.extents().z() == 2 );
+    REQUIRE( box.volume() == Approx(24) );
+  }
+}
+
+TEST_CASE("aabb2::perimeter()", "[observers]")
+{
+  using bit::math::point2;
+
+  const auto box = bit::math::aabb2{ point2{ -1, 0 }, point2{ 1, 3 } };
+
+  REQUIRE( box.area() == Approx(6) );
+  REQUIRE( box.perimeter() == Approx(10) );
+}
+
+//----------------------------------------------------------------------------
+// Queries
+//----------------------------------------------------------------------------
+
+TEST_CASE("aabb3::contains( ... )", "[queries]")
+{
+  using bit::math::point3;
+  using bit::math::aabb3;
+
+  const auto box = aabb3{ point3{ 0, 0, 0 }, point3{ 2, 2, 2 } };
+
+  SECTION("Contains points inside and on the faces")
+  {
+    REQUIRE( box.contains( point3{ 1, 1, 1 } ) );
+    REQUIRE( box.contains( point3{ 2, 0, 1 } ) );
+    REQUIRE_FALSE( box.contains( point3{ 1, 3, 1 } ) );
+  }
+
+  SECTION("Contains boxes that lie entirely inside")
+  {
+    REQUIRE( box.contains( aabb3{ point3{ 0, 1, 1 }, point3{ 1, 2, 2 } } ) );
+    REQUIRE_FALSE( box.contains( aabb3{ point3{ 1, 1, 1 }, point3{ 3, 2, 2 } } ) );
+  }
+}
+
+TEST_CASE("aabb3::intersects( const aabb3& )", "[queries]")
+{
+  using bit::math::point3;
+  using bit::math::aabb3;
+
+  const auto box = aabb3{ point3{ 0, 0, 0 }, point3{ 2, 2, 2 } };
+
+  SECTION("Intersects overlapping and touching boxes")
+  {
+    REQUIRE( box.intersects( aabb3{ point3{ 1, 1, 1 }, point3{ 3, 3, 3 } } ) );
+    REQUIRE( box.intersects( aabb3{ point3{ 2, 2, 2 }, point3{ 3, 3, 3 } } ) );
+  }
+
+  SECTION("Does not intersect boxes separated along one axis")
+  {
+    REQUIRE_FALSE( box.intersects( aabb3{ point3{ 1, 1, 3 }, point3{ 2, 2, 4 } } ) );
+    REQUIRE_FALSE( intersects( box, aabb3{ point3{ -2, 1, 1 }, point3{ -1, 2, 2 } } ) );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Modifiers
+//----------------------------------------------------------------------------
+
+TEST_CASE("aabb3::merge( ... )", "[modifiers]")
+{
+  using bit::math::point3;
+  using bit::math::aabb3;
+
+  SECTION("Merging into an empty box yields the merged bounds")
+  {
+    auto box = aabb3{};
+    box.merge( point3{ 1, 2, 3 } );
+
+    REQUIRE( box == aabb3( point3{ 1, 2, 3 }, point3{ 1, 2, 3 } ) );
+  }
+
+  SECTION("Encloses both boxes")
+  {
+    const auto a = aabb3{ point3{ 0, 0, 0 }, point3{ 1, 1, 1 } };
+    const auto b = aabb3{ point3{ -1, 2, 0 }, point3{ 0, 3, 1 } };
+
+    REQUIRE( merge( a, b ) == aabb3( point3{ -1, 0, 0 }, point3{ 1, 3, 1 } ) );
+  }
+}
+
+TEST_CASE("aabb3::expand( ... )", "[modifiers]")
+{
+  using bit::math::point3;
+  using bit::math::aabb3;
+
+  SECTION("Moves each face outwards")
+  {
+    auto box = aabb3{ point3{ 0, 0, 0 }, point3{ 1, 1, 1 } };
+    box.expand( 0.5 );
+
+    REQUIRE( box == aabb3( point3{ -0.5, -0.5, -0.5 }, point3{ 1.5, 1.5, 1.5 } ) );
+  }
+
+  SECTION("Leaves an empty box empty")
+  {
+    auto box = aabb3{};
+    box.expand( 1 );
+
+    REQUIRE( box.is_empty() );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Transformation
+//----------------------------------------------------------------------------
+
+TEST_CASE("transform_bounds( const aabb3&, const mat4& )", "[transformation]")
+{
+  using bit::math::point3;
+  using bit::math::vec3;
+  using bit::math::vec4;
+  using bit::math::aabb3;
+
+  const auto box = aabb3{ point3{ -1, 0, 2 }, point3{ 1, 3, 5 } };
+
+  SECTION("Translates and scales exactly")
+  {
+    const auto matrix = bit::math::detail::compose_trs( vec3{ 1, 2, 3 },
+                                                        bit::math::quaternion{},
+                                                        vec3{ 2, 1, -1 } );
+    const auto result = transform_bounds( box, matrix );
+
+    REQUIRE( almost_equal( result.min(), point3{ -1, 2, -2 } ) );
+    REQUIRE( almost_equal( result.max(), point3{ 3, 5, 1 } ) );
+  }
+
+  SECTION("Matches the bounds of the transformed corners")
+  {
+    const auto rotation = bit::math::quaternion( 0.9238795325, 0, 0.3826834324, 0 );
+    const auto matrix = bit::math::detail::compose_trs( vec3{ 1, 2, 3 }, rotation, vec3{ 1, 2, 1 } );
+    const auto result = transform_bounds( box, matrix );
+
+    auto expected = aabb3{};
+    for( auto corner = 0; corner < 8; ++corner ) {
+      const auto p = vec4{ (corner & 1) ? box.max().x() : box.min().x(),
+                           (corner & 2) ? box.max().y() : box.min().y(),
+                           (corner & 4) ? box.max().z() : box.min().z(),
+                           1 } * matrix;
+      expected.merge( point3{ p.x(), p.y(), p.z() } );
+    }
+
+    REQUIRE( almost_equal( result.min(), expected.min(), 1e-4 ) );
+    REQUIRE( almost_equal( result.max(), expected.max(), 1e-4 ) );
+  }
+
+  SECTION("Leaves an empty box empty")
+  {
+    REQUIRE( transform_bounds( aabb3{}, bit::math::mat4::identity ).is_empty() );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Batch Operations
+//----------------------------------------------------------------------------
+
+TEST_CASE("bounds_of( const point3*, std::size_t )", "[batch]")
+{
+  using bit::math::point3;
+
+  auto points = std::vector<point3>{};
+  for( auto i = 0; i < 37; ++i ) {
+    points.emplace_back( bit::math::float_t(i % 7) - 3, bit::math::float_t(i % 5) * 2, bit::math::float_t(i) );
+  }
+
+  SECTION("Matches merging each point individually")
+  {
+    for( auto n = std::size_t{0}; n <= points.size(); ++n ) {
+      auto expected = bit::math::aabb3{};
+      for( auto i = std::size_t{0}; i < n; ++i ) {
+        expected.merge( points[i] );
+      }
+
+      REQUIRE( bit::math::bounds_of( points.data(), n ) == expected );
+    }
+  }
+
+  SECTION("Bounds 2d points")
+  {
+    const bit::math::point2 points2[] = { { 1, -2 }, { -3, 4 }, { 0, 0 } };
+
+    REQUIRE( bit::math::bounds_of( points2, 3 ) ==
+             bit::math::aabb2( bit::math::point2{ -3, -2 }, bit::math::point2{ 1, 4 } ) );
+  }
+}
+
+TEST_CASE("intersects( const aabb3*, const aabb3&, bool*, std::size_t )", "[batch]")
+{
+  using bit::math::point3;
+
+  const auto boxes = make_boxes( 301 );
+  const auto query = bit::math::aabb3{ point3{ -2, -3, -4 }, point3{ 4, 3, 2 } };
+
+  SECTION("Matches testing each box individually")
+  {
+    auto result = std::unique_ptr<bool[]>( new bool[boxes.size()] );
+    bit::math::intersects( boxes.data(), query, result.get(), boxes.size() );
+
+    auto hits = 0;
+    for( auto i = std::size_t{0}; i < boxes.size(); ++i ) {
+      REQUIRE( result[i] == boxes[i].intersects( query ) );
+      hits += result[i];
+    }
+    REQUIRE( hits > 0 );
+  }
+}
+
+TEST_CASE("transform_bounds( const aabb3*, const mat4&, aabb3*, std::size_t )", "[batch]")
+{
+  using bit::math::vec3;
+
+  auto boxes = make_boxes( 301 );
+  boxes[5] = bit::math::aabb3{};
+
+  const auto rotation = bit::math::quaternion( 0.9238795325, 0.3826834324, 0, 0 );
+  const auto matrix = bit::math::detail::compose_trs( vec3{ 1, -2, 3 }, rotation, vec3{ 2, 1, 3 } );
+
+  auto out = std::vector<bit::math::aabb3>( boxes.size() );
+
+  SECTION("Matches transforming each box individually")
+  {
+    bit::math::transform_bounds( boxes.data(), matrix, out.data(), boxes.size() );
+
+    for( auto i = std::size_t{0}; i < boxes.size(); ++i ) {
+      const auto expected = transform_bounds( boxes[i], matrix );
+
+      REQUIRE( out[i].is_empty() == expected.is_empty() );
+      if( !expected.is_empty() ) {
+        REQUIRE( almost_equal( out[i].min(), expected.min() ) );
+        REQUIRE( almost_equal( out[i].max(), expected.max() ) );
+      }
+    }
+  }
+
+  SECTION("Transforms in place")
+  {
+    bit::math::transform_bounds( boxes.data(), matrix, out.data(), boxes.size() );
+    bit::math::transform_bounds( boxes.data(), matrix, boxes.data(), boxes.size() );
+
+    REQUIRE( boxes == out );
+  }
+}
+
+TEST_CASE("transform_bounds( const aabb2*, const mat3&, aabb2*, std::size_t )", "[batch]")
+{
+  using bit::math::point2;
+  using bit::math::aabb2;
+
+  // A rotation by 90 degrees, then a translation by (1,2)
+  const auto matrix = bit::math::mat3{ 0, -1, 1,
+                                       1,  0, 2,
+                                       0,  0, 1 };
+
+  auto boxes = std::vector<aabb2>( 11, aabb2{ point2{ 0, 0 }, point2{ 2, 1 } } );
+  auto out = std::vector<aabb2>( boxes.size() );
+
+  bit::math::transform_bounds( boxes.data(), matrix, out.data(), boxes.size() );
+
+  for( const auto& box : out ) {
+    REQUIRE( box == aabb2( point2{ 0, 2 }, point2{ 1, 4 } ) );
+  }
+}
@@ -0,0 +1,346 @@
+/**
+ * \file cellular.test.cpp
+ *
+ * \brief Unit tests for bit::math::cellular
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+
+#include <bit/math/cellular.hpp>
+
+#include "bit/math/detail/noise_tables.hpp"
+
+#include <catch.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+  // Tolerance used when comparing against the double-precision reference
+  // implementation
+  constexpr double reference_tolerance = 1e-4;
+
+  using bit::math::cellular::distance;
+  using bit::math::cellular::feature;
+
+  using bit::math::detail::g_permutation_table;
+
+  // The nearest two distances found by brute force over every cell within
+  // 'reach' cells of the sample, which is further than a feature point can
+  // ever need to be searched for
+  struct nearest_distances
+  {
+    double f1;
+    double f2;
+  };
+
+  constexpr int reach = 4;
+
+  inline double feature_offset( int hash, int table_offset )
+  {
+    return (g_permutation_table[hash + table_offset] + 0.5) / 256.0;
+  }
+
+  inline double measure( distance metric, double dx, double dy, double dz )
+  {
+    dx = std::abs(dx);
+    dy = std::abs(dy);
+    dz = std::abs(dz);
+
+    switch( metric ) {
+    case distance::manhattan:
+      return dx + dy + dz;
+    case distance::chebyshev:
+      return std::max( std::max( dx, dy ), dz );
+    case distance::euclidean:
+      break;
+    }
+    return std::sqrt( dx*dx + dy*dy + dz*dz );
+  }
+
+  inline void keep_nearest( nearest_distances& result, double d )
+  {
+    result.f2 = std::min( std::max( result.f1, d ), result.f2 );
+    result.f1 = std::min( result.f1, d );
+  }
+
+  nearest_distances brute_force( double x, double y, distance metric )
+  {
+    const auto i = static_cast<int>( std::floor(x) );
+    const auto j = static_cast<int>( std::floor(y) );
+
+    auto result = nearest_distances{ HUGE_VAL, HUGE_VAL };
+    for( auto cj = j - reach; cj <= j + reach; ++cj ) {
+      for( auto ci = i - reach; ci <= i + reach; ++ci ) {
+        const auto h = g_permutation_table[(ci & 255) + g_permutation_table[cj & 255]];
+
+        const auto dx = (ci + feature_offset( h, 0 )) - x;
+        const auto dy = (cj + feature_offset( h, 128 )) - y;
+        keep_nearest( result, measure( metric, dx, dy, 0.0 ) );
+      }
+    }
+    return result;
+  }
+
+  nearest_distances brute_force( double x, double y, double z, distance metric )
+  {
+    const auto i = static_cast<int>( std::floor(x) );
+    const auto j = static_cast<int>( std::floor(y) );
+    const auto k = static_cast<int>( std::floor(z) );
+
+    auto result = nearest_distances{ HUGE_VAL, HUGE_VAL };
+    for( auto ck = k - reach; ck <= k + reach; ++ck ) {
+      const auto pk = g_permutation_table[ck & 255];
+
+      for( auto cj = j - reach; cj <= j + reach; ++cj ) {
+        const auto pj = g_permutation_table[(cj & 255) + pk];
+
+        for( auto ci = i - reach; ci <= i + reach; ++ci ) {
+          const auto h = g_permutation_table[(ci & 255) + pj];
+
+          const auto dx = (ci + feature_offset( h, 0 )) - x;
+          const auto dy = (cj + feature_offset( h, 128 )) - y;
+          const auto dz = (ck + feature_offset( h, 64 )) - z;
+          keep_nearest( result, measure( metric, dx, dy, dz ) );
+        }
+      }
+    }
+    return result;
+  }
+
+  // The brute-force tolerance covers the single-precision arithmetic of the
+  // noise away from the origin
+  constexpr double brute_force_tolerance = 1e-4;
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Raw Noise
+//----------------------------------------------------------------------------
+
+TEST_CASE("cellular::raw_noise( float_t, float_t, distance, feature )", "[raw_noise]")
+{
+  using bit::math::cellular::raw_noise;
+
+  SECTION("Matches euclidean reference values")
+  {
+    REQUIRE( raw_noise(0.3, 0.7) == Approx(0.1901417).margin(reference_tolerance) );
+    REQUIRE( raw_noise(0.3, 0.7, distance::euclidean, feature::f2) == Approx(0.8288744).margin(reference_tolerance) );
+    REQUIRE( raw_noise(-7.25, -1.5, distance::euclidean, feature::f2_minus_f1) == Approx(0.0808883).margin(reference_tolerance) );
+    REQUIRE( raw_noise(88.8, -50.4) == Approx(0.3049403).margin(reference_tolerance) );
+  }
+
+  SECTION("Matches manhattan reference values")
+  {
+    REQUIRE( raw_noise(1.5, -2.25, distance::manhattan) == Approx(0.2773438).margin(reference_tolerance) );
+    REQUIRE( raw_noise(1.5, -2.25, distance::manhattan, feature::f2) == Approx(0.6601562).margin(reference_tolerance) );
+    REQUIRE( raw_noise(-7.25, -1.5, distance::manhattan, feature::f2_minus_f1) == Approx(0.0234375).margin(reference_tolerance) );
+  }
+
+  SECTION("Matches chebyshev reference values")
+  {
+    REQUIRE( raw_noise(88.8, -50.4, distance::chebyshev) == Approx(0.2160156).margin(reference_tolerance) );
+    REQUIRE( raw_noise(88.8, -50.4, distance::chebyshev, feature::f2) == Approx(0.5808594).margin(reference_tolerance) );
+    REQUIRE( raw_noise(0.3, 0.7, distance::chebyshev, feature::f2_minus_f1) == Approx(0.6523438).margin(reference_tolerance) );
+  }
+
+  SECTION("Orders the metrics as chebyshev <= euclidean <= manhattan")
+  {
+    for( auto i = 0; i < 1024; ++i ) {
+      const auto x = i * 0.137;
+      const auto y = i * -0.071;
+
+      REQUIRE( raw_noise(x, y, distance::chebyshev) <= raw_noise(x, y, distance::euclidean) + 1e-6 );
+      REQUIRE( raw_noise(x, y, distance::euclidean) <= raw_noise(x, y, distance::manhattan) + 1e-6 );
+    }
+  }
+
+  SECTION("F1 never exceeds F2")
+  {
+    for( auto i = 0; i < 1024; ++i ) {
+      const auto x = i * 0.137;
+      const auto y = i * -0.071;
+
+      REQUIRE( raw_noise(x, y, distance::euclidean, feature::f1) <=
+               raw_noise(x, y, distance::euclidean, feature::f2) );
+      REQUIRE( raw_noise(x, y, distance::euclidean, feature::f2_minus_f1) >= 0 );
+    }
+  }
+}
+
+TEST_CASE("cellular::raw_noise( float_t, float_t, float_t, distance, feature )", "[raw_noise]")
+{
+  using bit::math::cellular::raw_noise;
+
+  SECTION("Matches reference values")
+  {
+    REQUIRE( raw_noise(0.3, 0.7, 0.1) == Approx(0.6062796).margin(reference_tolerance) );
+    REQUIRE( raw_noise(0.3, 0.7, 0.1, distance::euclidean, feature::f2) == Approx(0.6120059).margin(reference_tolerance) );
+    REQUIRE( raw_noise(-3.1, 4.2, -0.6, distance::manhattan) == Approx(0.9652344).margin(reference_tolerance) );
+    REQUIRE( raw_noise(-3.1, 4.2, -0.6, distance::manhattan, feature::f2_minus_f1) == Approx(0.2554688).margin(reference_tolerance) );
+    REQUIRE( raw_noise(-3.1, 4.2, -0.6, distance::chebyshev, feature::f2) == Approx(0.7222656).margin(reference_tolerance) );
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("cellular::batch_raw_noise( const float_t*, const float_t*, float_t*, std::size_t, distance, feature )", "[raw_noise][batch]")
+{
+  using bit::math::float_t;
+
+  // Not a multiple of any lane width, to exercise the tail
+  const auto n = std::size_t{1027};
+
+  auto xs  = std::vector<float_t>(n);
+  auto ys  = std::vector<float_t>(n);
+  auto out = std::vector<float_t>(n);
+
+  for( auto i = std::size_t{0}; i < n; ++i ) {
+    xs[i] = float_t(i) * float_t(0.173) - float_t(40.0);
+    ys[i] = float_t(i) * float_t(-0.091) + float_t(12.5);
+  }
+
+  for( auto metric : { distance::euclidean, distance::manhattan, distance::chebyshev } ) {
+    for( auto type : { feature::f1, feature::f2, feature::f2_minus_f1 } ) {
+      SECTION("Matches the scalar implementation for metric " +
+              std::to_string(static_cast<int>(metric)) + " and feature " +
+              std::to_string(static_cast<int>(type)))
+      {
+        bit::math::cellular::batch_raw_noise( xs.data(), ys.data(),
+                                              out.data(), n, metric, type );
+
+        for( auto i = std::size_t{0}; i < n; ++i ) {
+          REQUIRE( out[i] == Approx(bit::math::cellular::raw_noise(xs[i], ys[i], metric, type)).margin(1e-5) );
+        }
+      }
+    }
+  }
+}
+
+TEST_CASE("cellular::raw_noise matches a brute-force search of the feature points", "[raw_noise]")
+{
+  using bit::math::float_t;
+  using bit::math::cellular::raw_noise;
+
+  auto engine   = std::mt19937{7};
+  auto position = std::uniform_real_distribution<float_t>{ -300, 300 };
+
+  for( auto metric : { distance::euclidean, distance::manhattan, distance::chebyshev } ) {
+    SECTION("2D with metric " + std::to_string(static_cast<int>(metric)))
+    {
+      for( auto i = 0; i < 20000; ++i ) {
+        const auto x = position(engine);
+        const auto y = position(engine);
+        const auto expected = brute_force( x, y, metric );
+
+        REQUIRE( raw_noise(x, y, metric, feature::f1) == Approx(expected.f1).margin(brute_force_tolerance) );
+        REQUIRE( raw_noise(x, y, metric, feature::f2) == Approx(expected.f2).margin(brute_force_tolerance) );
+      }
+    }
+
+    SECTION("3D with metric " + std::to_string(static_cast<int>(metric)))
+    {
+      for( auto i = 0; i < 5000; ++i ) {
+        const auto x = position(engine);
+        const auto y = position(engine);
+        const auto z = position(engine);
+        const auto expected = brute_force( x, y, z, metric );
+
+        REQUIRE( raw_noise(x, y, z, metric, feature::f1) == Approx(expected.f1).margin(brute_force_tolerance) );
+        REQUIRE( raw_noise(x, y, z, metric, feature::f2) == Approx(expected.f2).margin(brute_force_tolerance) );
+      }
+    }
+
+    SECTION("Batch with metric " + std::to_string(static_cast<int>(metric)))
+    {
+      const auto n = std::size_t{20000};
+
+      auto xs = std::vector<float_t>(n);
+      auto ys = std::vector<float_t>(n);
+      auto f1 = std::vector<float_t>(n);
+      auto f2 = std::vector<float_t>(n);
+      for( auto i = std::size_t{0}; i < n; ++i ) {
+        xs[i] = position(engine);
+        ys[i] = position(engine);
+      }
+
+      bit::math::cellular::batch_raw_noise( xs.data(), ys.data(), f1.data(), n, metric, feature::f1 );
+      bit::math::cellular::batch_raw_noise( xs.data(), ys.data(), f2.data(), n, metric, feature::f2 );
+
+      for( auto i = std::size_t{0}; i < n; ++i ) {
+        const auto expected = brute_force( xs[i], ys[i], metric );
+
+        REQUIRE( f1[i] == Approx(expected.f1).margin(brute_force_tolerance) );
+        REQUIRE( f2[i] == Approx(expected.f2).margin(brute_force_tolerance) );
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// Grid Fill
+//----------------------------------------------------------------------------
+
+TEST_CASE("cellular::fill_grid_2d( const vec2&, const vec2&, std::size_t, std::size_t, distance, feature, float_t* )", "[fill_grid]")
+{
+  using bit::math::float_t;
+
+  const auto origin = bit::math::vec2{ -3.25, 1.5 };
+  const auto step   = bit::math::vec2{ 0.125, 0.25 };
+  const auto width  = std::size_t{300};
+  const auto height = std::size_t{5};
+
+  auto grid = std::vector<float_t>(width * height);
+
+  bit::math::cellular::fill_grid_2d( origin, step, width, height,
+                                     distance::manhattan, feature::f2_minus_f1,
+                                     grid.data() );
+
+  SECTION("Each sample matches raw_noise")
+  {
+    for( auto r = std::size_t{0}; r < height; ++r ) {
+      for( auto c = std::size_t{0}; c < width; ++c ) {
+        const auto x = origin.x() + step.x() * float_t(c);
+        const auto y = origin.y() + step.y() * float_t(r);
+
+        REQUIRE( grid[r * width + c] ==
+                 Approx(bit::math::cellular::raw_noise( x, y, distance::manhattan, feature::f2_minus_f1 )).margin(1e-5) );
+      }
+    }
+  }
+}
+
+TEST_CASE("cellular::fill_grid_3d( const vec3&, const vec3&, std::size_t, std::size_t, std::size_t, distance, feature, float_t* )", "[fill_grid]")
+{
+  using bit::math::float_t;
+
+  const auto origin = bit::math::vec3{ -3.25, 1.5, 0.75 };
+  const auto step   = bit::math::vec3{ 0.125, 0.25, 0.5 };
+  const auto width  = std::size_t{9};
+  const auto height = std::size_t{7};
+  const auto depth  = std::size_t{5};
+
+  auto grid = std::vector<float_t>(width * height * depth);
+
+  bit::math::cellular::fill_grid_3d( origin, step, width, height, depth,
+                                     distance::euclidean, feature::f1,
+                                     grid.data() );
+
+  SECTION("Each sample matches raw_noise")
+  {
+    for( auto s = std::size_t{0}; s < depth; ++s ) {
+      for( auto r = std::size_t{0}; r < height; ++r ) {
+        for( auto c = std::size_t{0}; c < width; ++c ) {
+          const auto x = origin.x() + step.x() * float_t(c);
+          const auto y = origin.y() + step.y() * float_t(r);
+          const auto z = origin.z() + step.z() * float_t(s);
+
+          REQUIRE( grid[(s * height + r) * width + c] ==
+                   bit::math::cellular::raw_noise( x, y, z ) );
+        }
+      }
+    }
+  }
+}
@@ -9,6 +9,9 @@
 
 #include <catch.hpp>
 
+#include <ratio>
+#include <vector>
+
 //----------------------------------------------------------------------------
 // Constructors
 //----------------------------------------------------------------------------
@@ -99,3 +102,155 @@ TEST_CASE("clamped::operator*=( const clamped& )", "[operators]")
 {
 
 }
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("operator-( T&&, const clamped<U,Lo,Hi>& )", "[operators]")
+{
+  const auto rhs = bit::math::normalized<float>(0.25f);
+
+  SECTION("Subtracts the clamped value from the scalar")
+  {
+    const auto result = 0.75f - rhs;
+
+    REQUIRE( static_cast<float>(result) == 0.5f );
+  }
+
+  SECTION("Clamps the difference, not the scalar")
+  {
+    const auto result = 1.5f - rhs;
+
+    REQUIRE( static_cast<float>(result) == 1.0f );
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("operator/( T&&, const clamped<U,Lo,Hi>& )", "[operators]")
+{
+  const auto rhs = bit::math::normalized<float>(0.5f);
+
+  SECTION("Divides the scalar by the clamped value")
+  {
+    const auto result = 0.25f / rhs;
+
+    REQUIRE( static_cast<float>(result) == 0.5f );
+  }
+
+  SECTION("Clamps the quotient, not the scalar")
+  {
+    const float lhs = 0.75f;
+    const auto result = lhs / rhs;
+
+    REQUIRE( static_cast<float>(result) == 1.0f );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Compile-time Bounds
+//----------------------------------------------------------------------------
+
+TEST_CASE("clamped<T,Lo,Hi>", "[bounds]")
+{
+  using quarter_to_three = bit::math::clamped<float,std::ratio<1,4>,std::ratio<3>>;
+
+  static_assert( sizeof(quarter_to_three) == sizeof(float), "" );
+  static_assert( quarter_to_three::min_value() == 0.25f, "" );
+  static_assert( quarter_to_three::max_value() == 3.0f, "" );
+  static_assert( static_cast<float>(quarter_to_three(5.0f)) == 3.0f, "" );
+
+  SECTION("Clamps values to the bounds")
+  {
+    REQUIRE( quarter_to_three(0.0f) == quarter_to_three(0.25f) );
+    REQUIRE( quarter_to_three(4.0f) == quarter_to_three(3.0f) );
+    REQUIRE( static_cast<float>(quarter_to_three(1.5f)) == 1.5f );
+  }
+
+  SECTION("Clamps values converted from other bounds")
+  {
+    const auto a = bit::math::signed_normalized<float>(-0.5f);
+    const auto b = bit::math::normalized<float>(a);
+
+    REQUIRE( static_cast<float>(b) == 0.0f );
+  }
+
+  SECTION("Evaluates arithmetic at compile time")
+  {
+    constexpr auto a = bit::math::normalized<float>(0.5f);
+    constexpr auto b = bit::math::normalized<float>(0.75f);
+    constexpr auto c = a + b;
+    constexpr auto d = a * b;
+
+    static_assert( static_cast<float>(c) == 1.0f, "" );
+    static_assert( static_cast<float>(d) == 0.375f, "" );
+  }
+
+  SECTION("Clamps products that can leave the bounds")
+  {
+    auto a = bit::math::signed_normalized<float>(-1.0f);
+    const auto b = bit::math::signed_normalized<float>(-1.0f);
+
+    a *= b;
+
+    REQUIRE( static_cast<float>(a) == 1.0f );
+
+    auto c = quarter_to_three(2.0f);
+    c *= quarter_to_three(2.0f);
+
+    REQUIRE( static_cast<float>(c) == 3.0f );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Batch Operations
+//----------------------------------------------------------------------------
+
+TEST_CASE("clamp( const T*, clamped<T,Lo,Hi>*, std::size_t )", "[batch]")
+{
+  const float values[] = { -2.0f, -0.5f, 0.0f, 0.5f, 2.0f };
+  auto out = std::vector<bit::math::signed_normalized<float>>( 5, 0.0f );
+
+  bit::math::clamp( values, out.data(), 5 );
+
+  SECTION("Clamps each value to the bounds")
+  {
+    REQUIRE( static_cast<float>(out[0]) == -1.0f );
+    REQUIRE( static_cast<float>(out[1]) == -0.5f );
+    REQUIRE( static_cast<float>(out[2]) == 0.0f );
+    REQUIRE( static_cast<float>(out[3]) == 0.5f );
+    REQUIRE( static_cast<float>(out[4]) == 1.0f );
+  }
+}
+
+TEST_CASE("saturating_add( clamped<T,Lo,Hi>*, const T*, std::size_t )", "[batch]")
+{
+  const float deltas[] = { -1.0f, 0.25f, 1.0f };
+  auto values = std::vector<bit::math::normalized<float>>( 3, 0.5f );
+
+  bit::math::saturating_add( values.data(), deltas, 3 );
+
+  SECTION("Saturates each sum at the bounds")
+  {
+    REQUIRE( static_cast<float>(values[0]) == 0.0f );
+    REQUIRE( static_cast<float>(values[1]) == 0.75f );
+    REQUIRE( static_cast<float>(values[2]) == 1.0f );
+  }
+}
+
+TEST_CASE("saturating_multiply( clamped<T,Lo,Hi>*, const clamped<T,Lo,Hi>*, std::size_t )", "[batch]")
+{
+  auto values = std::vector<bit::math::normalized<float>>( 4, 0.5f );
+  const auto weights = std::vector<bit::math::normalized<float>>{
+    0.0f, 0.25f, 0.5f, 1.0f
+  };
+
+  bit::math::saturating_multiply( values.data(), weights.data(), 4 );
+
+  SECTION("Scales each value by its weight")
+  {
+    REQUIRE( static_cast<float>(values[0]) == 0.0f );
+    REQUIRE( static_cast<float>(values[1]) == 0.125f );
+    REQUIRE( static_cast<float>(values[2]) == 0.25f );
+    REQUIRE( static_cast<float>(values[3]) == 0.5f );
+  }
+}
@@ -0,0 +1,147 @@
+/**
+ * \file easing_table.test.cpp
+ *
+ * \brief Unit tests for bit::math::easing_table
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+
+#include <bit/math/easing_table.hpp>
+
+#include <catch.hpp>
+
+#include <cmath>
+
+namespace {
+
+  // Checks that 'table' is within its documented error bound of 'expected'
+  // at many positions between its samples
+  template<std::size_t N, typename Fn>
+  void require_within_bound( const bit::math::easing_table<N>& table,
+                             bit::math::float_t bound,
+                             Fn expected )
+  {
+    using bit::math::float_t;
+
+    // Allow for the rounding of the samples and the lookup
+    const auto tolerance = bound + float_t(1e-6);
+
+    for( auto i = 0; i <= 4000; ++i ) {
+      const auto t = float_t(i) / float_t(4000);
+
+      REQUIRE( std::abs(table(t) - expected(t)) <= tolerance );
+    }
+  }
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Generation
+//----------------------------------------------------------------------------
+
+TEST_CASE("make_easing_table<N>( Curve )", "[easing]")
+{
+  using bit::math::float_t;
+
+  SECTION("Generates the table at compile time")
+  {
+    constexpr auto table = bit::math::make_easing_table<5>( bit::math::quadratic_curve{} );
+
+    static_assert( table.size() == 5, "" );
+    static_assert( table[0] == 0, "" );
+    static_assert( table[2] == float_t(0.25), "" );
+    static_assert( table[4] == 1, "" );
+  }
+
+  SECTION("Samples transcendental curves at compile time")
+  {
+    constexpr auto table = bit::math::make_easing_table<3>( bit::math::cosine_curve{} );
+
+    REQUIRE( table[0] == Approx(0).margin(1e-6) );
+    REQUIRE( table[1] == Approx(1) );
+    REQUIRE( table[2] == Approx(2) );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Evaluation
+//----------------------------------------------------------------------------
+
+TEST_CASE("easing_table<N>::operator()( float_t )", "[easing]")
+{
+  using bit::math::float_t;
+
+  constexpr auto table = bit::math::make_easing_table<256>( bit::math::cubic_curve{} );
+
+  SECTION("Returns the end points exactly")
+  {
+    REQUIRE( table(0) == 0 );
+    REQUIRE( table(1) == 1 );
+  }
+
+  SECTION("Clamps positions outside of [0,1]")
+  {
+    REQUIRE( table(-1) == 0 );
+    REQUIRE( table(2) == 1 );
+  }
+
+  SECTION("Interpolates between the samples")
+  {
+    constexpr auto h = float_t(1) / 255;
+
+    REQUIRE( table(h * float_t(10.5)) == Approx((table[10] + table[11]) / 2) );
+  }
+}
+
+TEST_CASE("easing_table<N>::error_bound( float_t )", "[easing]")
+{
+  using bit::math::float_t;
+
+  SECTION("Bounds the error of polynomial curves")
+  {
+    constexpr auto table = bit::math::make_easing_table<64>( bit::math::quintic_curve{} );
+    const auto bound = table.error_bound( bit::math::quintic_curve::max_second_derivative() );
+
+    require_within_bound( table, bound, []( float_t t ){ return bit::math::quintic(float_t(0), float_t(1), t); } );
+  }
+
+  SECTION("Bounds the error of trigonometric curves")
+  {
+    constexpr auto table = bit::math::make_easing_table<256>( bit::math::sine_curve{} );
+    const auto bound = table.error_bound( bit::math::sine_curve::max_second_derivative() );
+
+    REQUIRE( bound < float_t(2e-5) );
+    require_within_bound( table, bound, []( float_t t ){ return bit::math::sine(float_t(0), float_t(1), t); } );
+  }
+
+  SECTION("Bounds the error of half-period curves")
+  {
+    constexpr auto table = bit::math::make_easing_table<32>( bit::math::half_cosine_curve{} );
+    const auto bound = table.error_bound( bit::math::half_cosine_curve::max_second_derivative() );
+
+    require_within_bound( table, bound, []( float_t t ){ return bit::math::half_cosine(float_t(0), float_t(1), t); } );
+  }
+
+  SECTION("Circular curves are bounded by their last interval")
+  {
+    constexpr auto table = bit::math::make_easing_table<128>( bit::math::circular_curve{} );
+    const auto bound = std::sqrt( float_t(2) / 127 );
+
+    require_within_bound( table, bound, []( float_t t ){ return bit::math::circular(float_t(0), float_t(1), t); } );
+  }
+}
+
+TEST_CASE("easing_table<N>::interpolate( const V0&, const V1&, float_t )", "[easing]")
+{
+  using bit::math::float_t;
+
+  constexpr auto table = bit::math::make_easing_table<256>( bit::math::half_sine_curve{} );
+
+  SECTION("Matches the interpolation function of the same curve")
+  {
+    for( auto t = float_t(0); t <= 1; t += float_t(0.05) ) {
+      REQUIRE( table.interpolate( float_t(-4), float_t(6), t ) ==
+               Approx(bit::math::half_sine( float_t(-4), float_t(6), t )).margin(1e-3) );
+    }
+  }
+}
@@ -0,0 +1,170 @@
+/**
+ * \file fixed_simplex.test.cpp
+ *
+ * \brief Unit tests for bit::math::fixed_simplex
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+
+#include <bit/math/fixed_simplex.hpp>
+#include <bit/math/simplex.hpp>
+
+#include <catch.hpp>
+
+#include <vector>
+
+namespace {
+  // Tolerance used when comparing against the floating point implementation
+  constexpr double float_tolerance = 1e-3;
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Conversions
+//----------------------------------------------------------------------------
+
+TEST_CASE("fixed_simplex::to_fixed( float_t )", "[conversion]")
+{
+  using bit::math::fixed_simplex::to_fixed;
+  using bit::math::fixed_simplex::to_float;
+
+  SECTION("Rounds to the nearest fixed-point value")
+  {
+    REQUIRE( to_fixed(1.0) == 65536 );
+    REQUIRE( to_fixed(-2.5) == -163840 );
+    REQUIRE( to_fixed(0.3) == 19661 );
+    REQUIRE( to_fixed(-1000.25) == -65552384 );
+  }
+
+  SECTION("Round-trips through to_float")
+  {
+    REQUIRE( to_float(to_fixed(1.5)) == 1.5 );
+    REQUIRE( to_float(to_fixed(-7.25)) == -7.25 );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Raw Noise
+//----------------------------------------------------------------------------
+
+TEST_CASE("fixed_simplex::raw_noise( fixed_t, fixed_t )", "[raw_noise]")
+{
+  using bit::math::fixed_simplex::raw_noise;
+  using bit::math::fixed_simplex::to_fixed;
+  using bit::math::fixed_simplex::to_float;
+
+  SECTION("Matches golden values exactly")
+  {
+    REQUIRE( raw_noise(19661, 45875) == 16726 );
+    REQUIRE( raw_noise(98304, -147456) == 33586 );
+    REQUIRE( raw_noise(-475136, -98304) == -29878 );
+    REQUIRE( raw_noise(5819597, -3303014) == 41528 );
+    REQUIRE( raw_noise(-65542554, 163879322) == -26465 );
+  }
+
+  SECTION("Is zero on lattice points")
+  {
+    REQUIRE( raw_noise(0, 0) == 0 );
+  }
+
+  SECTION("Agrees with the floating point implementation")
+  {
+    for( auto i = 0; i < 1024; ++i ) {
+      const auto x = to_fixed( i * 0.173 - 40.0 );
+      const auto y = to_fixed( i * -0.091 + 12.0 );
+
+      const auto expected = bit::math::simplex::raw_noise( to_float(x), to_float(y) );
+
+      REQUIRE( to_float(raw_noise(x, y)) == Approx(expected).margin(float_tolerance) );
+    }
+  }
+}
+
+TEST_CASE("fixed_simplex::raw_noise( fixed_t, fixed_t, fixed_t )", "[raw_noise]")
+{
+  using bit::math::fixed_simplex::raw_noise;
+  using bit::math::fixed_simplex::to_fixed;
+  using bit::math::fixed_simplex::to_float;
+
+  SECTION("Matches golden values exactly")
+  {
+    REQUIRE( raw_noise(19661, 45875, 6554) == 614 );
+    REQUIRE( raw_noise(98304, -147456, 245760) == -37317 );
+    REQUIRE( raw_noise(-203162, 275251, -39322) == -38429 );
+    REQUIRE( raw_noise(688128, 16384, 466944) == -49015 );
+  }
+
+  SECTION("Is zero on lattice points")
+  {
+    REQUIRE( raw_noise(0, 0, 0) == 0 );
+  }
+
+  SECTION("Agrees with the floating point implementation")
+  {
+    for( auto i = 0; i < 1024; ++i ) {
+      const auto x = to_fixed( i * 0.173 - 40.0 );
+      const auto y = to_fixed( i * -0.091 + 12.0 );
+      const auto z = to_fixed( i * 0.057 );
+
+      const auto expected = bit::math::simplex::raw_noise( to_float(x),
+                                                           to_float(y),
+                                                           to_float(z) );
+
+      REQUIRE( to_float(raw_noise(x, y, z)) == Approx(expected).margin(float_tolerance) );
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("fixed_simplex::batch_raw_noise( const fixed_t*, const fixed_t*, fixed_t*, std::size_t )", "[raw_noise]")
+{
+  using bit::math::fixed_simplex::fixed_t;
+
+  const auto n = std::size_t{37};
+
+  auto x   = std::vector<fixed_t>(n);
+  auto y   = std::vector<fixed_t>(n);
+  auto out = std::vector<fixed_t>(n);
+
+  for( auto i = std::size_t{0}; i < n; ++i ) {
+    x[i] = static_cast<fixed_t>( i ) * 21863 - 400000;
+    y[i] = static_cast<fixed_t>( i ) * -9173 + 250000;
+  }
+
+  SECTION("Matches raw_noise exactly")
+  {
+    bit::math::fixed_simplex::batch_raw_noise( x.data(), y.data(), out.data(), n );
+
+    for( auto i = std::size_t{0}; i < n; ++i ) {
+      REQUIRE( out[i] == bit::math::fixed_simplex::raw_noise(x[i], y[i]) );
+    }
+  }
+}
+
+TEST_CASE("fixed_simplex::batch_raw_noise( const fixed_t*, const fixed_t*, const fixed_t*, fixed_t*, std::size_t )", "[raw_noise]")
+{
+  using bit::math::fixed_simplex::fixed_t;
+
+  const auto n = std::size_t{37};
+
+  auto x   = std::vector<fixed_t>(n);
+  auto y   = std::vector<fixed_t>(n);
+  auto z   = std::vector<fixed_t>(n);
+  auto out = std::vector<fixed_t>(n);
+
+  for( auto i = std::size_t{0}; i < n; ++i ) {
+    x[i] = static_cast<fixed_t>( i ) * 21863 - 400000;
+    y[i] = static_cast<fixed_t>( i ) * -9173 + 250000;
+    z[i] = static_cast<fixed_t>( i ) * 3301;
+  }
+
+  SECTION("Matches raw_noise exactly")
+  {
+    bit::math::fixed_simplex::batch_raw_noise( x.data(), y.data(), z.data(),
+                                               out.data(), n );
+
+    for( auto i = std::size_t{0}; i < n; ++i ) {
+      REQUIRE( out[i] == bit::math::fixed_simplex::raw_noise(x[i], y[i], z[i]) );
+    }
+  }
+}
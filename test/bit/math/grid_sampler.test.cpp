@@ -0,0 +1,274 @@
+/**
+ * \file grid_sampler.test.cpp
+ *
+ * \brief Unit tests for bit::math::grid_sampler_2d and
+ *        bit::math::grid_sampler_3d
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+
+#include <bit/math/grid_sampler.hpp>
+
+#include <catch.hpp>
+
+#include <random>
+#include <vector>
+
+namespace {
+
+  // Each texel is distinct, so that fetching the wrong texel is detectable
+  std::vector<float> make_texels( std::size_t n )
+  {
+    auto result = std::vector<float>(n);
+    for( auto i = std::size_t{0}; i < n; ++i ) {
+      result[i] = float(i % 17) * 0.5f - float(i % 5);
+    }
+    return result;
+  }
+
+  std::vector<bit::math::float_t> make_coordinates( std::size_t n,
+                                                    unsigned seed )
+  {
+    auto engine = std::mt19937{seed};
+    auto dist   = std::uniform_real_distribution<bit::math::float_t>{ -20, 20 };
+
+    auto result = std::vector<bit::math::float_t>(n);
+    for( auto& c : result ) {
+      c = dist(engine);
+    }
+    // Integral coordinates land exactly on texels
+    result[0] = -7;
+    result[1] = 3;
+    return result;
+  }
+
+  constexpr bit::math::grid_address addresses[] = {
+    bit::math::grid_address::clamp,
+    bit::math::grid_address::wrap,
+    bit::math::grid_address::mirror,
+  };
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Addressing
+//----------------------------------------------------------------------------
+
+TEST_CASE("detail::address_texel( std::ptrdiff_t, std::size_t, grid_address )", "[addressing]")
+{
+  using bit::math::detail::address_texel;
+  using bit::math::grid_address;
+
+  SECTION("clamp repeats the edge texels")
+  {
+    REQUIRE( address_texel( -3, 4, grid_address::clamp ) == 0 );
+    REQUIRE( address_texel( 2, 4, grid_address::clamp ) == 2 );
+    REQUIRE( address_texel( 9, 4, grid_address::clamp ) == 3 );
+  }
+
+  SECTION("wrap tiles the grid")
+  {
+    REQUIRE( address_texel( -1, 4, grid_address::wrap ) == 3 );
+    REQUIRE( address_texel( -8, 4, grid_address::wrap ) == 0 );
+    REQUIRE( address_texel( 9, 4, grid_address::wrap ) == 1 );
+  }
+
+  SECTION("mirror reflects every other tile")
+  {
+    REQUIRE( address_texel( -1, 4, grid_address::mirror ) == 0 );
+    REQUIRE( address_texel( -2, 4, grid_address::mirror ) == 1 );
+    REQUIRE( address_texel( 4, 4, grid_address::mirror ) == 3 );
+    REQUIRE( address_texel( 7, 4, grid_address::mirror ) == 0 );
+    REQUIRE( address_texel( 8, 4, grid_address::mirror ) == 0 );
+  }
+}
+
+//----------------------------------------------------------------------------
+// grid_sampler_2d
+//----------------------------------------------------------------------------
+
+TEST_CASE("grid_sampler_2d<T>::sample( float_t, float_t )", "[sampling]")
+{
+  using bit::math::float_t;
+  using bit::math::grid_address;
+
+  // A 3x2 grid with a padded row stride of 4
+  const float texels[] = {
+    1, 2, 3, 99,
+    5, 6, 7, 99,
+  };
+
+  SECTION("Returns texels at integral coordinates")
+  {
+    const auto sampler = bit::math::grid_sampler_2d<float>{ texels, 3, 2, 4 };
+
+    REQUIRE( sampler.sample(0, 0) == 1 );
+    REQUIRE( sampler.sample(2, 0) == 3 );
+    REQUIRE( sampler.sample(1, 1) == 6 );
+  }
+
+  SECTION("Bilinearly blends the surrounding texels")
+  {
+    const auto sampler = bit::math::grid_sampler_2d<float>{ texels, 3, 2, 4 };
+
+    REQUIRE( sampler.sample(0.5, 0) == Approx(1.5) );
+    REQUIRE( sampler.sample(0.5, 0.5) == Approx(3.5) );
+    REQUIRE( sampler.sample(bit::math::vec2{1.25, 0.75}) ==
+             Approx(bit::math::bilinear(2.0, 3.0, 6.0, 7.0, 0.25, 0.75)) );
+  }
+
+  SECTION("Clamps coordinates outside of the grid")
+  {
+    const auto sampler = bit::math::grid_sampler_2d<float>{ texels, 3, 2, 4 };
+
+    REQUIRE( sampler.sample(-5, -5) == 1 );
+    REQUIRE( sampler.sample(2.5, 0) == 3 );
+    REQUIRE( sampler.sample(10, 10) == 7 );
+  }
+
+  SECTION("Wraps coordinates outside of the grid")
+  {
+    const auto sampler = bit::math::grid_sampler_2d<float>{ texels, 3, 2, 4, grid_address::wrap };
+
+    REQUIRE( sampler.sample(-1, 0) == 3 );
+    REQUIRE( sampler.sample(3, 2) == 1 );
+    REQUIRE( sampler.sample(2.5, 0) == Approx(2) );
+  }
+
+  SECTION("Mirrors coordinates outside of the grid")
+  {
+    const auto sampler = bit::math::grid_sampler_2d<float>{ texels, 3, 2, 4, grid_address::mirror };
+
+    REQUIRE( sampler.sample(-1, 0) == 1 );
+    REQUIRE( sampler.sample(3, 0) == 3 );
+    REQUIRE( sampler.sample(4, -2) == 6 );
+  }
+}
+
+TEST_CASE("grid_sampler_2d<T>::sample( const float_t*, const float_t*, float_t*, size_type )", "[sampling]")
+{
+  using bit::math::float_t;
+
+  const auto width  = std::size_t{7};
+  const auto height = std::size_t{5};
+  const auto stride = std::size_t{9};
+  const auto texels = make_texels( stride * height );
+
+  // Spans more than one chunk, with a partial set of lanes at the end
+  const auto n = std::size_t{301};
+  const auto x = make_coordinates( n, 1 );
+  const auto y = make_coordinates( n, 2 );
+
+  auto out = std::vector<float_t>(n);
+
+  SECTION("Matches sampling each coordinate individually")
+  {
+    for( auto address : addresses ) {
+      const auto sampler = bit::math::grid_sampler_2d<float>{
+        texels.data(), width, height, stride, address
+      };
+
+      sampler.sample( x.data(), y.data(), out.data(), n );
+
+      for( auto i = std::size_t{0}; i < n; ++i ) {
+        REQUIRE( out[i] == Approx(sampler.sample(x[i], y[i])).margin(1e-5) );
+      }
+    }
+  }
+}
+
+TEST_CASE("grid_sampler_2d<T>::sample( const float_t*, const float_t*, float_t*, size_type ) at huge coordinates", "[sampling]")
+{
+  using bit::math::float_t;
+
+  const auto width  = std::size_t{3};
+  const auto height = std::size_t{2};
+  const auto texels = make_texels( width * height );
+
+  // Beyond the range of a 32-bit integer and of a float's exact integers,
+  // but still within the scalar sampler's std::ptrdiff_t
+  const auto x = std::vector<float_t>{ 1e10, -1e10, 3e9, -3e9, 16777218.0, -4.5e15, 0.5, 2e18 };
+  const auto y = std::vector<float_t>{ 0.5, 1e10, -1e10, 7e12, 1.5, 3e9, -2e15, -2e18 };
+  const auto n = x.size();
+
+  auto out = std::vector<float_t>(n);
+
+  SECTION("Matches sampling each coordinate individually")
+  {
+    for( auto address : addresses ) {
+      const auto sampler = bit::math::grid_sampler_2d<float>{
+        texels.data(), width, height, width, address
+      };
+
+      sampler.sample( x.data(), y.data(), out.data(), n );
+
+      for( auto i = std::size_t{0}; i < n; ++i ) {
+        REQUIRE( out[i] == Approx(sampler.sample(x[i], y[i])).margin(1e-5) );
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// grid_sampler_3d
+//----------------------------------------------------------------------------
+
+TEST_CASE("grid_sampler_3d<T>::sample( float_t, float_t, float_t )", "[sampling]")
+{
+  // A 2x2x2 grid, tightly packed
+  const float texels[] = {
+    0, 1,
+    2, 3,
+
+    4, 5,
+    6, 7,
+  };
+
+  const auto sampler = bit::math::grid_sampler_3d<float>{ texels, 2, 2, 2, 2, 4 };
+
+  SECTION("Returns texels at integral coordinates")
+  {
+    REQUIRE( sampler.sample(0, 0, 0) == 0 );
+    REQUIRE( sampler.sample(1, 1, 0) == 3 );
+    REQUIRE( sampler.sample(1, 0, 1) == 5 );
+    REQUIRE( sampler.fetch(0, 1, 1) == 6 );
+  }
+
+  SECTION("Trilinearly blends the surrounding texels")
+  {
+    REQUIRE( sampler.sample(0.5, 0.5, 0.5) == Approx(3.5) );
+    REQUIRE( sampler.sample(bit::math::vec3{0.25, 0, 1}) == Approx(4.25) );
+  }
+}
+
+TEST_CASE("grid_sampler_3d<T>::sample( const float_t*, const float_t*, const float_t*, float_t*, size_type )", "[sampling]")
+{
+  using bit::math::float_t;
+
+  const auto width  = std::size_t{6};
+  const auto height = std::size_t{5};
+  const auto depth  = std::size_t{3};
+  const auto texels = make_texels( width * height * depth );
+
+  const auto n = std::size_t{150};
+  const auto x = make_coordinates( n, 3 );
+  const auto y = make_coordinates( n, 4 );
+  const auto z = make_coordinates( n, 5 );
+
+  auto out = std::vector<float_t>(n);
+
+  SECTION("Matches sampling each coordinate individually")
+  {
+    for( auto address : addresses ) {
+      const auto sampler = bit::math::grid_sampler_3d<float>{
+        texels.data(), width, height, depth, width, width * height, address
+      };
+
+      sampler.sample( x.data(), y.data(), z.data(), out.data(), n );
+
+      for( auto i = std::size_t{0}; i < n; ++i ) {
+        REQUIRE( out[i] == Approx(sampler.sample(x[i], y[i], z[i])).margin(1e-5) );
+      }
+    }
+  }
+}
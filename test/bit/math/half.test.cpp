@@ -0,0 +1,121 @@
+/**
+ * \file half.test.cpp
+ *
+ * \brief Unit tests for bit::math::half
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+
+#include <bit/math/half.hpp>
+#include <bit/math/interpolation.hpp>
+#include <bit/math/grid_sampler.hpp>
+
+#include <catch.hpp>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+//----------------------------------------------------------------------------
+// Batch Interpolation
+//----------------------------------------------------------------------------
+
+TEST_CASE("linear( const half*, const half*, const float_t*, half*, std::size_t )", "[interpolation]")
+{
+  using bit::math::float_t;
+  using bit::math::half;
+
+  // Spans more than one chunk of widened values
+  const auto n = std::size_t{300};
+
+  auto v0  = std::vector<half>{};
+  auto v1  = std::vector<half>{};
+  auto t   = std::vector<float_t>{};
+  auto out = std::vector<half>(n);
+  for( auto i = std::size_t{0}; i < n; ++i ) {
+    v0.emplace_back( float(i % 13) - 4.0f );
+    v1.emplace_back( float(i % 7) * 2.0f );
+    t.push_back( float_t(i) / float_t(n - 1) );
+  }
+
+  SECTION("Matches interpolating the widened values")
+  {
+    bit::math::linear( v0.data(), v1.data(), t.data(), out.data(), n );
+
+    for( auto i = std::size_t{0}; i < n; ++i ) {
+      const auto expected = half( float(bit::math::linear( float(v0[i]), float(v1[i]), float(t[i]) )) );
+
+      REQUIRE( float(out[i]) == Approx(float(expected)).margin(1e-2) );
+    }
+  }
+
+  SECTION("Shares a single position between all values")
+  {
+    bit::math::linear( v0.data(), v1.data(), float_t(1), out.data(), n );
+
+    for( auto i = std::size_t{0}; i < n; ++i ) {
+      REQUIRE( float(out[i]) == float(v1[i]) );
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// Grid Sampling
+//----------------------------------------------------------------------------
+
+TEST_CASE("grid_sampler_2d<half>::sample( float_t, float_t )", "[sampling]")
+{
+  using bit::math::half;
+
+  const half texels[] = {
+    half(1.0f), half(2.0f),
+    half(3.0f), half(4.0f),
+  };
+
+  const auto sampler = bit::math::grid_sampler_2d<half>{ texels, 2, 2, 2 };
+
+  SECTION("Samples the widened texels")
+  {
+    REQUIRE( sampler.sample(1, 0) == 2 );
+    REQUIRE( sampler.sample(0.5, 0.5) == Approx(2.5) );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Batch Clamping
+//----------------------------------------------------------------------------
+
+TEST_CASE("saturate( const half*, half*, std::size_t, nan_policy )", "[clamping]")
+{
+  using bit::math::half;
+  using bit::math::nan_policy;
+
+  // Spans more than one chunk of widened values
+  const auto n = std::size_t{300};
+
+  auto values = std::vector<half>{};
+  auto out    = std::vector<half>(n);
+  for( auto i = std::size_t{0}; i < n; ++i ) {
+    values.emplace_back( float(i % 9) * 0.25f - 0.5f );
+  }
+
+  SECTION("Matches saturating the widened values")
+  {
+    bit::math::saturate( values.data(), out.data(), n );
+
+    for( auto i = std::size_t{0}; i < n; ++i ) {
+      REQUIRE( float(out[i]) == bit::math::saturate( float(values[i]) ) );
+    }
+  }
+
+  SECTION("Applies the nan policy")
+  {
+    values[7] = half( std::numeric_limits<float>::quiet_NaN() );
+
+    bit::math::saturate( values.data(), out.data(), n, nan_policy::propagate );
+    REQUIRE( std::isnan( float(out[7]) ) );
+
+    bit::math::saturate( values.data(), out.data(), n, nan_policy::lower );
+    REQUIRE( float(out[7]) == 0.0f );
+  }
+}
@@ -0,0 +1,231 @@
+/**
+ * \file interpolation.test.cpp
+ *
+ * \brief Unit tests for the batch interpolation functions
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+
+#include <bit/math/interpolation.hpp>
+
+#include <catch.hpp>
+
+#include <cmath>
+#include <vector>
+
+namespace {
+  // Spans more than one chunk of weights, with a partial set of lanes at
+  // the end
+  constexpr std::size_t sample_count = 1000;
+
+  std::vector<bit::math::float_t> make_values( bit::math::float_t offset )
+  {
+    auto result = std::vector<bit::math::float_t>(sample_count * 4);
+    for( auto i = std::size_t{0}; i < result.size(); ++i ) {
+      result[i] = offset + bit::math::float_t(i % 97) * bit::math::float_t(0.25);
+    }
+    return result;
+  }
+
+  std::vector<bit::math::float_t> make_positions()
+  {
+    auto result = std::vector<bit::math::float_t>(sample_count);
+    for( auto i = std::size_t{0}; i < result.size(); ++i ) {
+      result[i] = bit::math::float_t(i) / bit::math::float_t(sample_count - 1);
+    }
+    return result;
+  }
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Batch Interpolation
+//----------------------------------------------------------------------------
+
+TEST_CASE("linear( const float_t*, const float_t*, const float_t*, float_t*, std::size_t )", "[interpolation]")
+{
+  using bit::math::float_t;
+
+  const auto v0 = make_values( -10 );
+  const auto v1 = make_values( 3 );
+  const auto t  = make_positions();
+
+  auto out = std::vector<float_t>(sample_count);
+
+  SECTION("Matches the scalar interpolation")
+  {
+    bit::math::linear( v0.data(), v1.data(), t.data(), out.data(), sample_count );
+
+    for( auto i = std::size_t{0}; i < sample_count; ++i ) {
+      REQUIRE( out[i] == Approx(bit::math::linear(v0[i], v1[i], t[i])) );
+    }
+  }
+
+  SECTION("Returns the end points exactly")
+  {
+    bit::math::linear( v0.data(), v1.data(), t.data(), out.data(), sample_count );
+
+    REQUIRE( out.front() == v0.front() );
+    REQUIRE( out.back() == v1[sample_count - 1] );
+  }
+}
+
+TEST_CASE("linear( const float_t*, const float_t*, float_t, float_t*, std::size_t )", "[interpolation]")
+{
+  using bit::math::float_t;
+
+  const auto v0 = make_values( -10 );
+  const auto v1 = make_values( 3 );
+
+  auto out = std::vector<float_t>(sample_count);
+
+  SECTION("Matches the scalar interpolation")
+  {
+    const auto t = float_t(0.3);
+
+    bit::math::linear( v0.data(), v1.data(), t, out.data(), sample_count );
+
+    for( auto i = std::size_t{0}; i < sample_count; ++i ) {
+      REQUIRE( out[i] == Approx(bit::math::linear(v0[i], v1[i], t)) );
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("easing( const float_t*, const float_t*, const float_t*, float_t*, std::size_t )", "[interpolation]")
+{
+  using bit::math::float_t;
+
+  const auto v0 = make_values( -10 );
+  const auto v1 = make_values( 3 );
+  const auto t  = make_positions();
+
+  auto out = std::vector<float_t>(sample_count);
+
+  const auto expect = [&]( auto curve )
+  {
+    for( auto i = std::size_t{0}; i < sample_count; ++i ) {
+      const auto w = curve( t[i] );
+
+      REQUIRE( out[i] == Approx(v0[i] * (1 - w) + v1[i] * w).margin(1e-4) );
+    }
+  };
+
+  SECTION("quadratic eases by t^2")
+  {
+    bit::math::quadratic( v0.data(), v1.data(), t.data(), out.data(), sample_count );
+    expect( []( float_t t ){ return t*t; } );
+  }
+
+  SECTION("cubic eases by t^3")
+  {
+    bit::math::cubic( v0.data(), v1.data(), t.data(), out.data(), sample_count );
+    expect( []( float_t t ){ return t*t*t; } );
+  }
+
+  SECTION("quartic eases by t^4")
+  {
+    bit::math::quartic( v0.data(), v1.data(), t.data(), out.data(), sample_count );
+    expect( []( float_t t ){ return t*t*t*t; } );
+  }
+
+  SECTION("quintic eases by t^5")
+  {
+    bit::math::quintic( v0.data(), v1.data(), t.data(), out.data(), sample_count );
+    expect( []( float_t t ){ return t*t*t*t*t; } );
+  }
+
+  SECTION("circular eases by 1 - sqrt(1 - t^2)")
+  {
+    bit::math::circular( v0.data(), v1.data(), t.data(), out.data(), sample_count );
+    expect( []( float_t t ){ return 1 - std::sqrt(1 - t*t); } );
+  }
+
+  SECTION("half_cosine eases by 0.5 - cos(t * pi/2) / 2")
+  {
+    bit::math::half_cosine( v0.data(), v1.data(), t.data(), out.data(), sample_count );
+    expect( []( float_t t ){ return 0.5 - std::cos(t * bit::math::half_pi<float_t>()) * 0.5; } );
+  }
+
+  SECTION("cosine eases by 1 - cos(t * pi)")
+  {
+    bit::math::cosine( v0.data(), v1.data(), t.data(), out.data(), sample_count );
+    expect( []( float_t t ){ return 1 - std::cos(t * bit::math::pi<float_t>()); } );
+  }
+
+  SECTION("half_sine eases by 0.5 - sin(t * pi/2) / 2")
+  {
+    bit::math::half_sine( v0.data(), v1.data(), t.data(), out.data(), sample_count );
+    expect( []( float_t t ){ return 0.5 - std::sin(t * bit::math::half_pi<float_t>()) * 0.5; } );
+  }
+
+  SECTION("sine eases by 1 - sin(t * pi)")
+  {
+    bit::math::sine( v0.data(), v1.data(), t.data(), out.data(), sample_count );
+    expect( []( float_t t ){ return 1 - std::sin(t * bit::math::pi<float_t>()); } );
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("linear( const vec3*, const vec3*, const float_t*, vec3*, std::size_t )", "[interpolation]")
+{
+  using bit::math::float_t;
+  using bit::math::vec3;
+
+  const auto a = make_values( -10 );
+  const auto b = make_values( 3 );
+  const auto t = make_positions();
+
+  auto v0  = std::vector<vec3>{};
+  auto v1  = std::vector<vec3>{};
+  auto out = std::vector<vec3>(sample_count);
+  for( auto i = std::size_t{0}; i < sample_count; ++i ) {
+    v0.emplace_back( a[3*i], a[3*i+1], a[3*i+2] );
+    v1.emplace_back( b[3*i], b[3*i+1], b[3*i+2] );
+  }
+
+  SECTION("Interpolates each component by its vector's position")
+  {
+    bit::math::cubic( v0.data(), v1.data(), t.data(), out.data(), sample_count );
+
+    for( auto i = std::size_t{0}; i < sample_count; ++i ) {
+      const auto w = t[i] * t[i] * t[i];
+
+      REQUIRE( out[i].x() == Approx(v0[i].x() * (1 - w) + v1[i].x() * w) );
+      REQUIRE( out[i].y() == Approx(v0[i].y() * (1 - w) + v1[i].y() * w) );
+      REQUIRE( out[i].z() == Approx(v0[i].z() * (1 - w) + v1[i].z() * w) );
+    }
+  }
+}
+
+TEST_CASE("linear( const vec4*, const vec4*, float_t, vec4*, std::size_t )", "[interpolation]")
+{
+  using bit::math::float_t;
+  using bit::math::vec4;
+
+  const auto a = make_values( -10 );
+  const auto b = make_values( 3 );
+
+  auto v0  = std::vector<vec4>{};
+  auto v1  = std::vector<vec4>{};
+  auto out = std::vector<vec4>(sample_count);
+  for( auto i = std::size_t{0}; i < sample_count; ++i ) {
+    v0.emplace_back( a[4*i], a[4*i+1], a[4*i+2], a[4*i+3] );
+    v1.emplace_back( b[4*i], b[4*i+1], b[4*i+2], b[4*i+3] );
+  }
+
+  SECTION("Interpolates every component by the shared position")
+  {
+    const auto t = float_t(0.75);
+
+    bit::math::linear( v0.data(), v1.data(), t, out.data(), sample_count );
+
+    for( auto i = std::size_t{0}; i < sample_count; ++i ) {
+      REQUIRE( out[i].x() == Approx(bit::math::linear(v0[i].x(), v1[i].x(), t)) );
+      REQUIRE( out[i].y() == Approx(bit::math::linear(v0[i].y(), v1[i].y(), t)) );
+      REQUIRE( out[i].z() == Approx(bit::math::linear(v0[i].z(), v1[i].z(), t)) );
+      REQUIRE( out[i].w() == Approx(bit::math::linear(v0[i].w(), v1[i].w(), t)) );
+    }
+  }
+}
@@ -0,0 +1,204 @@
+/**
+ * \file keyframe_track.test.cpp
+ *
+ * \brief Unit tests for bit::math::keyframe_track
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+
+#include <bit/math/keyframe_track.hpp>
+#include <bit/math/vector.hpp>
+
+#include <catch.hpp>
+
+#include <random>
+#include <vector>
+
+namespace {
+
+  // A track with unevenly spaced keys
+  bit::math::keyframe_track<bit::math::float_t> make_track( std::size_t keys )
+  {
+    auto result = bit::math::keyframe_track<bit::math::float_t>{};
+    auto time   = bit::math::float_t(0);
+
+    result.reserve( keys );
+    for( auto i = std::size_t{0}; i < keys; ++i ) {
+      result.add_key( time, bit::math::float_t(i % 5) - 2 );
+      time += bit::math::float_t(0.25) + bit::math::float_t(i % 3) * bit::math::float_t(0.5);
+    }
+    return result;
+  }
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Modifiers
+//----------------------------------------------------------------------------
+
+TEST_CASE("keyframe_track<T>::add_key( float_t, const T&, keyframe_interpolation )", "[modifiers]")
+{
+  auto track = bit::math::keyframe_track<bit::math::float_t>{};
+
+  track.add_key( 0.0, 1.0 );
+  track.add_key( 1.0, 3.0, bit::math::keyframe_interpolation::cubic );
+
+  SECTION("Stores times and values contiguously")
+  {
+    REQUIRE( track.size() == 2 );
+    REQUIRE( track.times()[0] == 0.0 );
+    REQUIRE( track.times()[1] == 1.0 );
+    REQUIRE( track.values()[0] == 1.0 );
+    REQUIRE( track.values()[1] == 3.0 );
+  }
+
+  SECTION("Stores the interpolation of each key")
+  {
+    REQUIRE( track.interpolation(0) == bit::math::keyframe_interpolation::linear );
+    REQUIRE( track.interpolation(1) == bit::math::keyframe_interpolation::cubic );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Sampling
+//----------------------------------------------------------------------------
+
+TEST_CASE("keyframe_track<T>::sample( float_t )", "[sampling]")
+{
+  using bit::math::float_t;
+  using bit::math::keyframe_interpolation;
+
+  auto track = bit::math::keyframe_track<float_t>{};
+  track.add_key( 1.0, 2.0, keyframe_interpolation::linear );
+  track.add_key( 2.0, 4.0, keyframe_interpolation::cubic );
+  track.add_key( 4.0, 0.0, keyframe_interpolation::quintic );
+  track.add_key( 5.0, 1.0 );
+
+  SECTION("Clamps before the first key")
+  {
+    REQUIRE( track.sample(0.0) == 2.0 );
+  }
+
+  SECTION("Clamps after the last key")
+  {
+    REQUIRE( track.sample(9.0) == 1.0 );
+  }
+
+  SECTION("Returns key values at key times")
+  {
+    REQUIRE( track.sample(2.0) == 4.0 );
+    REQUIRE( track.sample(4.0) == 0.0 );
+  }
+
+  SECTION("Interpolates each segment with its key's interpolation")
+  {
+    REQUIRE( track.sample(1.5) == Approx(bit::math::linear(2.0, 4.0, 0.5)) );
+    REQUIRE( track.sample(3.0) == Approx(bit::math::cubic(4.0, 0.0, 0.5)) );
+    REQUIRE( track.sample(4.5) == Approx(bit::math::quintic(0.0, 1.0, 0.5)) );
+  }
+
+  SECTION("Samples a single key everywhere")
+  {
+    auto single = bit::math::keyframe_track<float_t>{};
+    single.add_key( 1.0, 7.0 );
+
+    REQUIRE( single.sample(0.0) == 7.0 );
+    REQUIRE( single.sample(3.0) == 7.0 );
+  }
+}
+
+TEST_CASE("keyframe_track<T>::find_segment( float_t, keyframe_cursor& )", "[sampling]")
+{
+  using bit::math::float_t;
+
+  const auto track = make_track( 64 );
+  const auto end   = track.times()[track.size() - 1];
+
+  SECTION("Matches the binary search for increasing times")
+  {
+    auto cursor = bit::math::keyframe_cursor{};
+
+    for( auto time = float_t(-1); time < end + 1; time += float_t(0.0625) ) {
+      REQUIRE( track.find_segment(time, cursor) == track.find_segment(time) );
+      REQUIRE( cursor.segment() == track.find_segment(time) );
+    }
+  }
+
+  SECTION("Matches the binary search for arbitrary times")
+  {
+    auto cursor = bit::math::keyframe_cursor{};
+    auto engine = std::mt19937{42};
+    auto dist   = std::uniform_real_distribution<float_t>{ -1, end + 1 };
+
+    for( auto i = 0; i < 2000; ++i ) {
+      const auto time = dist(engine);
+
+      REQUIRE( track.find_segment(time, cursor) == track.find_segment(time) );
+    }
+  }
+
+  SECTION("Matches the binary search after the track is shortened")
+  {
+    auto cursor = bit::math::keyframe_cursor{};
+    track.find_segment( end, cursor );
+
+    const auto shorter = make_track( 8 );
+
+    REQUIRE( shorter.find_segment(1.0, cursor) == shorter.find_segment(1.0) );
+  }
+}
+
+TEST_CASE("keyframe_track<T>::sample( const float_t*, T*, size_type )", "[sampling]")
+{
+  using bit::math::float_t;
+  using bit::math::vec3;
+
+  auto track = bit::math::keyframe_track<vec3>{};
+  track.add_key( 0.0, vec3{ 0, 0, 0 } );
+  track.add_key( 1.0, vec3{ 1, 2, 3 }, bit::math::keyframe_interpolation::cubic );
+  track.add_key( 3.0, vec3{ -1, 0, 1 } );
+
+  const auto times = std::vector<float_t>{ -0.5, 0.25, 0.5, 1.0, 2.0, 2.5, 4.0 };
+  auto out = std::vector<vec3>( times.size() );
+
+  SECTION("Matches sampling each time individually")
+  {
+    track.sample( times.data(), out.data(), times.size() );
+
+    for( auto i = std::size_t{0}; i < times.size(); ++i ) {
+      const auto expected = track.sample( times[i] );
+
+      REQUIRE( out[i].x() == expected.x() );
+      REQUIRE( out[i].y() == expected.y() );
+      REQUIRE( out[i].z() == expected.z() );
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// Batch Sampling
+//----------------------------------------------------------------------------
+
+TEST_CASE("sample_tracks( const keyframe_track<T>*, keyframe_cursor*, float_t, T*, std::size_t )", "[sampling]")
+{
+  using bit::math::float_t;
+
+  auto tracks  = std::vector<bit::math::keyframe_track<float_t>>{};
+  for( auto i = std::size_t{2}; i < 10; ++i ) {
+    tracks.push_back( make_track( i * 3 ) );
+  }
+  auto cursors = std::vector<bit::math::keyframe_cursor>( tracks.size() );
+  auto out     = std::vector<float_t>( tracks.size() );
+
+  SECTION("Matches sampling each track individually")
+  {
+    for( auto time = float_t(0); time < float_t(20); time += float_t(0.3) ) {
+      bit::math::sample_tracks( tracks.data(), cursors.data(), time,
+                                out.data(), tracks.size() );
+
+      for( auto i = std::size_t{0}; i < tracks.size(); ++i ) {
+        REQUIRE( out[i] == tracks[i].sample(time) );
+      }
+    }
+  }
+}
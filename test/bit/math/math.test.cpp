@@ -0,0 +1,148 @@
+/**
+ * \file math.test.cpp
+ *
+ * \brief Unit tests for the batch functions in bit/math/math.hpp
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+
+#include <bit/math/math.hpp>
+
+#include <catch.hpp>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace {
+
+  // Values that span both bounds, with a length that is not a multiple of
+  // any lane width
+  template<typename Float>
+  std::vector<Float> make_values()
+  {
+    auto result = std::vector<Float>{};
+    for( auto i = 0; i < 37; ++i ) {
+      result.push_back( Float(i - 18) * Float(0.125) );
+    }
+    return result;
+  }
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Batch Clamping
+//----------------------------------------------------------------------------
+
+TEMPLATE_TEST_CASE("clamp( const T*, T*, std::size_t, T, T, nan_policy )", "[clamping]", float, double)
+{
+  using bit::math::nan_policy;
+
+  const auto nan = std::numeric_limits<TestType>::quiet_NaN();
+  auto values = make_values<TestType>();
+  auto out = std::vector<TestType>( values.size() );
+
+  SECTION("Matches clamping each value individually")
+  {
+    bit::math::clamp( values.data(), out.data(), values.size(), TestType(-1), TestType(0.5) );
+
+    for( auto i = std::size_t{0}; i < values.size(); ++i ) {
+      REQUIRE( out[i] == bit::math::clamp( values[i], TestType(0.5), TestType(-1) ) );
+    }
+  }
+
+  SECTION("Clamps in place")
+  {
+    bit::math::clamp( values.data(), values.data(), values.size(), TestType(-1), TestType(0.5) );
+
+    REQUIRE( values.front() == TestType(-1) );
+    REQUIRE( values.back() == TestType(0.5) );
+  }
+
+  SECTION("Applies the nan policy")
+  {
+    values[3] = nan;
+    values[values.size() - 1] = nan;
+
+    bit::math::clamp( values.data(), out.data(), values.size(), TestType(-1), TestType(0.5), nan_policy::propagate );
+    REQUIRE( std::isnan( out[3] ) );
+    REQUIRE( std::isnan( out[values.size() - 1] ) );
+    REQUIRE( out[4] == TestType(-1) );
+
+    bit::math::clamp( values.data(), out.data(), values.size(), TestType(-1), TestType(0.5), nan_policy::lower );
+    REQUIRE( out[3] == TestType(-1) );
+    REQUIRE( out[values.size() - 1] == TestType(-1) );
+
+    bit::math::clamp( values.data(), out.data(), values.size(), TestType(-1), TestType(0.5), nan_policy::zero );
+    REQUIRE( out[3] == TestType(0) );
+    REQUIRE( out[values.size() - 1] == TestType(0) );
+  }
+}
+
+TEMPLATE_TEST_CASE("saturate( const T*, T*, std::size_t, nan_policy )", "[clamping]", float, double)
+{
+  const auto values = make_values<TestType>();
+  auto out = std::vector<TestType>( values.size() );
+
+  SECTION("Matches saturating each value individually")
+  {
+    bit::math::saturate( values.data(), out.data(), values.size() );
+
+    for( auto i = std::size_t{0}; i < values.size(); ++i ) {
+      REQUIRE( out[i] == bit::math::saturate( values[i] ) );
+    }
+  }
+}
+
+TEMPLATE_TEST_CASE("remap( const T*, T*, std::size_t, T, T, T, T, nan_policy )", "[clamping]", float, double)
+{
+  using bit::math::nan_policy;
+
+  auto values = make_values<TestType>();
+  auto out = std::vector<TestType>( values.size() );
+
+  SECTION("Maps the input range onto the output range")
+  {
+    const TestType in[] = { -1, 0, 1 };
+    TestType result[3];
+
+    bit::math::remap( in, result, 3, TestType(-1), TestType(1), TestType(10), TestType(20) );
+
+    REQUIRE( result[0] == Approx(10) );
+    REQUIRE( result[1] == Approx(15) );
+    REQUIRE( result[2] == Approx(20) );
+  }
+
+  SECTION("Clamps values outside of the input range")
+  {
+    bit::math::remap( values.data(), out.data(), values.size(), TestType(-1), TestType(1), TestType(10), TestType(20) );
+
+    for( auto i = std::size_t{0}; i < values.size(); ++i ) {
+      const auto t = bit::math::saturate( (values[i] + 1) / 2 );
+
+      REQUIRE( out[i] == Approx(10 + t * 10) );
+    }
+  }
+
+  SECTION("Maps reversed ranges")
+  {
+    bit::math::remap( values.data(), out.data(), values.size(), TestType(1), TestType(-1), TestType(0), TestType(1) );
+
+    REQUIRE( out.front() == TestType(1) );
+    REQUIRE( out.back() == TestType(0) );
+  }
+
+  SECTION("Applies the nan policy to the output range")
+  {
+    values[5] = std::numeric_limits<TestType>::quiet_NaN();
+
+    bit::math::remap( values.data(), out.data(), values.size(), TestType(-1), TestType(1), TestType(10), TestType(20), nan_policy::propagate );
+    REQUIRE( std::isnan( out[5] ) );
+
+    bit::math::remap( values.data(), out.data(), values.size(), TestType(-1), TestType(1), TestType(10), TestType(20), nan_policy::lower );
+    REQUIRE( out[5] == TestType(10) );
+
+    bit::math::remap( values.data(), out.data(), values.size(), TestType(-1), TestType(1), TestType(10), TestType(20), nan_policy::zero );
+    REQUIRE( out[5] == TestType(0) );
+  }
+}
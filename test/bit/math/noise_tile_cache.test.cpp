@@ -0,0 +1,213 @@
+/**
+ * \file noise_tile_cache.test.cpp
+ *
+ * \brief Unit tests for bit::math::noise_tile_cache
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+
+#include <bit/math/noise_tile_cache.hpp>
+
+#include <catch.hpp>
+
+#include <cstdio>       // std::remove, std::fopen, std::fputs, std::fread, std::fclose
+#include <cstdlib>      // std::getenv
+#include <stdexcept>    // std::invalid_argument
+#include <system_error> // std::system_error
+#include <string>
+#include <vector>
+
+#include <unistd.h> // ::mkstemp, ::close
+
+namespace {
+  // Creates an empty file with a unique name in the temporary directory
+  std::string make_cache_path()
+  {
+    const auto* directory = std::getenv( "TMPDIR" );
+    auto path = std::string{ directory != nullptr ? directory : "/tmp" }
+              + "/noise_tile_cache.test.XXXXXX";
+
+    const auto file = ::mkstemp( &path[0] );
+    REQUIRE( file >= 0 );
+    ::close( file );
+
+    return path;
+  }
+
+  constexpr std::size_t tile_size  = 16;
+  constexpr std::size_t tile_bytes = tile_size * tile_size * sizeof(bit::math::float_t);
+
+  // Large enough for exactly two tiles and their index entries
+  constexpr std::size_t two_tiles = 2 * tile_bytes + 256;
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Constructors
+//----------------------------------------------------------------------------
+
+TEST_CASE("noise_tile_cache::noise_tile_cache( const char*, std::size_t, std::size_t )", "[ctor]")
+{
+  const auto path = make_cache_path();
+  const auto* cache_path = path.c_str();
+
+  SECTION("Capacity stays within the size cap")
+  {
+    bit::math::noise_tile_cache cache{ cache_path, tile_size, two_tiles };
+
+    REQUIRE( cache.tile_size() == tile_size );
+    REQUIRE( cache.capacity() == 2 );
+    REQUIRE( cache.size() == 0 );
+  }
+
+  SECTION("Throws if the size cap cannot hold a tile")
+  {
+    REQUIRE_THROWS_AS( (bit::math::noise_tile_cache{ cache_path, tile_size, tile_bytes / 2 }),
+                       std::invalid_argument );
+  }
+
+  SECTION("Throws rather than overwriting a file that is not a cache")
+  {
+    const auto contents = std::string{ "not a noise tile cache" };
+
+    auto* file = std::fopen( cache_path, "w" );
+    REQUIRE( file != nullptr );
+    std::fputs( contents.c_str(), file );
+    std::fclose( file );
+
+    REQUIRE_THROWS_AS( (bit::math::noise_tile_cache{ cache_path, tile_size, two_tiles }),
+                       std::invalid_argument );
+
+    char buffer[64] = {};
+    file = std::fopen( cache_path, "r" );
+    REQUIRE( file != nullptr );
+    const auto count = std::fread( buffer, 1, sizeof(buffer), file );
+    std::fclose( file );
+
+    REQUIRE( std::string( buffer, count ) == contents );
+  }
+
+  SECTION("Throws if the file is owned by another instance")
+  {
+    bit::math::noise_tile_cache cache{ cache_path, tile_size, two_tiles };
+
+    REQUIRE_THROWS_AS( (bit::math::noise_tile_cache{ cache_path, tile_size, two_tiles }),
+                       std::system_error );
+  }
+
+  SECTION("Releases the file when the owner is destroyed")
+  {
+    {
+      bit::math::noise_tile_cache cache{ cache_path, tile_size, two_tiles };
+    }
+
+    REQUIRE_NOTHROW( (bit::math::noise_tile_cache{ cache_path, tile_size, two_tiles }) );
+  }
+
+  std::remove( cache_path );
+}
+
+//----------------------------------------------------------------------------
+// Tiles
+//----------------------------------------------------------------------------
+
+TEST_CASE("noise_tile_cache::tile( const simplex_generator&, const octave_schedule&, std::int32_t, std::int32_t )", "[tile]")
+{
+  const auto path = make_cache_path();
+  const auto* cache_path = path.c_str();
+
+  const auto generator = bit::math::simplex_generator{ 1234 };
+  const auto schedule  = bit::math::octave_schedule{ 4, 0.5, 0.03 };
+
+  SECTION("Samples octave noise at the tile's coordinates")
+  {
+    bit::math::noise_tile_cache cache{ cache_path, tile_size, two_tiles };
+
+    const auto* samples = cache.tile( generator, schedule, -3, 2 );
+
+    for( auto row = 0; row < int(tile_size); ++row ) {
+      for( auto column = 0; column < int(tile_size); ++column ) {
+        const auto x = -3 * int(tile_size) + column;
+        const auto y =  2 * int(tile_size) + row;
+
+        REQUIRE( samples[row * tile_size + column] == generator.octave_noise(schedule, x, y) );
+      }
+    }
+  }
+
+  SECTION("Serves repeated requests from the same memory")
+  {
+    bit::math::noise_tile_cache cache{ cache_path, tile_size, two_tiles };
+
+    const auto* first  = cache.tile( generator, schedule, 0, 0 );
+    const auto* second = cache.tile( generator, schedule, 0, 0 );
+
+    REQUIRE( first == second );
+    REQUIRE( cache.size() == 1 );
+  }
+
+  SECTION("Keys tiles by seed and schedule")
+  {
+    bit::math::noise_tile_cache cache{ cache_path, tile_size, two_tiles };
+
+    const auto other_generator = bit::math::simplex_generator{ 4321 };
+    const auto other_schedule  = bit::math::octave_schedule{ 3, 0.5, 0.03 };
+
+    cache.tile( generator, schedule, 0, 0 );
+
+    REQUIRE( cache.contains(generator, schedule, 0, 0) );
+    REQUIRE_FALSE( cache.contains(other_generator, schedule, 0, 0) );
+    REQUIRE_FALSE( cache.contains(generator, other_schedule, 0, 0) );
+    REQUIRE_FALSE( cache.contains(generator, schedule, 0, 1) );
+  }
+
+  SECTION("Evicts the least recently used tile")
+  {
+    bit::math::noise_tile_cache cache{ cache_path, tile_size, two_tiles };
+
+    cache.tile( generator, schedule, 0, 0 );
+    cache.tile( generator, schedule, 1, 0 );
+    cache.tile( generator, schedule, 0, 0 );
+    cache.tile( generator, schedule, 2, 0 );
+
+    REQUIRE( cache.size() == 2 );
+    REQUIRE( cache.contains(generator, schedule, 0, 0) );
+    REQUIRE_FALSE( cache.contains(generator, schedule, 1, 0) );
+    REQUIRE( cache.contains(generator, schedule, 2, 0) );
+  }
+
+  SECTION("Persists tiles between instances")
+  {
+    auto expected = std::vector<bit::math::float_t>{};
+    {
+      bit::math::noise_tile_cache cache{ cache_path, tile_size, two_tiles };
+
+      const auto* samples = cache.tile( generator, schedule, 5, -7 );
+      expected.assign( samples, samples + tile_size * tile_size );
+    }
+
+    bit::math::noise_tile_cache cache{ cache_path, tile_size, two_tiles };
+
+    REQUIRE( cache.size() == 1 );
+    REQUIRE( cache.contains(generator, schedule, 5, -7) );
+
+    const auto* samples = cache.tile( generator, schedule, 5, -7 );
+    for( auto i = std::size_t{0}; i < expected.size(); ++i ) {
+      REQUIRE( samples[i] == expected[i] );
+    }
+  }
+
+  SECTION("Discards a file with a different layout")
+  {
+    {
+      bit::math::noise_tile_cache cache{ cache_path, tile_size, two_tiles };
+      cache.tile( generator, schedule, 0, 0 );
+    }
+
+    bit::math::noise_tile_cache cache{ cache_path, tile_size / 2, two_tiles };
+
+    REQUIRE( cache.size() == 0 );
+    REQUIRE_FALSE( cache.contains(generator, schedule, 0, 0) );
+  }
+
+  std::remove( cache_path );
+}
@@ -0,0 +1,173 @@
+/**
+ * \file perlin.test.cpp
+ *
+ * \brief Unit tests for bit::math::perlin
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+
+#include <bit/math/perlin.hpp>
+
+#include <catch.hpp>
+
+#include <vector>
+
+namespace {
+  // Tolerance used when comparing against the double-precision reference
+  // implementation
+  constexpr double reference_tolerance = 1e-4;
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Raw Noise
+//----------------------------------------------------------------------------
+
+TEST_CASE("perlin::raw_noise( float_t, float_t )", "[raw_noise]")
+{
+  using bit::math::perlin::raw_noise;
+
+  SECTION("Matches reference values")
+  {
+    REQUIRE( raw_noise(0.3, 0.7) == Approx(0.0910065).margin(reference_tolerance) );
+    REQUIRE( raw_noise(1.5, -2.25) == Approx(-0.1594238).margin(reference_tolerance) );
+    REQUIRE( raw_noise(-7.25, -1.7) == Approx(-0.1651951).margin(reference_tolerance) );
+    REQUIRE( raw_noise(88.8, -50.4) == Approx(-0.3509301).margin(reference_tolerance) );
+  }
+
+  SECTION("Is zero on lattice points")
+  {
+    REQUIRE( raw_noise(0.0, 0.0) == 0.0 );
+    REQUIRE( raw_noise(3.0, -7.0) == 0.0 );
+  }
+
+  SECTION("Stays within [-1,1]")
+  {
+    for( auto i = 0; i < 4096; ++i ) {
+      const auto n = raw_noise( i * 0.137, i * -0.071 );
+
+      REQUIRE( n >= -1.0 );
+      REQUIRE( n <= 1.0 );
+    }
+  }
+}
+
+TEST_CASE("perlin::raw_noise( float_t, float_t, float_t )", "[raw_noise]")
+{
+  using bit::math::perlin::raw_noise;
+
+  SECTION("Matches reference values")
+  {
+    REQUIRE( raw_noise(0.3, 0.7, 0.1) == Approx(0.0904710).margin(reference_tolerance) );
+    REQUIRE( raw_noise(1.5, -2.25, 3.75) == Approx(0.0955577).margin(reference_tolerance) );
+    REQUIRE( raw_noise(-3.1, 4.2, -0.6) == Approx(-0.5139301).margin(reference_tolerance) );
+    REQUIRE( raw_noise(10.5, 0.25, 7.125) == Approx(-0.2611937).margin(reference_tolerance) );
+  }
+
+  SECTION("Is zero on lattice points")
+  {
+    REQUIRE( raw_noise(0.0, 0.0, 0.0) == 0.0 );
+    REQUIRE( raw_noise(3.0, -7.0, 12.0) == 0.0 );
+  }
+
+  SECTION("Stays within [-1,1]")
+  {
+    for( auto i = 0; i < 4096; ++i ) {
+      const auto n = raw_noise( i * 0.137, i * -0.071, i * 0.053 );
+
+      REQUIRE( n >= -1.0 );
+      REQUIRE( n <= 1.0 );
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("perlin::batch_raw_noise( const float_t*, const float_t*, float_t*, std::size_t )", "[raw_noise][batch]")
+{
+  using bit::math::float_t;
+
+  // Not a multiple of any lane width, to exercise the tail
+  const auto n = std::size_t{1027};
+
+  auto xs  = std::vector<float_t>(n);
+  auto ys  = std::vector<float_t>(n);
+  auto out = std::vector<float_t>(n);
+
+  for( auto i = std::size_t{0}; i < n; ++i ) {
+    xs[i] = float_t(i) * float_t(0.173) - float_t(40.0);
+    ys[i] = float_t(i) * float_t(-0.091) + float_t(12.5);
+  }
+
+  bit::math::perlin::batch_raw_noise( xs.data(), ys.data(), out.data(), n );
+
+  SECTION("Matches the scalar implementation")
+  {
+    for( auto i = std::size_t{0}; i < n; ++i ) {
+      REQUIRE( out[i] == Approx(bit::math::perlin::raw_noise(xs[i], ys[i])).margin(1e-5) );
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// Grid Fill
+//----------------------------------------------------------------------------
+
+TEST_CASE("perlin::fill_grid_2d( const vec2&, const vec2&, std::size_t, std::size_t, float_t, float_t, float_t, float_t* )", "[fill_grid]")
+{
+  using bit::math::float_t;
+
+  const auto origin = bit::math::vec2{ -3.25, 1.5 };
+  const auto step   = bit::math::vec2{ 0.125, 0.25 };
+  const auto width  = std::size_t{37};
+  const auto height = std::size_t{11};
+
+  auto grid = std::vector<float_t>(width * height);
+
+  bit::math::perlin::fill_grid_2d( origin, step, width, height,
+                                   4, 0.5, 1.5, grid.data() );
+
+  SECTION("Each sample matches octave_noise")
+  {
+    for( auto r = std::size_t{0}; r < height; ++r ) {
+      for( auto c = std::size_t{0}; c < width; ++c ) {
+        const auto x = origin.x() + step.x() * float_t(c);
+        const auto y = origin.y() + step.y() * float_t(r);
+
+        REQUIRE( grid[r * width + c] ==
+                 Approx(bit::math::perlin::octave_noise( 4, 0.5, 1.5, x, y )).margin(1e-5) );
+      }
+    }
+  }
+}
+
+TEST_CASE("perlin::fill_grid_3d( const vec3&, const vec3&, std::size_t, std::size_t, std::size_t, float_t, float_t, float_t, float_t* )", "[fill_grid]")
+{
+  using bit::math::float_t;
+
+  const auto origin = bit::math::vec3{ -3.25, 1.5, 0.75 };
+  const auto step   = bit::math::vec3{ 0.125, 0.25, 0.5 };
+  const auto width  = std::size_t{9};
+  const auto height = std::size_t{7};
+  const auto depth  = std::size_t{5};
+
+  auto grid = std::vector<float_t>(width * height * depth);
+
+  bit::math::perlin::fill_grid_3d( origin, step, width, height, depth,
+                                   4, 0.5, 1.5, grid.data() );
+
+  SECTION("Each sample matches octave_noise")
+  {
+    for( auto s = std::size_t{0}; s < depth; ++s ) {
+      for( auto r = std::size_t{0}; r < height; ++r ) {
+        for( auto c = std::size_t{0}; c < width; ++c ) {
+          const auto x = origin.x() + step.x() * float_t(c);
+          const auto y = origin.y() + step.y() * float_t(r);
+          const auto z = origin.z() + step.z() * float_t(s);
+
+          REQUIRE( grid[(s * height + r) * width + c] ==
+                   bit::math::perlin::octave_noise( 4, 0.5, 1.5, x, y, z ) );
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,861 @@
+/**
+ * \file simplex.test.cpp
+ *
+ * \brief Unit tests for bit::math::simplex
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+
+#include <bit/math/simplex.hpp>
+
+#include <catch.hpp>
+
+#include <cmath>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+  // Tolerance used when comparing against the double-precision reference
+  // implementation; float evaluation loses a few bits near cell boundaries
+  constexpr double reference_tolerance = 1e-4;
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Raw Noise
+//----------------------------------------------------------------------------
+
+TEST_CASE("simplex::raw_noise( float_t, float_t )", "[raw_noise]")
+{
+  using bit::math::simplex::raw_noise;
+
+  SECTION("Matches reference values")
+  {
+    REQUIRE( raw_noise(0.3, 0.7) == Approx(0.2552206).margin(reference_tolerance) );
+    REQUIRE( raw_noise(1.5, -2.25) == Approx(0.5124782).margin(reference_tolerance) );
+    REQUIRE( raw_noise(0.1, 0.1) == Approx(-0.3717175).margin(reference_tolerance) );
+    REQUIRE( raw_noise(-7.25, -1.5) == Approx(-0.4559094).margin(reference_tolerance) );
+  }
+
+  SECTION("Does not vanish far from the origin")
+  {
+    REQUIRE( raw_noise(88.8, -50.4) == Approx(0.6336591).margin(reference_tolerance) );
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("simplex::raw_noise( float_t, float_t, float_t )", "[raw_noise]")
+{
+  using bit::math::simplex::raw_noise;
+
+  SECTION("Matches reference values")
+  {
+    REQUIRE( raw_noise(0.3, 0.7, 0.1) == Approx(0.0093789).margin(reference_tolerance) );
+    REQUIRE( raw_noise(1.5, -2.25, 3.75) == Approx(-0.5694052).margin(reference_tolerance) );
+    REQUIRE( raw_noise(-3.1, 4.2, -0.6) == Approx(-0.5863736).margin(reference_tolerance) );
+    REQUIRE( raw_noise(10.5, 0.25, 7.125) == Approx(-0.7479118).margin(reference_tolerance) );
+  }
+
+  SECTION("Is zero on lattice points")
+  {
+    REQUIRE( raw_noise(0, 0, 0) == Approx(0.0) );
+    REQUIRE( raw_noise(2, -1, 5) == Approx(0.0) );
+  }
+
+  SECTION("Stays within [-1,1]")
+  {
+    for( auto i = 0; i < 4096; ++i ) {
+      const auto x = (i % 97) * 0.173 - 8.0;
+      const auto y = (i % 89) * 0.211 - 9.0;
+      const auto z = (i % 83) * 0.097 - 4.0;
+      const auto n = raw_noise(x, y, z);
+
+      REQUIRE( n >= -1.0 );
+      REQUIRE( n <= 1.0 );
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("simplex::raw_noise( float_t, float_t, float_t, float_t )", "[raw_noise]")
+{
+  using bit::math::simplex::raw_noise;
+
+  SECTION("Matches reference values")
+  {
+    REQUIRE( raw_noise(0.3, 0.7, 0.1, 0.9) == Approx(0.1074070).margin(reference_tolerance) );
+    REQUIRE( raw_noise(-3.1, 4.2, -0.6, 2.2) == Approx(-0.0388852).margin(reference_tolerance) );
+    REQUIRE( raw_noise(10.5, 0.25, 7.125, -4.75) == Approx(0.5264801).margin(reference_tolerance) );
+    REQUIRE( raw_noise(-7.25, -1.5, -2.5, -0.125) == Approx(-0.4817216).margin(reference_tolerance) );
+  }
+
+  SECTION("Is zero on lattice points")
+  {
+    REQUIRE( raw_noise(0, 0, 0, 0) == Approx(0.0) );
+  }
+
+  SECTION("Stays within [-1,1]")
+  {
+    for( auto i = 0; i < 4096; ++i ) {
+      const auto x = (i % 97) * 0.173 - 8.0;
+      const auto y = (i % 89) * 0.211 - 9.0;
+      const auto z = (i % 83) * 0.097 - 4.0;
+      const auto w = (i % 7) * 0.31;
+      const auto n = raw_noise(x, y, z, w);
+
+      REQUIRE( n >= -1.0 );
+      REQUIRE( n <= 1.0 );
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("simplex::raw_noise( const vec4& )", "[raw_noise]")
+{
+  using bit::math::simplex::raw_noise;
+
+  const auto pos = bit::math::vec4{1.5, -2.25, 3.75, 0.5};
+
+  REQUIRE( raw_noise(pos) == raw_noise(pos.x(), pos.y(), pos.z(), pos.w()) );
+}
+
+//----------------------------------------------------------------------------
+// Octave Noise
+//----------------------------------------------------------------------------
+
+TEST_CASE("simplex::octave_noise( float_t, float_t, float_t, float_t, float_t, float_t )", "[octave_noise]")
+{
+  using bit::math::simplex::octave_noise;
+  using bit::math::simplex::raw_noise;
+
+  SECTION("A single octave is the scaled raw noise")
+  {
+    REQUIRE( octave_noise(1, 0.5, 2.0, 0.3, 0.7, 0.1) == raw_noise(0.6, 1.4, 0.2) );
+  }
+
+  SECTION("Octaves are normalized to [-1,1]")
+  {
+    for( auto i = 0; i < 1024; ++i ) {
+      const auto n = octave_noise(6, 0.5, 0.25, i * 0.37, i * 0.11, i * 0.53);
+
+      REQUIRE( n >= -1.0 );
+      REQUIRE( n <= 1.0 );
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// Octave Schedule
+//----------------------------------------------------------------------------
+
+TEST_CASE("octave_schedule::octave_schedule( float_t, float_t, float_t )", "[ctor][octave_schedule]")
+{
+  const auto schedule = bit::math::octave_schedule{ 4, 0.5, 2.0 };
+
+  SECTION("Precomputes each octave")
+  {
+    REQUIRE( schedule.octaves() == 4u );
+    REQUIRE( schedule.frequency(0) == 2.0 );
+    REQUIRE( schedule.frequency(3) == 16.0 );
+    REQUIRE( schedule.amplitude(0) == 1.0 );
+    REQUIRE( schedule.amplitude(3) == 0.125 );
+    REQUIRE( schedule.max_amplitude() == 1.875 );
+  }
+
+  SECTION("Never settles early")
+  {
+    REQUIRE( schedule.quantum() == 0 );
+    REQUIRE_FALSE( schedule.is_settled( 0, 0.5 ) );
+  }
+}
+
+TEST_CASE("octave_schedule::octave_schedule( float_t, float_t, float_t ) clamps the octaves", "[ctor][octave_schedule]")
+{
+  using bit::math::octave_schedule;
+
+  SECTION("Truncates counts above max_octaves")
+  {
+    const auto max_octaves = std::size_t{ octave_schedule::max_octaves };
+    const auto schedule    = octave_schedule{ 1000, 0.5, 1.0 };
+    const auto full        = octave_schedule{ float(max_octaves), 0.5, 1.0 };
+
+    REQUIRE( schedule.octaves() == max_octaves );
+    REQUIRE( schedule.max_amplitude() == full.max_amplitude() );
+  }
+
+  SECTION("Has no octaves for negative counts")
+  {
+    const auto schedule = octave_schedule{ -3, 0.5, 1.0 };
+
+    REQUIRE( schedule.octaves() == 0u );
+    REQUIRE( schedule.max_amplitude() == 0 );
+  }
+}
+
+TEST_CASE("simplex::octave_noise( const octave_schedule&, float_t, float_t, float_t )", "[octave_noise][octave_schedule]")
+{
+  using bit::math::simplex::octave_noise;
+
+  const auto schedule = bit::math::octave_schedule{ 6, 0.5, 0.25 };
+
+  SECTION("Matches octave_noise exactly")
+  {
+    for( auto i = 0; i < 256; ++i ) {
+      const auto x = bit::math::float_t(i * 0.37);
+      const auto y = bit::math::float_t(i * -0.11);
+      const auto z = bit::math::float_t(i * 0.53);
+
+      REQUIRE( octave_noise( schedule, x, y ) ==
+               octave_noise( 6, 0.5, 0.25, x, y ) );
+      REQUIRE( octave_noise( schedule, x, y, z ) ==
+               octave_noise( 6, 0.5, 0.25, x, y, z ) );
+      REQUIRE( octave_noise( schedule, x, y, z, x ) ==
+               octave_noise( 6, 0.5, 0.25, x, y, z, x ) );
+    }
+  }
+}
+
+TEST_CASE("octave_schedule::octave_schedule( float_t, float_t, float_t, float_t )", "[ctor][octave_schedule]")
+{
+  using bit::math::simplex::octave_noise;
+
+  const auto quantum  = bit::math::float_t(2.0 / 255.0);
+  const auto full     = bit::math::octave_schedule{ 8, 0.5, 0.25 };
+  const auto early    = bit::math::octave_schedule{ 8, 0.5, 0.25, quantum };
+  const auto quantize = [&]( bit::math::float_t n ) {
+    return static_cast<int>( std::floor( (n + 1) / quantum ) );
+  };
+
+  SECTION("Quantizes identically to the full sum")
+  {
+    for( auto i = 0; i < 1024; ++i ) {
+      const auto x = bit::math::float_t(i * 0.37);
+      const auto y = bit::math::float_t(i * -0.11);
+      const auto z = bit::math::float_t(i * 0.53);
+
+      REQUIRE( quantize( octave_noise( early, x, y ) ) ==
+               quantize( octave_noise( full, x, y ) ) );
+      REQUIRE( quantize( octave_noise( early, x, y, z ) ) ==
+               quantize( octave_noise( full, x, y, z ) ) );
+    }
+  }
+
+  SECTION("Settles once the remaining octaves are below the quantum")
+  {
+    REQUIRE( early.is_settled( 7, 0.3 ) );
+    REQUIRE_FALSE( early.is_settled( 0, 0.3 ) );
+  }
+}
+
+TEST_CASE("simplex::batch_octave_noise( const octave_schedule&, const float_t*, const float_t*, float_t*, std::size_t )", "[octave_noise][octave_schedule][batch]")
+{
+  using bit::math::float_t;
+
+  // Not a multiple of any lane width, to exercise the tail
+  const auto n = std::size_t{1027};
+
+  auto xs  = std::vector<float_t>(n);
+  auto ys  = std::vector<float_t>(n);
+  auto out = std::vector<float_t>(n);
+
+  for( auto i = std::size_t{0}; i < n; ++i ) {
+    xs[i] = float_t(i) * float_t(0.173) - float_t(40.0);
+    ys[i] = float_t(i) * float_t(-0.091) + float_t(12.5);
+  }
+
+  SECTION("Matches the scalar implementation")
+  {
+    const auto schedule = bit::math::octave_schedule{ 5, 0.5, 0.5 };
+
+    bit::math::simplex::batch_octave_noise( schedule, xs.data(), ys.data(),
+                                            out.data(), n );
+
+    for( auto i = std::size_t{0}; i < n; ++i ) {
+      REQUIRE( out[i] == Approx(bit::math::simplex::octave_noise(schedule, xs[i], ys[i])).margin(1e-5) );
+    }
+  }
+
+  SECTION("Stays within one quantum of the full sum with early termination")
+  {
+    const auto quantum  = float_t(2.0 / 255.0);
+    const auto full     = bit::math::octave_schedule{ 8, 0.5, 0.5 };
+    const auto early    = bit::math::octave_schedule{ 8, 0.5, 0.5, quantum };
+
+    bit::math::simplex::batch_octave_noise( early, xs.data(), ys.data(),
+                                            out.data(), n );
+
+    for( auto i = std::size_t{0}; i < n; ++i ) {
+      REQUIRE( out[i] == Approx(bit::math::simplex::octave_noise(full, xs[i], ys[i])).margin(quantum) );
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// Noise Gradients
+//----------------------------------------------------------------------------
+
+namespace {
+  // Step and tolerance used when comparing the analytic gradients against
+  // central differences
+  constexpr double difference_step      = 1e-3;
+  constexpr double difference_tolerance = 1e-2;
+} // anonymous namespace
+
+TEST_CASE("simplex::raw_noise_with_gradient( float_t, float_t, vec2* )", "[raw_noise][gradient]")
+{
+  using bit::math::simplex::raw_noise;
+  using bit::math::simplex::raw_noise_with_gradient;
+
+  const auto h = bit::math::float_t(difference_step);
+
+  for( auto i = 0; i < 64; ++i ) {
+    const auto x = bit::math::float_t(i * 0.37 - 11.0);
+    const auto y = bit::math::float_t(i * 0.23 + 3.5);
+
+    auto gradient = bit::math::vec2{};
+    const auto n = raw_noise_with_gradient( x, y, &gradient );
+
+    SECTION("Value matches raw_noise at sample " + std::to_string(i))
+    {
+      REQUIRE( n == Approx(raw_noise(x, y)).margin(1e-5) );
+    }
+
+    SECTION("Gradient matches central differences at sample " + std::to_string(i))
+    {
+      const auto dx = (raw_noise(x + h, y) - raw_noise(x - h, y)) / (2 * h);
+      const auto dy = (raw_noise(x, y + h) - raw_noise(x, y - h)) / (2 * h);
+
+      REQUIRE( gradient.x() == Approx(dx).margin(difference_tolerance) );
+      REQUIRE( gradient.y() == Approx(dy).margin(difference_tolerance) );
+    }
+  }
+}
+
+TEST_CASE("simplex::raw_noise_with_gradient( float_t, float_t, float_t, vec3* )", "[raw_noise][gradient]")
+{
+  using bit::math::simplex::raw_noise;
+  using bit::math::simplex::raw_noise_with_gradient;
+
+  const auto h = bit::math::float_t(difference_step);
+
+  for( auto i = 0; i < 64; ++i ) {
+    const auto x = bit::math::float_t(i * 0.37 - 11.0);
+    const auto y = bit::math::float_t(i * 0.23 + 3.5);
+    const auto z = bit::math::float_t(i * -0.41 + 1.25);
+
+    auto gradient = bit::math::vec3{};
+    const auto n = raw_noise_with_gradient( x, y, z, &gradient );
+
+    SECTION("Value matches raw_noise at sample " + std::to_string(i))
+    {
+      REQUIRE( n == Approx(raw_noise(x, y, z)).margin(1e-5) );
+    }
+
+    SECTION("Gradient matches central differences at sample " + std::to_string(i))
+    {
+      const auto dx = (raw_noise(x + h, y, z) - raw_noise(x - h, y, z)) / (2 * h);
+      const auto dy = (raw_noise(x, y + h, z) - raw_noise(x, y - h, z)) / (2 * h);
+      const auto dz = (raw_noise(x, y, z + h) - raw_noise(x, y, z - h)) / (2 * h);
+
+      REQUIRE( gradient.x() == Approx(dx).margin(difference_tolerance) );
+      REQUIRE( gradient.y() == Approx(dy).margin(difference_tolerance) );
+      REQUIRE( gradient.z() == Approx(dz).margin(difference_tolerance) );
+    }
+  }
+}
+
+TEST_CASE("simplex::octave_noise_with_gradient( float_t, float_t, float_t, float_t, float_t, vec2* )", "[octave_noise][gradient]")
+{
+  using bit::math::simplex::octave_noise;
+  using bit::math::simplex::octave_noise_with_gradient;
+
+  const auto h = bit::math::float_t(difference_step * 0.25);
+
+  for( auto i = 0; i < 32; ++i ) {
+    const auto x = bit::math::float_t(i * 0.37 - 11.0);
+    const auto y = bit::math::float_t(i * 0.23 + 3.5);
+
+    auto gradient = bit::math::vec2{};
+    const auto n = octave_noise_with_gradient( 4, 0.5, 0.75, x, y, &gradient );
+
+    SECTION("Value matches octave_noise at sample " + std::to_string(i))
+    {
+      REQUIRE( n == Approx(octave_noise(4, 0.5, 0.75, x, y)).margin(1e-5) );
+    }
+
+    SECTION("Gradient matches central differences at sample " + std::to_string(i))
+    {
+      const auto dx = (octave_noise(4, 0.5, 0.75, x + h, y) -
+                       octave_noise(4, 0.5, 0.75, x - h, y)) / (2 * h);
+      const auto dy = (octave_noise(4, 0.5, 0.75, x, y + h) -
+                       octave_noise(4, 0.5, 0.75, x, y - h)) / (2 * h);
+
+      REQUIRE( gradient.x() == Approx(dx).margin(difference_tolerance) );
+      REQUIRE( gradient.y() == Approx(dy).margin(difference_tolerance) );
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// Grid Fill
+//----------------------------------------------------------------------------
+
+TEST_CASE("simplex::fill_grid_2d( const vec2&, const vec2&, std::size_t, std::size_t, float_t, float_t, float_t, float_t* )", "[fill_grid]")
+{
+  using bit::math::float_t;
+
+  const auto origin = bit::math::vec2{-3.5, 1.25};
+  const auto step   = bit::math::vec2{0.125, 0.375};
+  const auto width  = std::size_t{13};
+  const auto height = std::size_t{7};
+
+  float_t grid[width * height];
+  bit::math::simplex::fill_grid_2d( origin, step, width, height,
+                                    5, 0.5, 0.75, grid );
+
+  SECTION("Each sample matches octave_noise")
+  {
+    for( auto r = std::size_t{0}; r < height; ++r ) {
+      for( auto c = std::size_t{0}; c < width; ++c ) {
+        const auto x = origin.x() + step.x() * float_t(c);
+        const auto y = origin.y() + step.y() * float_t(r);
+
+        REQUIRE( grid[r * width + c] ==
+                 Approx(bit::math::simplex::octave_noise( 5, 0.5, 0.75, x, y )).margin(1e-5) );
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("simplex::fill_grid_3d( const vec3&, const vec3&, std::size_t, std::size_t, std::size_t, float_t, float_t, float_t, float_t* )", "[fill_grid]")
+{
+  using bit::math::float_t;
+
+  const auto origin = bit::math::vec3{-3.5, 1.25, 0.5};
+  const auto step   = bit::math::vec3{0.125, 0.375, 0.25};
+  const auto width  = std::size_t{9};
+  const auto height = std::size_t{5};
+  const auto depth  = std::size_t{4};
+
+  float_t grid[width * height * depth];
+  bit::math::simplex::fill_grid_3d( origin, step, width, height, depth,
+                                    4, 0.5, 1.5, grid );
+
+  SECTION("Each sample matches octave_noise")
+  {
+    for( auto s = std::size_t{0}; s < depth; ++s ) {
+      for( auto r = std::size_t{0}; r < height; ++r ) {
+        for( auto c = std::size_t{0}; c < width; ++c ) {
+          const auto x = origin.x() + step.x() * float_t(c);
+          const auto y = origin.y() + step.y() * float_t(r);
+          const auto z = origin.z() + step.z() * float_t(s);
+
+          REQUIRE( grid[(s * height + r) * width + c] ==
+                   Approx(bit::math::simplex::octave_noise( 4, 0.5, 1.5, x, y, z )).margin(1e-5) );
+        }
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// Batch Noise
+//----------------------------------------------------------------------------
+
+TEST_CASE("simplex::batch_raw_noise( const float_t*, const float_t*, float_t*, std::size_t )", "[raw_noise][batch]")
+{
+  using bit::math::float_t;
+  using bit::math::simplex::raw_noise;
+
+  // An odd count exercises both the full lanes and the padded tail
+  constexpr auto count = std::size_t{1027};
+
+  float_t x[count];
+  float_t y[count];
+  float_t out[count];
+
+  for( auto i = std::size_t{0}; i < count; ++i ) {
+    x[i] = float_t(i % 61) * float_t(0.23) - float_t(7.0);
+    y[i] = float_t(i % 53) * float_t(-0.31) + float_t(4.0);
+  }
+  // Include lattice-aligned and negative integer coordinates
+  x[0] = 0; y[0] = 0;
+  x[1] = -2; y[1] = -3;
+
+  bit::math::simplex::batch_raw_noise( x, y, out, count );
+
+  SECTION("Matches the scalar implementation")
+  {
+    for( auto i = std::size_t{0}; i < count; ++i ) {
+      REQUIRE( out[i] == Approx(raw_noise( x[i], y[i] )).margin(1e-5) );
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// Parallel Grid Fill
+//----------------------------------------------------------------------------
+
+TEST_CASE("simplex::parallel_fill_grid_2d( const vec2&, const vec2&, std::size_t, std::size_t, float_t, float_t, float_t, float_t*, std::size_t )", "[fill_grid][parallel]")
+{
+  using bit::math::float_t;
+
+  const auto origin = bit::math::vec2{-10.0, 3.0};
+  const auto step   = bit::math::vec2{0.0625, 0.03125};
+
+  // Not a multiple of the tile size, so edge tiles are partial
+  const auto width  = std::size_t{150};
+  const auto height = std::size_t{97};
+
+  auto expected = std::vector<float_t>(width * height);
+  auto actual   = std::vector<float_t>(width * height);
+
+  bit::math::simplex::fill_grid_2d( origin, step, width, height,
+                                    4, 0.5, 0.5, expected.data() );
+
+  for( auto threads : {1, 3, 8, 0} ) {
+    SECTION("Matches the single-threaded fill with " + std::to_string(threads) + " threads")
+    {
+      bit::math::simplex::parallel_fill_grid_2d( origin, step, width, height,
+                                                 4, 0.5, 0.5, actual.data(),
+                                                 threads );
+      REQUIRE( actual == expected );
+    }
+  }
+
+  SECTION("Matches the single-threaded fill when fills run concurrently")
+  {
+    // Fills that find the worker pool busy run on their own thread
+    auto results = std::vector<std::vector<float_t>>( 4, std::vector<float_t>(width * height) );
+    auto callers = std::vector<std::thread>{};
+
+    for( auto& result : results ) {
+      callers.emplace_back( [&]{
+        bit::math::simplex::parallel_fill_grid_2d( origin, step, width, height,
+                                                   4, 0.5, 0.5, result.data(),
+                                                   4 );
+      });
+    }
+    for( auto& caller : callers ) {
+      caller.join();
+    }
+
+    for( const auto& result : results ) {
+      REQUIRE( result == expected );
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("simplex::parallel_fill_grid_3d( const vec3&, const vec3&, std::size_t, std::size_t, std::size_t, float_t, float_t, float_t, float_t*, std::size_t )", "[fill_grid][parallel]")
+{
+  using bit::math::float_t;
+
+  const auto origin = bit::math::vec3{-10.0, 3.0, 0.5};
+  const auto step   = bit::math::vec3{0.0625, 0.03125, 0.125};
+  const auto width  = std::size_t{37};
+  const auto height = std::size_t{20};
+  const auto depth  = std::size_t{18};
+
+  auto expected = std::vector<float_t>(width * height * depth);
+  auto actual   = std::vector<float_t>(width * height * depth);
+
+  bit::math::simplex::fill_grid_3d( origin, step, width, height, depth,
+                                    3, 0.5, 0.5, expected.data() );
+
+  for( auto threads : {1, 4, 0} ) {
+    SECTION("Matches the single-threaded fill with " + std::to_string(threads) + " threads")
+    {
+      bit::math::simplex::parallel_fill_grid_3d( origin, step,
+                                                 width, height, depth,
+                                                 3, 0.5, 0.5, actual.data(),
+                                                 threads );
+      REQUIRE( actual == expected );
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// simplex_generator
+//----------------------------------------------------------------------------
+
+TEST_CASE("simplex_generator::simplex_generator( std::uint64_t )", "[ctor][generator]")
+{
+  const auto a = bit::math::simplex_generator{42};
+  const auto b = bit::math::simplex_generator{42};
+  const auto c = bit::math::simplex_generator{43};
+
+  SECTION("Stores the seed")
+  {
+    REQUIRE( a.seed() == 42 );
+  }
+
+  SECTION("Equal seeds produce identical noise")
+  {
+    for( auto i = 0; i < 256; ++i ) {
+      REQUIRE( a.raw_noise(i * 0.37, i * -0.21, i * 0.11) ==
+               b.raw_noise(i * 0.37, i * -0.21, i * 0.11) );
+    }
+  }
+
+  SECTION("Different seeds produce different noise")
+  {
+    auto differences = 0;
+    for( auto i = 0; i < 256; ++i ) {
+      if( a.raw_noise(i * 0.37, i * -0.21) != c.raw_noise(i * 0.37, i * -0.21) ) {
+        ++differences;
+      }
+    }
+    REQUIRE( differences > 200 );
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("simplex_generator::raw_noise( float_t, float_t, float_t, float_t )", "[raw_noise][generator]")
+{
+  const auto generator = bit::math::simplex_generator{0xdeadbeef};
+
+  SECTION("Stays within [-1,1]")
+  {
+    for( auto i = 0; i < 4096; ++i ) {
+      const auto n = generator.raw_noise( (i % 97) * 0.173 - 8.0,
+                                          (i % 89) * 0.211 - 9.0,
+                                          (i % 83) * 0.097 - 4.0,
+                                          (i % 7) * 0.31 );
+      REQUIRE( n >= -1.0 );
+      REQUIRE( n <= 1.0 );
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("simplex_generator::fill_grid_2d( const vec2&, const vec2&, std::size_t, std::size_t, float_t, float_t, float_t, float_t* )", "[fill_grid][generator]")
+{
+  using bit::math::float_t;
+
+  const auto generator = bit::math::simplex_generator{7};
+  const auto origin    = bit::math::vec2{2.0, -1.0};
+  const auto step      = bit::math::vec2{0.25, 0.5};
+  const auto width     = std::size_t{70};
+  const auto height    = std::size_t{66};
+
+  auto grid     = std::vector<float_t>(width * height);
+  auto parallel = std::vector<float_t>(width * height);
+  generator.fill_grid_2d( origin, step, width, height,
+                          3, 0.5, 0.5, grid.data() );
+  generator.parallel_fill_grid_2d( origin, step, width, height,
+                                   3, 0.5, 0.5, parallel.data(), 4 );
+
+  SECTION("Each sample matches octave_noise")
+  {
+    for( auto r = std::size_t{0}; r < height; ++r ) {
+      for( auto c = std::size_t{0}; c < width; ++c ) {
+        const auto x = origin.x() + step.x() * float_t(c);
+        const auto y = origin.y() + step.y() * float_t(r);
+
+        REQUIRE( grid[r * width + c] ==
+                 Approx(generator.octave_noise( 3, 0.5, 0.5, x, y )).margin(1e-5) );
+      }
+    }
+  }
+
+  SECTION("Parallel fill matches the single-threaded fill")
+  {
+    REQUIRE( parallel == grid );
+  }
+}
+
+TEST_CASE("simplex_generator::fill_grid_3d( const vec3&, const vec3&, std::size_t, std::size_t, std::size_t, float_t, float_t, float_t, float_t* )", "[fill_grid][generator]")
+{
+  using bit::math::float_t;
+
+  const auto generator = bit::math::simplex_generator{11};
+  const auto origin    = bit::math::vec3{-4.0, 2.5, 7.25};
+  const auto step      = bit::math::vec3{0.3, 0.45, 0.35};
+  const auto width     = std::size_t{21};
+  const auto height    = std::size_t{11};
+  const auto depth     = std::size_t{9};
+
+  auto grid = std::vector<float_t>(width * height * depth);
+  generator.fill_grid_3d( origin, step, width, height, depth,
+                          3, 0.5, 0.75, grid.data() );
+
+  SECTION("Each sample matches octave_noise")
+  {
+    for( auto s = std::size_t{0}; s < depth; ++s ) {
+      for( auto r = std::size_t{0}; r < height; ++r ) {
+        for( auto c = std::size_t{0}; c < width; ++c ) {
+          const auto x = origin.x() + step.x() * float_t(c);
+          const auto y = origin.y() + step.y() * float_t(r);
+          const auto z = origin.z() + step.z() * float_t(s);
+
+          REQUIRE( grid[(s * height + r) * width + c] ==
+                   Approx(generator.octave_noise( 3, 0.5, 0.75, x, y, z )).margin(1e-5) );
+        }
+      }
+    }
+  }
+}
+
+TEST_CASE("simplex_generator::raw_noise_with_gradient( float_t, float_t, vec2* )", "[raw_noise][gradient][generator]")
+{
+  const auto generator = bit::math::simplex_generator{0xc0ffee};
+  const auto h = bit::math::float_t(difference_step);
+
+  for( auto i = 0; i < 32; ++i ) {
+    const auto x = bit::math::float_t(i * 0.37 - 11.0);
+    const auto y = bit::math::float_t(i * 0.23 + 3.5);
+
+    auto gradient = bit::math::vec2{};
+    const auto n = generator.raw_noise_with_gradient( x, y, &gradient );
+
+    SECTION("Matches raw_noise and central differences at sample " + std::to_string(i))
+    {
+      const auto dx = (generator.raw_noise(x + h, y) - generator.raw_noise(x - h, y)) / (2 * h);
+      const auto dy = (generator.raw_noise(x, y + h) - generator.raw_noise(x, y - h)) / (2 * h);
+
+      REQUIRE( n == Approx(generator.raw_noise(x, y)).margin(1e-5) );
+      REQUIRE( gradient.x() == Approx(dx).margin(difference_tolerance) );
+      REQUIRE( gradient.y() == Approx(dy).margin(difference_tolerance) );
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// Noise Pipeline
+//----------------------------------------------------------------------------
+
+TEST_CASE("noise_pipeline::evaluate( float_t, float_t )", "[noise_pipeline]")
+{
+  using bit::math::noise_pipeline;
+
+  const auto schedule = bit::math::octave_schedule{ 5, 0.5, 0.25 };
+  const auto warp     = bit::math::octave_schedule{ 3, 0.5, 0.125 };
+
+  SECTION("An fbm pipeline without warps is octave_noise")
+  {
+    const auto pipeline = noise_pipeline{ schedule };
+
+    for( auto i = 0; i < 256; ++i ) {
+      const auto x = bit::math::float_t(i * 0.37);
+      const auto y = bit::math::float_t(i * -0.11);
+
+      REQUIRE( pipeline.evaluate( x, y ) ==
+               bit::math::simplex::octave_noise( schedule, x, y ) );
+    }
+  }
+
+  SECTION("A warp with no strength does not change the result")
+  {
+    auto warped = noise_pipeline{ schedule, noise_pipeline::fractal::ridged };
+    warped.add_warp( warp, 0 );
+    const auto plain = noise_pipeline{ schedule, noise_pipeline::fractal::ridged };
+
+    for( auto i = 0; i < 256; ++i ) {
+      const auto x = bit::math::float_t(i * 0.37);
+      const auto y = bit::math::float_t(i * -0.11);
+
+      REQUIRE( warped.evaluate( x, y ) == plain.evaluate( x, y ) );
+    }
+  }
+
+  SECTION("A warp displaces the sample coordinates")
+  {
+    auto warped = noise_pipeline{ schedule };
+    warped.add_warp( warp, 4 );
+    const auto plain = noise_pipeline{ schedule };
+
+    auto differences = 0;
+    for( auto i = 0; i < 256; ++i ) {
+      const auto x = bit::math::float_t(i * 0.37);
+      const auto y = bit::math::float_t(i * -0.11);
+
+      if( warped.evaluate( x, y ) != plain.evaluate( x, y ) ) ++differences;
+    }
+    REQUIRE( differences > 200 );
+  }
+
+  SECTION("Warps beyond max_warps are ignored")
+  {
+    const std::size_t max_warps = noise_pipeline::max_warps;
+
+    auto full = noise_pipeline{ schedule };
+    auto over = noise_pipeline{ schedule };
+    for( auto i = std::size_t{0}; i < max_warps; ++i ) {
+      full.add_warp( warp, 1 );
+      over.add_warp( warp, 1 );
+    }
+    over.add_warp( warp, 4 );
+
+    REQUIRE( over.warps() == max_warps );
+
+    for( auto i = 0; i < 64; ++i ) {
+      const auto x = bit::math::float_t(i * 0.37);
+      const auto y = bit::math::float_t(i * -0.11);
+
+      REQUIRE( over.evaluate( x, y ) == full.evaluate( x, y ) );
+    }
+  }
+
+  SECTION("Every fractal stays within [-1,1]")
+  {
+    for( auto type : { noise_pipeline::fractal::fbm,
+                       noise_pipeline::fractal::ridged,
+                       noise_pipeline::fractal::billow } ) {
+      auto pipeline = noise_pipeline{ schedule, type };
+      pipeline.add_warp( warp, 2 ).add_warp( warp, 1 );
+
+      for( auto i = 0; i < 1024; ++i ) {
+        const auto n = pipeline.evaluate( i * 0.37, i * -0.11 );
+
+        REQUIRE( n >= -1.0 );
+        REQUIRE( n <= 1.0 );
+      }
+    }
+  }
+}
+
+TEST_CASE("noise_pipeline::evaluate( const float_t*, const float_t*, float_t*, std::size_t )", "[noise_pipeline][batch]")
+{
+  using bit::math::float_t;
+  using bit::math::noise_pipeline;
+
+  const auto schedule = bit::math::octave_schedule{ 5, 0.5, 0.25 };
+  const auto warp     = bit::math::octave_schedule{ 3, 0.5, 0.125 };
+
+  // Not a multiple of any lane width, to exercise the tail
+  const auto n = std::size_t{1027};
+
+  auto xs  = std::vector<float_t>(n);
+  auto ys  = std::vector<float_t>(n);
+  auto out = std::vector<float_t>(n);
+
+  for( auto i = std::size_t{0}; i < n; ++i ) {
+    xs[i] = float_t(i) * float_t(0.173) - float_t(40.0);
+    ys[i] = float_t(i) * float_t(-0.091) + float_t(12.5);
+  }
+
+  for( auto type : { noise_pipeline::fractal::fbm,
+                     noise_pipeline::fractal::ridged,
+                     noise_pipeline::fractal::billow } ) {
+    auto pipeline = noise_pipeline{ schedule, type };
+    pipeline.add_warp( warp, 2 ).add_warp( warp, 1 );
+
+    SECTION("Matches the scalar evaluation for fractal " + std::to_string(static_cast<int>(type)))
+    {
+      pipeline.evaluate( xs.data(), ys.data(), out.data(), n );
+
+      for( auto i = std::size_t{0}; i < n; ++i ) {
+        REQUIRE( out[i] == Approx(pipeline.evaluate(xs[i], ys[i])).margin(1e-3) );
+      }
+    }
+  }
+}
@@ -0,0 +1,259 @@
+/**
+ * \file spline.test.cpp
+ *
+ * \brief Unit tests for the spline evaluators and bit::math::spline
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+
+#include <bit/math/spline.hpp>
+
+#include <catch.hpp>
+
+#include <random>
+#include <vector>
+
+namespace {
+
+  // Control points spaced increasingly far apart, so that the parameter
+  // does not move at a constant speed
+  std::vector<bit::math::vec2> make_points()
+  {
+    return {
+      { 0, 0 }, { 1, 0 }, { 2, 1 }, { 5, 1 }, { 9, -2 }, { 14, 0 }, { 20, 4 }
+    };
+  }
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Cubic Segments
+//----------------------------------------------------------------------------
+
+TEST_CASE("catmull_rom( const V&, const V&, const V&, const V&, T )", "[spline]")
+{
+  using bit::math::vec2;
+
+  const auto p0 = vec2{ -1, 2 };
+  const auto p1 = vec2{ 0, 0 };
+  const auto p2 = vec2{ 3, 1 };
+  const auto p3 = vec2{ 4, 5 };
+
+  SECTION("Passes through the inner points")
+  {
+    const auto start = bit::math::catmull_rom( p0, p1, p2, p3, 0.0 );
+    const auto end   = bit::math::catmull_rom( p0, p1, p2, p3, 1.0 );
+
+    REQUIRE( start.x() == Approx(p1.x()) );
+    REQUIRE( start.y() == Approx(p1.y()) );
+    REQUIRE( end.x() == Approx(p2.x()) );
+    REQUIRE( end.y() == Approx(p2.y()) );
+  }
+
+  SECTION("Follows evenly spaced collinear points linearly")
+  {
+    REQUIRE( bit::math::catmull_rom( 0.0, 1.0, 2.0, 3.0, 0.25 ) == Approx(1.25) );
+  }
+}
+
+TEST_CASE("bezier( const V&, const V&, const V&, const V&, T )", "[spline]")
+{
+  using bit::math::vec3;
+
+  const auto p0 = vec3{ 0, 0, 0 };
+  const auto p1 = vec3{ 0, 1, 0 };
+  const auto p2 = vec3{ 1, 1, 2 };
+  const auto p3 = vec3{ 1, 0, 2 };
+
+  SECTION("Passes through the end points")
+  {
+    const auto end = bit::math::bezier( p0, p1, p2, p3, 1.0 );
+
+    REQUIRE( bit::math::bezier( p0, p1, p2, p3, 0.0 ).x() == 0 );
+    REQUIRE( end.x() == Approx(1) );
+    REQUIRE( end.z() == Approx(2) );
+  }
+
+  SECTION("Evaluates the Bernstein weights")
+  {
+    const auto mid = bit::math::bezier( p0, p1, p2, p3, 0.5 );
+
+    REQUIRE( mid.x() == Approx(0.5) );
+    REQUIRE( mid.y() == Approx(0.75) );
+    REQUIRE( mid.z() == Approx(1) );
+  }
+}
+
+TEST_CASE("hermite( const V&, const V&, const V&, const V&, T )", "[spline]")
+{
+  SECTION("Passes through the end points")
+  {
+    REQUIRE( bit::math::hermite( 2.0, 7.0, -1.0, 3.0, 0.0 ) == Approx(2) );
+    REQUIRE( bit::math::hermite( 2.0, 7.0, -1.0, 3.0, 1.0 ) == Approx(-1) );
+  }
+
+  SECTION("Is linear when both tangents are the chord")
+  {
+    REQUIRE( bit::math::hermite( 1.0, 4.0, 5.0, 4.0, 0.25 ) == Approx(2) );
+  }
+}
+
+TEST_CASE("bspline( const V&, const V&, const V&, const V&, T )", "[spline]")
+{
+  SECTION("Starts at the weighted average of the first three points")
+  {
+    REQUIRE( bit::math::bspline( 0.0, 6.0, 0.0, 0.0, 0.0 ) == Approx(4) );
+  }
+
+  SECTION("Is continuous between consecutive segments")
+  {
+    REQUIRE( bit::math::bspline( 1.0, 4.0, 2.0, 8.0, 1.0 ) ==
+             Approx(bit::math::bspline( 4.0, 2.0, 8.0, 3.0, 0.0 )) );
+  }
+}
+
+//----------------------------------------------------------------------------
+// spline<V>
+//----------------------------------------------------------------------------
+
+TEST_CASE("spline<V>::spline( spline_basis, std::vector<V>, size_type )", "[spline]")
+{
+  using bit::math::spline_basis;
+
+  SECTION("Catmull-Rom splines have a segment per inner point pair")
+  {
+    const auto s = bit::math::spline<bit::math::vec2>{ spline_basis::catmull_rom, make_points() };
+
+    REQUIRE( s.size() == 7 );
+    REQUIRE( s.segment_count() == 4 );
+  }
+
+  SECTION("Bezier segments share their end points")
+  {
+    const auto s = bit::math::spline<bit::math::vec2>{ spline_basis::bezier, make_points() };
+
+    REQUIRE( s.segment_count() == 2 );
+  }
+
+  SECTION("Hermite splines alternate points and tangents")
+  {
+    auto points = make_points();
+    points.pop_back();
+
+    const auto s = bit::math::spline<bit::math::vec2>{ spline_basis::hermite, points };
+
+    REQUIRE( s.segment_count() == 2 );
+  }
+}
+
+TEST_CASE("spline<V>::evaluate( float_t )", "[spline]")
+{
+  using bit::math::spline_basis;
+
+  const auto points = make_points();
+  const auto s = bit::math::spline<bit::math::vec2>{ spline_basis::catmull_rom, points };
+
+  SECTION("Selects the segment from the integral part")
+  {
+    const auto p = s.evaluate( 2.5 );
+    const auto expected = bit::math::catmull_rom( points[2], points[3], points[4], points[5], 0.5 );
+
+    REQUIRE( p.x() == Approx(expected.x()) );
+    REQUIRE( p.y() == Approx(expected.y()) );
+  }
+
+  SECTION("Clamps parameters outside of the spline")
+  {
+    REQUIRE( s.evaluate( -1 ).x() == Approx(points[1].x()) );
+    REQUIRE( s.evaluate( 10 ).x() == Approx(points[5].x()) );
+  }
+}
+
+TEST_CASE("spline<V>::length()", "[spline]")
+{
+  using bit::math::spline_basis;
+  using bit::math::vec2;
+
+  SECTION("Measures straight splines exactly")
+  {
+    const auto s = bit::math::spline<vec2>{
+      spline_basis::catmull_rom, { {-1,0}, {0,0}, {1,0}, {2,0}, {3,0} }
+    };
+
+    REQUIRE( s.length() == Approx(2) );
+  }
+
+  SECTION("Approximates curved splines")
+  {
+    // The standard cubic approximation of a unit quarter circle
+    const auto k = bit::math::float_t(0.5522847498);
+    const auto s = bit::math::spline<vec2>{
+      spline_basis::bezier, { {1,0}, {1,k}, {k,1}, {0,1} }, 64
+    };
+
+    REQUIRE( s.length() == Approx(bit::math::half_pi<bit::math::float_t>()).epsilon(1e-3) );
+  }
+}
+
+TEST_CASE("spline<V>::evaluate_at( float_t )", "[spline]")
+{
+  using bit::math::float_t;
+  using bit::math::spline_basis;
+
+  const auto s = bit::math::spline<bit::math::vec2>{ spline_basis::catmull_rom, make_points(), 64 };
+
+  SECTION("Starts and ends with the spline")
+  {
+    REQUIRE( s.evaluate_at( 0 ).x() == Approx(s.evaluate(0).x()) );
+    REQUIRE( s.evaluate_at( s.length() ).x() == Approx(s.evaluate(4).x()) );
+    REQUIRE( s.parameter_at( s.length() * 2 ) == Approx(4) );
+  }
+
+  SECTION("Moves at a constant speed")
+  {
+    const auto steps = 50;
+    const auto step  = s.length() / steps;
+
+    auto previous = s.evaluate_at( 0 );
+    for( auto i = 1; i <= steps; ++i ) {
+      const auto current = s.evaluate_at( step * float_t(i) );
+
+      // Chords through the tighter bends are slightly shorter than the arcs
+      REQUIRE( (current - previous).magnitude() == Approx(step).epsilon(3e-2) );
+      previous = current;
+    }
+  }
+}
+
+TEST_CASE("spline<V>::evaluate_at( const float_t*, V*, size_type )", "[spline]")
+{
+  using bit::math::float_t;
+  using bit::math::spline_basis;
+  using bit::math::vec2;
+
+  const auto s = bit::math::spline<vec2>{ spline_basis::bspline, make_points() };
+
+  auto engine = std::mt19937{7};
+  auto dist   = std::uniform_real_distribution<float_t>{ -1, s.length() + 1 };
+
+  auto distances = std::vector<float_t>{};
+  for( auto d = float_t(0); d < s.length(); d += float_t(0.1) ) {
+    distances.push_back( d );
+  }
+  for( auto i = 0; i < 100; ++i ) {
+    distances.push_back( dist(engine) );
+  }
+  auto out = std::vector<vec2>( distances.size() );
+
+  SECTION("Matches evaluating each distance individually")
+  {
+    s.evaluate_at( distances.data(), out.data(), distances.size() );
+
+    for( auto i = std::size_t{0}; i < distances.size(); ++i ) {
+      const auto expected = s.evaluate_at( distances[i] );
+
+      REQUIRE( out[i].x() == expected.x() );
+      REQUIRE( out[i].y() == expected.y() );
+    }
+  }
+}
@@ -0,0 +1,336 @@
+/**
+ * \file transform.test.cpp
+ *
+ * \brief Unit tests for bit::math::transform
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+
+#include <bit/math/transform.hpp>
+
+#include <catch.hpp>
+
+#include <cmath>
+#include <thread>
+#include <vector>
+
+namespace {
+
+  bit::math::vec3 apply( const bit::math::mat4& m, const bit::math::vec3& p )
+  {
+    const auto result = bit::math::vec4{ p.x(), p.y(), p.z(), 1 } * m;
+
+    return { result.x(), result.y(), result.z() };
+  }
+
+  bit::math::vec3 apply( const bit::math::mat3& m, const bit::math::vec3& v )
+  {
+    return {
+      m(0,0) * v.x() + m(0,1) * v.y() + m(0,2) * v.z(),
+      m(1,0) * v.x() + m(1,1) * v.y() + m(1,2) * v.z(),
+      m(2,0) * v.x() + m(2,1) * v.y() + m(2,2) * v.z()
+    };
+  }
+
+  bit::math::transform make_transform()
+  {
+    auto result = bit::math::transform{};
+    result.set_scale( 2, 3, 0.5 );
+    result.set_rotation( bit::math::radian(0.7), bit::math::vec3{1,2,3}.normalized() );
+    result.set_position( 10, -20, 30 );
+    return result;
+  }
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Observers
+//----------------------------------------------------------------------------
+
+TEST_CASE("transform::matrix()", "[observers]")
+{
+  using bit::math::vec3;
+
+  auto t = bit::math::transform{};
+
+  SECTION("Is the identity by default")
+  {
+    REQUIRE( t.matrix() == bit::math::mat4::identity );
+  }
+
+  SECTION("Scales, then rotates, then translates")
+  {
+    t.set_scale( 2, 3, 4 );
+    t.set_rotation( bit::math::radian( bit::math::half_pi<bit::math::float_t>() ), vec3{0,0,1} );
+    t.set_position( 10, 20, 30 );
+
+    const auto p = apply( t.matrix(), vec3{1,1,1} );
+
+    // (1,1,1) scales to (2,3,4), rotates to (-3,2,4), then translates
+    REQUIRE( p.x() == Approx(7) );
+    REQUIRE( p.y() == Approx(22) );
+    REQUIRE( p.z() == Approx(34) );
+  }
+}
+
+TEST_CASE("transform::inverse_matrix()", "[observers]")
+{
+  using bit::math::vec3;
+
+  auto t = make_transform();
+
+  SECTION("Is the identity by default")
+  {
+    REQUIRE( bit::math::transform{}.inverse_matrix() == bit::math::mat4::identity );
+  }
+
+  SECTION("Undoes matrix()")
+  {
+    const auto product = bit::math::detail::compose_affine( t.inverse_matrix(),
+                                                            t.matrix() );
+    for( auto r = 0; r < 4; ++r ) {
+      for( auto c = 0; c < 4; ++c ) {
+        REQUIRE( product(r,c) == Approx( r == c ? 1 : 0 ).margin(1e-5) );
+      }
+    }
+  }
+
+  SECTION("Is rebuilt after the transform changes")
+  {
+    t.inverse_matrix();
+    t.translate( 1, 1, 1 );
+
+    const auto p = apply( t.inverse_matrix(), apply( t.matrix(), vec3{4,5,6} ) );
+
+    REQUIRE( p.x() == Approx(4) );
+    REQUIRE( p.y() == Approx(5) );
+    REQUIRE( p.z() == Approx(6) );
+  }
+}
+
+TEST_CASE("transform::normal_matrix()", "[observers]")
+{
+  using bit::math::vec3;
+
+  const auto t = make_transform();
+
+  SECTION("Keeps normals perpendicular to transformed tangents")
+  {
+    const auto normal  = vec3{1,1,0};
+    const auto tangent = vec3{1,-1,4};
+
+    const auto m = t.matrix();
+    const auto transformed_tangent = vec3{
+      m(0,0) * tangent.x() + m(0,1) * tangent.y() + m(0,2) * tangent.z(),
+      m(1,0) * tangent.x() + m(1,1) * tangent.y() + m(1,2) * tangent.z(),
+      m(2,0) * tangent.x() + m(2,1) * tangent.y() + m(2,2) * tangent.z()
+    };
+    const auto transformed_normal = apply( t.normal_matrix(), normal );
+
+    REQUIRE( transformed_normal.dot(transformed_tangent) == Approx(0).margin(1e-4) );
+  }
+
+  SECTION("Is the rotation for a unit scale")
+  {
+    auto rotated = bit::math::transform{};
+    rotated.set_rotation( bit::math::radian(1.2), vec3{0,1,0} );
+
+    const auto expected = rotated.rotation().rotation_matrix();
+
+    for( auto r = 0; r < 3; ++r ) {
+      for( auto c = 0; c < 3; ++c ) {
+        REQUIRE( rotated.normal_matrix()(r,c) == Approx(expected(r,c)) );
+      }
+    }
+  }
+}
+
+TEST_CASE("transform::matrix() with concurrent readers", "[observers]")
+{
+  using bit::math::float_t;
+  using bit::math::vec3;
+
+  // Enough readers to contend even when the hardware has fewer threads
+  constexpr auto readers = 8;
+  constexpr auto rounds  = 200;
+
+  auto t = bit::math::transform{};
+  auto results  = std::vector<bit::math::mat4>( readers );
+  auto inverses = std::vector<bit::math::mat4>( readers );
+
+  SECTION("Every reader sees the rebuilt matrices")
+  {
+    for( auto round = 0; round < rounds; ++round ) {
+      t.set_position( float_t(round), 0, 0 );
+      t.rotate( bit::math::radian(0.01), vec3{0,1,0} );
+
+      const auto expected = bit::math::detail::compose_trs( t.position(),
+                                                            t.rotation(),
+                                                            t.scale() );
+      const auto expected_inverse = bit::math::detail::compose_inverse_trs( t.position(),
+                                                                            t.rotation(),
+                                                                            t.scale() );
+      auto threads = std::vector<std::thread>{};
+      for( auto i = 0; i < readers; ++i ) {
+        threads.emplace_back( [&t, &results, &inverses, i]{
+          results[i]  = t.matrix();
+          inverses[i] = t.inverse_matrix();
+        });
+      }
+      for( auto& thread : threads ) {
+        thread.join();
+      }
+
+      for( auto i = 0; i < readers; ++i ) {
+        REQUIRE( results[i] == expected );
+        REQUIRE( inverses[i] == expected_inverse );
+      }
+    }
+  }
+}
+
+TEST_CASE("transform::transform( const transform& )", "[constructors]")
+{
+  auto t = bit::math::transform{};
+  t.set_position( 1, 2, 3 );
+
+  SECTION("Copies a stale matrix as stale")
+  {
+    const auto copy = t;
+
+    REQUIRE( copy.matrix() == t.matrix() );
+  }
+
+  SECTION("Copies a rebuilt matrix")
+  {
+    t.matrix();
+    const auto copy = t;
+
+    REQUIRE( copy.matrix() == t.matrix() );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Modifiers
+//----------------------------------------------------------------------------
+
+TEST_CASE("transform::rotate( const quaternion& )", "[modifiers]")
+{
+  using bit::math::vec3;
+
+  const auto quarter_turn = bit::math::radian( bit::math::half_pi<bit::math::float_t>() );
+
+  auto t = bit::math::transform{};
+
+  SECTION("Composes with the current rotation")
+  {
+    t.rotate( quarter_turn, vec3{0,0,1} );
+    t.rotate( quarter_turn, vec3{0,0,1} );
+
+    const auto p = apply( t.matrix(), vec3{1,0,0} );
+
+    REQUIRE( p.x() == Approx(-1) );
+    REQUIRE( p.y() == Approx(0).margin(1e-6) );
+    REQUIRE( p.z() == Approx(0).margin(1e-6) );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Interpolation
+//----------------------------------------------------------------------------
+
+TEST_CASE("interpolate_transforms( const transform_snapshot*, const transform*, float_t, mat4*, std::size_t )", "[interpolation]")
+{
+  using bit::math::float_t;
+  using bit::math::vec3;
+
+  constexpr auto count = std::size_t{5};
+
+  auto transforms = std::vector<bit::math::transform>( count );
+  for( auto i = std::size_t{0}; i < count; ++i ) {
+    transforms[i].set_position( float_t(i), 0, 0 );
+  }
+
+  auto prev = std::vector<bit::math::transform_snapshot>( count );
+  for( auto i = std::size_t{0}; i < count; ++i ) {
+    prev[i] = transforms[i].snapshot();
+  }
+
+  // Simulate a step
+  for( auto& t : transforms ) {
+    t.translate( 0, 2, 0 );
+    t.set_scale( 3, 3, 3 );
+    t.rotate( bit::math::radian( bit::math::half_pi<float_t>() ), vec3{0,0,1} );
+  }
+
+  auto out = std::vector<bit::math::mat4>( count );
+
+  SECTION("Matches the previous state at alpha 0")
+  {
+    bit::math::interpolate_transforms( prev.data(), transforms.data(), 0,
+                                       out.data(), count );
+
+    for( auto i = std::size_t{0}; i < count; ++i ) {
+      const auto expected = bit::math::detail::compose_trs( prev[i].translation,
+                                                            prev[i].rotation,
+                                                            prev[i].scale );
+      REQUIRE( out[i] == expected );
+    }
+  }
+
+  SECTION("Matches the current state at alpha 1")
+  {
+    bit::math::interpolate_transforms( prev.data(), transforms.data(), 1,
+                                       out.data(), count );
+
+    for( auto i = std::size_t{0}; i < count; ++i ) {
+      for( auto r = 0; r < 4; ++r ) {
+        for( auto c = 0; c < 4; ++c ) {
+          REQUIRE( out[i](r,c) == Approx(transforms[i].matrix()(r,c)).margin(1e-6) );
+        }
+      }
+    }
+  }
+
+  SECTION("Interpolates each component halfway at alpha 0.5")
+  {
+    bit::math::interpolate_transforms( prev.data(), transforms.data(), 0.5,
+                                       out.data(), count );
+
+    // Scaled by 2 and rotated an eighth turn
+    const auto p = apply( out[1], vec3{1,0,0} );
+    const auto half_sqrt2 = std::sqrt( float_t(0.5) );
+
+    REQUIRE( p.x() == Approx( 1 + 2 * half_sqrt2 ) );
+    REQUIRE( p.y() == Approx( 1 + 2 * half_sqrt2 ) );
+    REQUIRE( p.z() == Approx(0).margin(1e-6) );
+  }
+}
+
+TEST_CASE("interpolate_transforms( const transform_snapshot*, const transform_snapshot*, float_t, mat4*, std::size_t )", "[interpolation]")
+{
+  using bit::math::float_t;
+  using bit::math::vec3;
+
+  auto prev = bit::math::transform_snapshot{};
+  auto curr = bit::math::transform_snapshot{};
+  curr.rotation = bit::math::quaternion{ bit::math::radian(0.5), vec3{0,1,0} };
+
+  auto out      = bit::math::mat4{};
+  auto expected = bit::math::mat4{};
+
+  SECTION("Takes the shorter arc between rotations")
+  {
+    bit::math::interpolate_transforms( &prev, &curr, 0.5, &expected, 1 );
+
+    // The negated quaternion is the same rotation
+    curr.rotation = -curr.rotation;
+    bit::math::interpolate_transforms( &prev, &curr, 0.5, &out, 1 );
+
+    for( auto r = 0; r < 4; ++r ) {
+      for( auto c = 0; c < 4; ++c ) {
+        REQUIRE( out(r,c) == Approx(expected(r,c)).margin(1e-6) );
+      }
+    }
+  }
+}
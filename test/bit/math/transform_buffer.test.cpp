@@ -0,0 +1,144 @@
+/**
+ * \file transform_buffer.test.cpp
+ *
+ * \brief Unit tests for bit::math::transform_buffer
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+
+#include <bit/math/transform_buffer.hpp>
+
+#include <catch.hpp>
+
+#include <cstdint>
+#include <thread>
+
+namespace {
+
+  // Writes a frame whose matrices all record the frame number
+  void write_frame( bit::math::transform_buffer& buffer, int frame )
+  {
+    auto* matrices = buffer.write_data();
+
+    for( auto i = std::size_t{0}; i < buffer.size(); ++i ) {
+      matrices[i] = bit::math::mat4::identity;
+      matrices[i](0,3) = static_cast<bit::math::float_t>(frame);
+      matrices[i](1,3) = static_cast<bit::math::float_t>(i);
+    }
+  }
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Constructors
+//----------------------------------------------------------------------------
+
+TEST_CASE("transform_buffer::transform_buffer( size_type )", "[constructors]")
+{
+  bit::math::transform_buffer buffer{ 10 };
+
+  SECTION("Reads identity matrices before anything is published")
+  {
+    REQUIRE_FALSE( buffer.has_update() );
+
+    const auto* matrices = buffer.read();
+    for( auto i = std::size_t{0}; i < buffer.size(); ++i ) {
+      REQUIRE( matrices[i] == bit::math::mat4::identity );
+    }
+  }
+
+  SECTION("Aligns each frame for streaming")
+  {
+    const auto address = reinterpret_cast<std::uintptr_t>( buffer.read() );
+
+    REQUIRE( address % 64 == 0 );
+    REQUIRE( buffer.size_bytes() == 10 * sizeof(bit::math::mat4) );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Reader / Writer
+//----------------------------------------------------------------------------
+
+TEST_CASE("transform_buffer::publish()", "[writer]")
+{
+  bit::math::transform_buffer buffer{ 4 };
+
+  SECTION("Hands the written frame to the reader")
+  {
+    auto t = bit::math::transform{};
+    t.set_position( 1, 2, 3 );
+
+    buffer.write( 2, t );
+    buffer.publish();
+
+    REQUIRE( buffer.has_update() );
+    REQUIRE( buffer.read()[2] == t.matrix() );
+    REQUIRE_FALSE( buffer.has_update() );
+  }
+
+  SECTION("Keeps the reader's view stable across publishes")
+  {
+    write_frame( buffer, 1 );
+    buffer.publish();
+
+    const auto* view = buffer.read();
+
+    write_frame( buffer, 2 );
+    buffer.publish();
+    write_frame( buffer, 3 );
+    buffer.publish();
+
+    REQUIRE( view[0](0,3) == 1 );
+  }
+
+  SECTION("Reads the most recently published frame")
+  {
+    for( auto frame = 1; frame <= 5; ++frame ) {
+      write_frame( buffer, frame );
+      buffer.publish();
+    }
+
+    REQUIRE( buffer.read()[0](0,3) == 5 );
+  }
+}
+
+TEST_CASE("transform_buffer with a concurrent writer and reader", "[writer]")
+{
+  constexpr auto frames = 2000;
+
+  bit::math::transform_buffer buffer{ 64 };
+
+  SECTION("The reader only ever sees whole frames, in order")
+  {
+    auto writer = std::thread{ [&buffer]{
+      for( auto frame = 1; frame <= frames; ++frame ) {
+        write_frame( buffer, frame );
+        buffer.publish();
+      }
+    }};
+
+    auto torn      = false;
+    auto reordered = false;
+    auto last      = bit::math::float_t(0);
+
+    while( last < frames ) {
+      const auto* matrices = buffer.read();
+      const auto frame = matrices[0](0,3);
+
+      // The identity frame is read until the first publish
+      if( frame == 0 ) continue;
+
+      for( auto i = std::size_t{0}; i < buffer.size(); ++i ) {
+        torn = torn || matrices[i](0,3) != frame
+                    || matrices[i](1,3) != static_cast<bit::math::float_t>(i);
+      }
+      reordered = reordered || frame < last;
+      last = frame;
+    }
+    writer.join();
+
+    REQUIRE_FALSE( torn );
+    REQUIRE_FALSE( reordered );
+  }
+}
@@ -0,0 +1,142 @@
+/**
+ * \file transform_hierarchy.test.cpp
+ *
+ * \brief Unit tests for bit::math::transform_hierarchy
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+
+#include <bit/math/transform_hierarchy.hpp>
+
+#include <catch.hpp>
+
+namespace {
+
+  bit::math::vec3 apply( const bit::math::mat4& m, const bit::math::vec3& p )
+  {
+    const auto result = bit::math::vec4{ p.x(), p.y(), p.z(), 1 } * m;
+
+    return { result.x(), result.y(), result.z() };
+  }
+
+  bit::math::quaternion quarter_turn_z()
+  {
+    return bit::math::quaternion{
+      bit::math::radian( bit::math::half_pi<bit::math::float_t>() ),
+      bit::math::vec3{ 0, 0, 1 }
+    };
+  }
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Modifiers
+//----------------------------------------------------------------------------
+
+TEST_CASE("transform_hierarchy::add_node( index_type )", "[modifiers]")
+{
+  using bit::math::transform_hierarchy;
+
+  auto hierarchy = transform_hierarchy{};
+
+  const auto root  = hierarchy.add_node();
+  const auto child = hierarchy.add_node( root );
+
+  SECTION("Stores the parent of each node")
+  {
+    REQUIRE( hierarchy.size() == 2 );
+    REQUIRE( hierarchy.parent(root) == transform_hierarchy::no_parent );
+    REQUIRE( hierarchy.parent(child) == root );
+  }
+
+  SECTION("New nodes are dirty until updated")
+  {
+    REQUIRE( hierarchy.is_dirty(child) );
+
+    hierarchy.update();
+
+    REQUIRE_FALSE( hierarchy.is_dirty(root) );
+    REQUIRE_FALSE( hierarchy.is_dirty(child) );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Update
+//----------------------------------------------------------------------------
+
+TEST_CASE("transform_hierarchy::update()", "[update]")
+{
+  using bit::math::vec3;
+
+  auto hierarchy = bit::math::transform_hierarchy{};
+
+  const auto root    = hierarchy.add_node();
+  const auto child   = hierarchy.add_node( root );
+  const auto sibling = hierarchy.add_node( root );
+  const auto leaf    = hierarchy.add_node( child );
+
+  hierarchy.set_position( root, vec3{ 10, 0, 0 } );
+  hierarchy.set_rotation( root, quarter_turn_z() );
+  hierarchy.set_position( child, vec3{ 1, 0, 0 } );
+  hierarchy.set_scale( child, vec3{ 2, 2, 2 } );
+  hierarchy.set_position( leaf, vec3{ 0, 1, 0 } );
+  hierarchy.update();
+
+  SECTION("Composes each node with its ancestors")
+  {
+    // The leaf's origin is (0,2,0) in the child's parent space after the
+    // child's scale, (1,2,0) after its translation, then (-2,1,0) after the
+    // root's rotation and (8,1,0) after its translation
+    const auto p = apply( hierarchy.world_matrix(leaf), vec3{ 0, 0, 0 } );
+
+    REQUIRE( p.x() == Approx(8) );
+    REQUIRE( p.y() == Approx(1) );
+    REQUIRE( p.z() == Approx(0).margin(1e-6) );
+  }
+
+  SECTION("Propagates changes down the subtree")
+  {
+    hierarchy.set_position( root, vec3{ 0, 0, 5 } );
+    hierarchy.update();
+
+    const auto p = apply( hierarchy.world_matrix(leaf), vec3{ 0, 0, 0 } );
+
+    REQUIRE( p.x() == Approx(-2) );
+    REQUIRE( p.y() == Approx(1) );
+    REQUIRE( p.z() == Approx(5) );
+  }
+
+  SECTION("Does not change ancestors or siblings of modified nodes")
+  {
+    const auto root_world    = hierarchy.world_matrix(root);
+    const auto sibling_world = hierarchy.world_matrix(sibling);
+
+    hierarchy.set_scale( child, vec3{ 3, 3, 3 } );
+
+    REQUIRE( hierarchy.is_dirty(child) );
+    REQUIRE_FALSE( hierarchy.is_dirty(sibling) );
+
+    hierarchy.update();
+
+    REQUIRE( hierarchy.world_matrix(root) == root_world );
+    REQUIRE( hierarchy.world_matrix(sibling) == sibling_world );
+    REQUIRE( apply( hierarchy.world_matrix(leaf), vec3{0,0,0} ).x() == Approx(7) );
+  }
+
+  SECTION("Matches composing each transform's matrix")
+  {
+    auto local = bit::math::transform{};
+    local.set_position( 3, -1, 2 );
+    local.set_rotation( quarter_turn_z() );
+
+    const auto node = hierarchy.add_node( local, leaf );
+    hierarchy.update();
+
+    const auto p = apply( hierarchy.world_matrix(node), vec3{ 1, 2, 3 } );
+    const auto expected = apply( hierarchy.world_matrix(leaf), apply( local.matrix(), vec3{ 1, 2, 3 } ) );
+
+    REQUIRE( p.x() == Approx(expected.x()) );
+    REQUIRE( p.y() == Approx(expected.y()) );
+    REQUIRE( p.z() == Approx(expected.z()) );
+  }
+}
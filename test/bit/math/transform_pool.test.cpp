@@ -0,0 +1,207 @@
+/**
+ * \file transform_pool.test.cpp
+ *
+ * \brief Unit tests for bit::math::transform_pool
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+
+#include <bit/math/transform_pool.hpp>
+
+#include <catch.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+  // Fills a pool with 'n' distinct transforms, mirrored into 'transforms'
+  void fill_pool( bit::math::transform_pool& pool,
+                  std::vector<bit::math::transform>& transforms,
+                  std::size_t n )
+  {
+    using bit::math::float_t;
+    using bit::math::radian;
+    using bit::math::vec3;
+
+    for( auto i = std::size_t{0}; i < n; ++i ) {
+      const auto f = static_cast<float_t>(i);
+
+      auto t = bit::math::transform{};
+      t.set_position( f, -f, f * float_t(0.5) );
+      t.set_rotation( radian(f * float_t(0.1)), vec3{1,2,3}.normalized() );
+      t.set_scale( 1 + f * float_t(0.25), 2, 1 + float_t(i % 3) );
+
+      transforms.push_back( t );
+      pool.add( t );
+    }
+  }
+
+  void require_matrix( const bit::math::mat4& actual,
+                       const bit::math::mat4& expected )
+  {
+    for( auto r = 0; r < 4; ++r ) {
+      for( auto c = 0; c < 4; ++c ) {
+        REQUIRE( actual(r,c) == Approx(expected(r,c)).margin(1e-5) );
+      }
+    }
+  }
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Modifiers
+//----------------------------------------------------------------------------
+
+TEST_CASE("transform_pool::add()", "[modifiers]")
+{
+  auto pool = bit::math::transform_pool{};
+
+  const auto handle = pool.add();
+
+  SECTION("Adds an identity transform")
+  {
+    REQUIRE( pool.size() == 1 );
+    REQUIRE( handle.index() == 0 );
+    REQUIRE( handle.position() == bit::math::vec3{0,0,0} );
+    REQUIRE( handle.scale() == bit::math::vec3{1,1,1} );
+    REQUIRE( handle.matrix() == bit::math::mat4::identity );
+  }
+
+  SECTION("Is dirty until the first update")
+  {
+    REQUIRE( pool.is_dirty(0) );
+
+    pool.update_dirty();
+
+    REQUIRE_FALSE( pool.is_dirty(0) );
+  }
+}
+
+TEST_CASE("transform_pool::add( const transform& )", "[modifiers]")
+{
+  using bit::math::vec3;
+
+  auto t = bit::math::transform{};
+  t.set_position( 1, 2, 3 );
+  t.set_rotation( bit::math::radian(0.5), vec3{0,1,0} );
+  t.set_scale( 4, 5, 6 );
+
+  auto pool = bit::math::transform_pool{};
+  const auto handle = pool.add( t );
+
+  SECTION("Stores the components of the transform")
+  {
+    REQUIRE( handle.position() == t.position() );
+    REQUIRE( handle.rotation() == t.rotation() );
+    REQUIRE( handle.scale() == t.scale() );
+  }
+}
+
+TEST_CASE("transform_pool::handle modifiers", "[modifiers]")
+{
+  using bit::math::vec3;
+
+  auto pool = bit::math::transform_pool{};
+  pool.add();
+  auto handle = pool.add();
+  pool.update_dirty();
+
+  SECTION("Translates relative to the current position")
+  {
+    handle.set_position( 1, 2, 3 );
+    handle.translate( 1, 1, 1 );
+
+    REQUIRE( handle.position() == vec3{2,3,4} );
+  }
+
+  SECTION("Scales relative to the current scale")
+  {
+    handle.scale( 1, 2, 3 );
+
+    REQUIRE( handle.scale() == vec3{2,3,4} );
+  }
+
+  SECTION("Marks only the modified transform dirty")
+  {
+    handle.translate( 1, 0, 0 );
+
+    REQUIRE_FALSE( pool.is_dirty(0) );
+    REQUIRE( pool.is_dirty(1) );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Update
+//----------------------------------------------------------------------------
+
+TEST_CASE("transform_pool::update_dirty()", "[update]")
+{
+  // 37 is not a multiple of any SIMD width, so the tail is exercised
+  constexpr auto count = std::size_t{37};
+
+  auto pool       = bit::math::transform_pool{};
+  auto transforms = std::vector<bit::math::transform>{};
+
+  fill_pool( pool, transforms, count );
+
+  SECTION("Matches transform::matrix() for every transform")
+  {
+    for( auto i = std::size_t{0}; i < count; ++i ) {
+      pool[i].translate( 0, 0, 0 );
+    }
+    pool.update_dirty();
+
+    for( auto i = std::size_t{0}; i < count; ++i ) {
+      require_matrix( pool.matrix(i), transforms[i].matrix() );
+    }
+  }
+
+  SECTION("Clears every dirty flag")
+  {
+    pool[3].translate( 1, 0, 0 );
+    pool.update_dirty();
+
+    for( auto i = std::size_t{0}; i < count; ++i ) {
+      REQUIRE_FALSE( pool.is_dirty(i) );
+    }
+  }
+
+  SECTION("Only rebuilds the dirty matrices")
+  {
+    pool.update_dirty();
+    const auto before = pool.matrix(4);
+
+    // Changing a neighbour in the same set of lanes leaves the clean
+    // transform untouched
+    pool[5].set_position( 100, 100, 100 );
+    pool.update_dirty();
+
+    REQUIRE( pool.matrix(4) == before );
+    REQUIRE( pool.matrix(5)(0,3) == 100 );
+  }
+
+  SECTION("Rebuilds matrices from handle modifications")
+  {
+    pool[10].rotate( bit::math::radian(1), bit::math::vec3{0,1,0} );
+    transforms[10].rotate( bit::math::radian(1), bit::math::vec3{0,1,0} );
+    pool.update_dirty();
+
+    require_matrix( pool.matrix(10), transforms[10].matrix() );
+  }
+}
+
+TEST_CASE("transform_pool::matrices()", "[observers]")
+{
+  auto pool = bit::math::transform_pool{};
+  auto transforms = std::vector<bit::math::transform>{};
+
+  fill_pool( pool, transforms, 17 );
+
+  SECTION("Is aligned for SIMD loads")
+  {
+    const auto address = reinterpret_cast<std::uintptr_t>( pool.matrices() );
+
+    REQUIRE( address % 64 == 0 );
+  }
+}